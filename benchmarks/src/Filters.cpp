@@ -4,6 +4,7 @@
 
 #include "common/Literals.hpp"
 #include "controllers/filters/FilterSet.hpp"
+#include "controllers/filters/lang/Filter.hpp"
 #include "MessageBuilding.hpp"
 #include "providers/recentmessages/Impl.hpp"
 
@@ -76,6 +77,58 @@ void BM_FilterMessages(benchmark::State &state, QString channel,
     bench.run(state);
 }
 
+/// Evaluates a single filter with either the compiled program or the
+/// tree-walking interpreter
+class EvaluateFilter : public bench::MessageBenchmark
+{
+public:
+    explicit EvaluateFilter(QString name, QString filter, bool interpret)
+        : bench::MessageBenchmark(std::move(name))
+        , filterText(std::move(filter))
+        , interpret(interpret)
+    {
+    }
+
+    void run(benchmark::State &state) override
+    {
+        auto parsed = recentmessages::detail::parseRecentMessages(
+            this->messages.object());
+        auto built = recentmessages::detail::buildRecentMessages(
+            parsed, this->chan.get());
+
+        auto result = filters::Filter::fromString(this->filterText);
+        assert(std::holds_alternative<filters::Filter>(result));
+        const auto &filter = std::get<filters::Filter>(result);
+
+        for (auto _ : state)
+        {
+            for (const auto &msg : built)
+            {
+                filters::RunContext ctx{
+                    .message = *msg,
+                    .channel = this->chan.get(),
+                };
+                bool filtered = this->interpret
+                                    ? filter.interpret(ctx).toBool()
+                                    : filter.matches(ctx);
+                benchmark::DoNotOptimize(filtered);
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+
+private:
+    QString filterText;
+    bool interpret;
+};
+
+void BM_EvaluateFilter(benchmark::State &state, QString channel,
+                       QString filter, bool interpret)
+{
+    EvaluateFilter bench(std::move(channel), std::move(filter), interpret);
+    bench.run(state);
+}
+
 }  // namespace
 
 BENCHMARK_CAPTURE(
@@ -129,3 +182,35 @@ BENCHMARK_CAPTURE(BM_FilterMessages, nymn_with_color_and_edm_separate,
                       uR".(!author.no_color)."_s,
                       uR".(message.content contains "EDM")."_s,
                   });
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_mod_party_interpreted, u"nymn"_s,
+    uR".((author.badges contains "moderator") && (message.content contains "forsenParty"))."_s, true);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_mod_party_compiled, u"nymn"_s,
+    uR".((author.badges contains "moderator") && (message.content contains "forsenParty"))."_s, false);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_big_or_interpreted, u"nymn"_s,
+    uR".((author.subbed && author.sub_length >= 6) || flags.system_message || flags.first_message || flags.automod || flags.sub_message)."_s, true);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_big_or_compiled, u"nymn"_s,
+    uR".((author.subbed && author.sub_length >= 6) || flags.system_message || flags.first_message || flags.automod || flags.sub_message)."_s, false);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_regex_and_flag_interpreted, u"nymn"_s,
+    uR".((message.content match ri"^!\w+") && !flags.first_message)."_s, true);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_regex_and_flag_compiled, u"nymn"_s,
+    uR".((message.content match ri"^!\w+") && !flags.first_message)."_s, false);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_constant_interpreted, u"nymn"_s,
+    uR".(((1 + 1) == 3) && (message.content contains "EDM"))."_s, true);
+
+BENCHMARK_CAPTURE(
+    BM_EvaluateFilter, nymn_constant_compiled, u"nymn"_s,
+    uR".(((1 + 1) == 3) && (message.content contains "EDM"))."_s, false);
@@ -5,7 +5,11 @@
 #include "MessageBuilding.hpp"
 
 #include "messages/Emote.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "util/Helpers.hpp"
 
+#include <IrcMessage>
+#include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 
@@ -89,3 +93,66 @@ MessageBenchmark::MessageBenchmark(QString name)
 }
 
 }  // namespace chatterino::bench
+
+namespace {
+
+using namespace chatterino;
+using namespace chatterino::bench;
+
+/// Builds the PRIVMSGs of a channel one after another, like
+/// IrcMessageHandler does on the GUI thread for incoming messages
+class BuildPrivMessages : public MessageBenchmark
+{
+public:
+    explicit BuildPrivMessages(QString name)
+        : MessageBenchmark(std::move(name))
+    {
+        for (const auto value :
+             this->messages.object()["messages"_L1].toArray())
+        {
+            auto line = value.toString().toUtf8();
+            // replies are resolved against the channel's messages
+            if (line.contains(" PRIVMSG ") &&
+                !line.contains("reply-parent-msg-id="))
+            {
+                this->messages_.emplace_back(
+                    static_cast<Communi::IrcPrivateMessage *>(
+                        Communi::IrcMessage::fromData(line, nullptr)));
+            }
+        }
+    }
+
+    void run(benchmark::State &state) override
+    {
+        for (auto _ : state)
+        {
+            for (const auto &privmsg : this->messages_)
+            {
+                MessageParseArgs args;
+                args.isAction = privmsg->isAction();
+                auto built = MessageBuilder::makeIrcMessage(
+                    this->chan.get(), privmsg.get(), args,
+                    unescapeZeroWidthJoiner(privmsg->content()), 0, nullptr,
+                    nullptr);
+                benchmark::DoNotOptimize(built);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<int64_t>(this->messages_.size()));
+    }
+
+private:
+    std::vector<std::unique_ptr<Communi::IrcPrivateMessage>> messages_;
+};
+
+void BM_BuildPrivMessages(benchmark::State &state, const QString &name)
+{
+    BuildPrivMessages bench(name);
+    bench.run(state);
+}
+
+}  // namespace
+
+// items_per_second is the number of messages built per second
+BENCHMARK_CAPTURE(BM_BuildPrivMessages, nymn, u"nymn"_s);
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageSimilarity.hpp"
+
+#include "messages/SimilaritySketch.hpp"
+#include "providers/recentmessages/Impl.hpp"
+
+#include <benchmark/benchmark.h>
+#include <IrcMessage>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chatterino;
+using namespace Qt::Literals;
+
+namespace {
+
+/// The implementation before the single-row rewrite, kept for comparison
+float tableSimilarity(QStringView str1, QStringView str2)
+{
+    using SizeType = QStringView::size_type;
+
+    std::vector<std::vector<int>> tree(str1.size(),
+                                       std::vector<int>(str2.size(), 0));
+    int z = 0;
+
+    for (SizeType i = 0; i < str1.size(); ++i)
+    {
+        for (SizeType j = 0; j < str2.size(); ++j)
+        {
+            if (str1[i] == str2[j])
+            {
+                if (i == 0 || j == 0)
+                {
+                    tree[i][j] = 1;
+                }
+                else
+                {
+                    tree[i][j] = tree[i - 1][j - 1] + 1;
+                }
+                z = std::max(tree[i][j], z);
+            }
+            else
+            {
+                tree[i][j] = 0;
+            }
+        }
+    }
+
+    if (z == 0)
+    {
+        return 0.F;
+    }
+
+    auto div = std::max<>({static_cast<SizeType>(1), str1.size(), str2.size()});
+
+    return float(z) / float(div);
+}
+
+/// Text of all PRIVMSGs in the recent messages of `name`
+std::vector<QString> loadCorpus(const QString &name)
+{
+    QFile file(u":/bench/recentmessages-%1.json"_s.arg(name));
+    if (!file.open(QFile::ReadOnly))
+    {
+        return {};
+    }
+    auto doc = QJsonDocument::fromJson(file.readAll());
+
+    std::vector<QString> texts;
+    for (auto *message :
+         recentmessages::detail::parseRecentMessages(doc.object()))
+    {
+        if (auto *privmsg = dynamic_cast<Communi::IrcPrivateMessage *>(message))
+        {
+            texts.emplace_back(privmsg->content());
+        }
+        delete message;
+    }
+    return texts;
+}
+
+// Compares every message to the `window` messages before it - like
+// setSimilarityFlags does with hideSimilarMaxMessagesToCheck.
+template <typename Fn>
+void runCorpus(benchmark::State &state, const QString &name, Fn &&compare)
+{
+    auto corpus = loadCorpus(name);
+    auto window = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        size_t similar = 0;
+        for (size_t i = 1; i < corpus.size(); i++)
+        {
+            for (size_t j = i - std::min(i, window); j < i; j++)
+            {
+                if (compare(corpus[i], corpus[j]))
+                {
+                    similar++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(similar);
+    }
+}
+
+constexpr float THRESHOLD = 0.9F;
+
+void BM_SimilarityTable(benchmark::State &state, const QString &name)
+{
+    runCorpus(state, name, [](const QString &a, const QString &b) {
+        return tableSimilarity(a, b) > THRESHOLD;
+    });
+}
+
+void BM_SimilarityRow(benchmark::State &state, const QString &name)
+{
+    runCorpus(state, name, [](const QString &a, const QString &b) {
+        return detail::relativeSimilarity(a, b) > THRESHOLD;
+    });
+}
+
+void BM_SimilaritySketch(benchmark::State &state, const QString &name)
+{
+    // Sketches are cached per message, so they're built outside the loop
+    auto corpus = loadCorpus(name);
+    std::vector<SimilaritySketch> sketches;
+    sketches.reserve(corpus.size());
+    for (const auto &text : corpus)
+    {
+        sketches.emplace_back(text);
+    }
+    auto window = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        size_t similar = 0;
+        for (size_t i = 1; i < corpus.size(); i++)
+        {
+            for (size_t j = i - std::min(i, window); j < i; j++)
+            {
+                auto longest = static_cast<float>(std::max<qsizetype>(
+                    {1, corpus[i].size(), corpus[j].size()}));
+                if (static_cast<float>(
+                        sketches[i].maxCommonSubstring(sketches[j])) /
+                        longest <=
+                    THRESHOLD)
+                {
+                    continue;
+                }
+                if (detail::relativeSimilarity(corpus[i], corpus[j]) >
+                    THRESHOLD)
+                {
+                    similar++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(similar);
+    }
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_SimilarityTable, nymn, u"nymn"_s)->Arg(3)->Arg(20);
+BENCHMARK_CAPTURE(BM_SimilarityRow, nymn, u"nymn"_s)->Arg(3)->Arg(20);
+BENCHMARK_CAPTURE(BM_SimilaritySketch, nymn, u"nymn"_s)->Arg(3)->Arg(20);
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/TwitchIrcLine.hpp"
+
+#include <benchmark/benchmark.h>
+#include <IrcMessage>
+#include <QByteArray>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+
+#include <vector>
+
+using namespace chatterino;
+using namespace Qt::Literals;
+
+namespace {
+
+/// Raw IRC lines captured in the recent messages of a channel
+std::vector<QByteArray> loadLines(const QString &name)
+{
+    QFile file(u":/bench/recentmessages-%1.json"_s.arg(name));
+    if (!file.open(QFile::ReadOnly))
+    {
+        return {};
+    }
+    auto doc = QJsonDocument::fromJson(file.readAll());
+
+    std::vector<QByteArray> lines;
+    for (const auto value : doc.object().value("messages").toArray())
+    {
+        lines.push_back(value.toString().toUtf8());
+    }
+    return lines;
+}
+
+/// Parses each line and reads the tags and parameters needed to dispatch and
+/// build a message.
+void BM_ParseIrcCommuni(benchmark::State &state, const QString &name)
+{
+    auto lines = loadLines(name);
+    for (auto _ : state)
+    {
+        for (const auto &line : lines)
+        {
+            auto *message = Communi::IrcMessage::fromData(line, nullptr);
+            benchmark::DoNotOptimize(message->command());
+            benchmark::DoNotOptimize(message->tag("display-name"));
+            benchmark::DoNotOptimize(message->tag("id"));
+            benchmark::DoNotOptimize(message->parameters());
+            delete message;
+        }
+    }
+}
+
+void BM_ParseIrcTwitchLine(benchmark::State &state, const QString &name)
+{
+    auto lines = loadLines(name);
+    for (auto _ : state)
+    {
+        for (const auto &line : lines)
+        {
+            auto parsed = TwitchIrcLine::parse(line);
+            benchmark::DoNotOptimize(parsed->type());
+            benchmark::DoNotOptimize(parsed->tag("display-name"));
+            benchmark::DoNotOptimize(parsed->tag("id"));
+            benchmark::DoNotOptimize(parsed->parameterString(0));
+            benchmark::DoNotOptimize(parsed->parameterString(1));
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ParseIrcCommuni, nymn, u"nymn"_s);
+BENCHMARK_CAPTURE(BM_ParseIrcTwitchLine, nymn, u"nymn"_s);
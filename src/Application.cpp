@@ -36,6 +36,7 @@
 #include "controllers/twitch/LiveController.hpp"
 #include "controllers/userdata/UserDataController.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/StartupTrace.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/bttv/BttvLiveUpdates.hpp"
@@ -62,6 +63,7 @@
 #include "singletons/WindowManager.hpp"
 #include "util/Helpers.hpp"
 #include "util/PostToThread.hpp"
+#include "util/TaskGraph.hpp"
 #include "widgets/Notebook.hpp"
 #include "widgets/splits/Split.hpp"
 #include "widgets/Window.hpp"
@@ -211,52 +213,94 @@ void Application::initialize(Settings &settings, const Modes &modes,
 {
     assert(!this->initialized);
 
-    // Show changelog
-    if (!this->args_.isFramelessEmbed &&
-        getSettings()->currentVersion.getValue() != "" &&
-        getSettings()->currentVersion.getValue() != CHATTERINO_VERSION)
-    {
-        auto *box = new QMessageBox(QMessageBox::Information, "Chatterino 2",
-                                    "Show changelog?",
-                                    QMessageBox::Yes | QMessageBox::No);
-        box->setAttribute(Qt::WA_DeleteOnClose);
-        if (box->exec() == QMessageBox::Yes)
-        {
-            QDesktopServices::openUrl(
-                QUrl("https://www.chatterino.com/changelog"));
-        }
-    }
-
-    if (!this->args_.isFramelessEmbed)
-    {
-        getSettings()->currentVersion.setValue(CHATTERINO_VERSION);
-    }
-    this->emotes->initialize();
-
-    this->accounts->load();
-
-    this->windows->initialize();
-
-    this->ffzBadges->load();
-
-    // Load global emotes
-    this->bttvEmotes->loadEmotes();
-    this->ffzEmotes->loadEmotes();
-    this->seventvEmotes->loadGlobalEmotes();
-
-    this->twitch->initialize();
-
-    // Load live status
-    this->notifications->initialize();
+    StartupSpan span(QStringLiteral("Application::initialize"));
+
+    // Steps on the pool must not touch anything the GUI thread uses until a
+    // step on the GUI thread depends on them.
+    TaskGraph tasks;
+
+    auto parseEmojis = tasks.add(
+        QStringLiteral("Parse emojis"), TaskGraph::Executor::Pool, [this] {
+            this->emotes->getEmojis()->loadData();
+        });
+    // the spell checker ignores its dictionary until it's loaded
+    tasks.add(QStringLiteral("Load dictionary"), TaskGraph::Executor::Pool,
+              [this, path = settings.spellCheckingDefaultDictionary.getValue()] {
+                  this->spellChecker->load(path);
+              });
+
+    tasks.add(
+        QStringLiteral("Show changelog"), TaskGraph::Executor::Caller, [this] {
+            if (!this->args_.isFramelessEmbed &&
+                getSettings()->currentVersion.getValue() != "" &&
+                getSettings()->currentVersion.getValue() != CHATTERINO_VERSION)
+            {
+                auto *box = new QMessageBox(
+                    QMessageBox::Information, "Chatterino 2",
+                    "Show changelog?", QMessageBox::Yes | QMessageBox::No);
+                box->setAttribute(Qt::WA_DeleteOnClose);
+                if (box->exec() == QMessageBox::Yes)
+                {
+                    QDesktopServices::openUrl(
+                        QUrl("https://www.chatterino.com/changelog"));
+                }
+            }
 
-    // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
-    // the AccountController initialize has been called
-    this->twitchBadges->loadTwitchBadges();
+            if (!this->args_.isFramelessEmbed)
+            {
+                getSettings()->currentVersion.setValue(CHATTERINO_VERSION);
+            }
+        });
+
+    tasks.add(QStringLiteral("Load accounts"), TaskGraph::Executor::Caller,
+              [this] {
+                  this->accounts->load();
+              });
+
+    // Nothing reads emojis before this, so they're parsed while the changelog
+    // is shown and the accounts are loaded.
+    tasks.add(
+        QStringLiteral("Initialize emotes"), TaskGraph::Executor::Caller,
+        [this] {
+            this->emotes->initialize();
+        },
+        {parseEmojis});
+
+    tasks.add(QStringLiteral("Initialize windows"), TaskGraph::Executor::Caller,
+              [this] {
+                  this->windows->initialize();
+              });
+
+    tasks.add(QStringLiteral("Load global emotes and badges"),
+              TaskGraph::Executor::Caller, [this] {
+                  this->ffzBadges->load();
+
+                  this->bttvEmotes->loadEmotes();
+                  this->ffzEmotes->loadEmotes();
+                  this->seventvEmotes->loadGlobalEmotes();
+              });
+
+    tasks.add(QStringLiteral("Initialize Twitch"), TaskGraph::Executor::Caller,
+              [this] {
+                  this->twitch->initialize();
+
+                  // Load live status
+                  this->notifications->initialize();
+
+                  // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
+                  // the AccountController initialize has been called
+                  this->twitchBadges->loadTwitchBadges();
+              });
 
 #ifdef CHATTERINO_HAVE_PLUGINS
-    this->plugins->initialize(settings);
+    tasks.add(QStringLiteral("Initialize plugins"),
+              TaskGraph::Executor::Caller, [this, &settings] {
+                  this->plugins->initialize(settings);
+              });
 #endif
 
+    tasks.run();
+
     // Show crash message.
     // On Windows, the crash message was already shown.
 #ifndef Q_OS_WIN
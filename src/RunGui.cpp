@@ -7,8 +7,11 @@
 #include "Application.hpp"
 #include "common/Args.hpp"
 #include "common/Modes.hpp"
+#include "common/network/NetworkCache.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/QLogging.hpp"
+#include "debug/StartupTrace.hpp"
+#include "messages/layouts/MessageBufferPool.hpp"
 #include "singletons/CrashHandler.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Resources.hpp"
@@ -189,13 +192,20 @@ void initSignalHandler()
 #endif
 }
 
-// We delete cache files that haven't been modified in 14 days. This strategy may be
-// improved in the future.
-void clearCache(const QDir &dir)
+// We delete cache files that haven't been modified in 14 days. Files managed by
+// a NetworkCache are skipped if `skipNetworkCache` is set, since these are
+// pruned by last access instead.
+void clearCache(const QDir &dir, bool skipNetworkCache = false)
 {
     size_t deletedCount = 0;
     for (const auto &info : dir.entryInfoList(QDir::Files))
     {
+        if (skipNetworkCache &&
+            NetworkCache::isCacheFileName(info.fileName()))
+        {
+            continue;
+        }
+
         if (info.lastModified().addDays(14) < QDateTime::currentDateTime())
         {
             bool res = QFile(info.absoluteFilePath()).remove();
@@ -245,9 +255,11 @@ void clearCrashes(QDir dir)
 void runGui(QApplication &a, const Modes &modes, const Paths &paths,
             Settings &settings, const Args &args, Updates &updates)
 {
+    StartupSpan initializingQt(QStringLiteral("Initialize Qt"));
     initQt(args);
     initResources();
     initSignalHandler();
+    initializingQt.end();
 
 #ifdef Q_OS_WIN
     if (args.crashRecovery)
@@ -265,7 +277,8 @@ void runGui(QApplication &a, const Modes &modes, const Paths &paths,
                                    crashDirectory = paths.crashdumpDirectory,
                                    avatarPath = paths.twitchProfileAvatars] {
         std::ignore = QtConcurrent::run([cachePath] {
-            clearCache(cachePath);
+            NetworkCache::forDirectory(cachePath).prune(std::chrono::days(14));
+            clearCache(cachePath, true);
         });
         std::ignore = QtConcurrent::run([avatarPath] {
             clearCache(avatarPath);
@@ -278,6 +291,15 @@ void runGui(QApplication &a, const Modes &modes, const Paths &paths,
     chatterino::NetworkManager::init();
     updates.checkForUpdates();
 
+    // NOTE: SETTINGS_LIFETIME
+    settings.cacheMaxSize.connect([](int maxSizeMiB) {
+        NetworkCache::setMaxBytes(qint64{maxSizeMiB} * 1024 * 1024);
+    });
+    settings.messageBufferBudget.connect([](int budgetMiB) {
+        MessageBufferPool::instance().setBudget(int64_t{budgetMiB} * 1024 *
+                                                1024);
+    });
+
     QObject::connect(qApp, &QApplication::aboutToQuit, [] {
         auto *app = dynamic_cast<Application *>(tryGetApp());
         assert(app != nullptr);
@@ -287,13 +309,18 @@ void runGui(QApplication &a, const Modes &modes, const Paths &paths,
         getSettings()->disableSave();
 
         app->stop();
+
+        StartupTrace::write();
     });
 
+    StartupSpan constructingApp(QStringLiteral("Construct Application"));
     Application app(settings, paths, args, updates);
+    constructingApp.end();
     app.initialize(settings, modes, paths);
     app.run();
 
     chatterino::NetworkManager::deinit();
+    NetworkCache::saveAll();
 
 #ifdef USEWINSDK
     // flushing windows clipboard to keep copied messages
@@ -194,6 +194,12 @@ Args::Args(const QApplication &app)
         "portable-dir", "Directory to use when portable mode is enabled.",
         "directory");
 
+    QCommandLineOption startupTraceOption(
+        "startup-trace",
+        "Records what Chatterino does while starting and writes it to the "
+        "file in the Chrome trace format once the first messages are shown.",
+        "file");
+
 #ifndef NDEBUG
     QCommandLineOption useLocalEventsubOption(
         "use-local-eventsub",
@@ -215,6 +221,7 @@ Args::Args(const QApplication &app)
         useOldScalingOption,
         portableEnable,
         portableDirectory,
+        startupTraceOption,
 #ifndef NDEBUG
         useLocalEventsubOption,
 #endif
@@ -302,6 +309,12 @@ Args::Args(const QApplication &app)
             QDir(parser.value(portableDirectory)).absolutePath();
     }
 
+    if (parser.isSet(startupTraceOption))
+    {
+        this->startupTrace =
+            QDir(parser.value(startupTraceOption)).absolutePath();
+    }
+
 #ifndef NDEBUG
     if (parser.isSet(useLocalEventsubOption))
     {
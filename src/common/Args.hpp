@@ -33,6 +33,7 @@ class Paths;
 /// -c, --channels=t:channel1;t:channel2;...
 /// -a, --activate=t:channel
 ///     --safe-mode
+///     --startup-trace=file
 ///
 /// See documentation on `QGuiApplication` for documentation on Qt arguments like -platform.
 class Args
@@ -73,6 +74,9 @@ public:
 
     bool useOldScaling = false;
 
+    /// Path to write a trace of the startup to (see StartupTrace)
+    std::optional<QString> startupTrace;
+
 #ifndef NDEBUG
     // twitch event websocket start-server --ssl --port 3012
     bool useLocalEventsub = false;
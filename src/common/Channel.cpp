@@ -47,6 +47,9 @@ Channel::Channel(const QString &name, Type type)
     , lastDate_(QDate::currentDate())
     , name_(name)
     , messages_(getSettings()->scrollbackSplitLimit)
+    , index_([this] {
+        return this->getMessageSnapshot();
+    })
     , type_(type)
 {
     if (this->isTwitchChannel())
@@ -161,8 +164,13 @@ void Channel::addMessage(MessagePtr message, MessageContext context,
         }
     }
 
-    if (this->messages_.pushBack(message, deleted))
+    // the message is indexed after it was added, so an index that's built
+    // in between doesn't miss it
+    bool removedFromStart = this->messages_.pushBack(message, deleted);
+    this->index_.pushBack(message);
+    if (removedFromStart)
     {
+        this->index_.popFront(deleted);
         this->messageRemovedFromStart(deleted);
     }
 
@@ -177,15 +185,36 @@ void Channel::addSystemMessage(const QString &contents)
 
 void Channel::addOrReplaceTimeout(MessagePtr message, const QDateTime &now)
 {
+    // Only the last 20 messages can be stacked. The messages of the user are
+    // looked up in the index instead of walking all messages.
+    auto userMessages = this->index_.byUser(message->timeoutUser);
+    MessagePtr toAdd;
     addOrReplaceChannelTimeout(
-        this->getMessageSnapshot(), std::move(message), now,
+        this->getMessageSnapshot(20), message, now,
         [this](auto /*idx*/, auto msg, auto replacement) {
             this->replaceMessage(msg, replacement);
         },
-        [this](auto msg) {
-            this->addMessage(msg, MessageContext::Original);
+        [&](auto msg) {
+            toAdd = msg;
         },
-        true);
+        false);
+
+    // disable the messages from the user
+    for (const auto &s : userMessages)
+    {
+        if (s->loginName == message->timeoutUser &&
+            s->flags.hasNone(
+                {MessageFlag::ModerationAction, MessageFlag::Whisper}))
+        {
+            s->flags.set(MessageFlag::Disabled);
+            s->flags.set(MessageFlag::InvalidReplyTarget);
+        }
+    }
+
+    if (toAdd)
+    {
+        this->addMessage(toAdd, MessageContext::Original);
+    }
 }
 
 void Channel::addOrReplaceClearChat(MessagePtr message, const QDateTime &now)
@@ -232,6 +261,7 @@ void Channel::addMessagesAtStart(const std::vector<MessagePtr> &_messages)
 
     if (addedMessages.size() != 0)
     {
+        this->index_.pushFront(addedMessages);
         this->messagesAddedAtStart.invoke(addedMessages);
     }
 }
@@ -254,83 +284,57 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
         msg->freeze();
     }
 
-    auto snapshot = this->getMessageSnapshot();
-    if (snapshot.size() == 0)
-    {
-        // There are no messages in this channel yet so we can just insert them
-        // at the front in order
-        this->messages_.pushFront(messages);
-        this->filledInMessages.invoke(messages);
-        return;
-    }
-
     std::unordered_set<QString> existingMessageIds;
-    existingMessageIds.reserve(snapshot.size());
-
-    // First, collect the ids of every message already present in the channel
-    for (const auto &msg : snapshot)
     {
-        if (msg->flags.has(MessageFlag::System) || msg->id.isEmpty())
-        {
-            continue;
-        }
-
-        existingMessageIds.insert(msg->id);
-    }
+        auto snapshot = this->getMessageSnapshot();
+        existingMessageIds.reserve(snapshot.size());
 
-    bool anyInserted = false;
-
-    // Keep track of the last message in the channel. We need this value
-    // to allow concurrent appends to the end of the channel while still
-    // being able to insert just-loaded historical messages at the end
-    // in the correct place.
-    auto lastMsg = snapshot[snapshot.size() - 1];
-    for (const auto &msg : messages)
-    {
-        // check if message already exists
-        if (existingMessageIds.count(msg->id) != 0)
-        {
-            continue;
-        }
-
-        // If we get to this point, we know we'll be inserting a message
-        anyInserted = true;
-
-        bool insertedFlag = false;
-        for (const auto &snapshotMsg : snapshot)
+        // First, collect the ids of every message already present in the
+        // channel
+        for (const auto &msg : snapshot)
         {
-            if (snapshotMsg->flags.has(MessageFlag::System))
+            if (msg->flags.has(MessageFlag::System) || msg->id.isEmpty())
             {
                 continue;
             }
 
-            if (msg->serverReceivedTime < snapshotMsg->serverReceivedTime)
-            {
-                // We found the first message that comes after the current message.
-                // Therefore, we can put the current message directly before. We
-                // assume that the messages we are filling in are in ascending
-                // order by serverReceivedTime.
-                this->messages_.insertBefore(snapshotMsg, msg);
-                insertedFlag = true;
-                break;
-            }
+            existingMessageIds.insert(msg->id);
         }
+    }
 
-        if (!insertedFlag)
+    std::vector<MessagePtr> missing;
+    missing.reserve(messages.size());
+    for (const auto &msg : messages)
+    {
+        if (existingMessageIds.count(msg->id) == 0)
         {
-            // We never found a message already in the channel that came after
-            // the current message. Put it at the end and make sure to update
-            // which message is considered "the end".
-            this->messages_.insertAfter(lastMsg, msg);
-            lastMsg = msg;
+            missing.push_back(msg);
         }
     }
 
-    if (anyInserted)
+    // Both the channel and the filled in messages are in ascending order by
+    // serverReceivedTime, so they're merged in a single pass. A message goes
+    // directly before the first message in the channel that came after it.
+    // Messages that came after all messages of the channel are appended.
+    auto indices = this->messages_.merge(
+        missing, [](const MessagePtr &msg, const MessagePtr &channelMsg) {
+            return !channelMsg->flags.has(MessageFlag::System) &&
+                   msg->serverReceivedTime < channelMsg->serverReceivedTime;
+        });
+
+    if (!indices.empty())
     {
+        // The messages ended up in the middle and old ones might have been
+        // dropped, which is rare enough to index everything again
+        this->index_.reset(this->getMessageSnapshot());
+
+        // Messages that didn't fit are the oldest ones
+        missing.erase(missing.begin(),
+                      missing.end() - static_cast<ptrdiff_t>(indices.size()));
+
         // We only invoke a signal once at the end of filling all messages to
         // prevent doing any unnecessary repaints.
-        this->filledInMessages.invoke(messages);
+        this->filledInMessages.invoke(missing, indices);
     }
 }
 
@@ -348,6 +352,7 @@ void Channel::replaceMessage(const MessagePtr &message,
 
     if (index >= 0)
     {
+        this->index_.replace(message, replacement);
         this->messageReplaced.invoke((size_t)index, message, replacement);
     }
 }
@@ -365,6 +370,7 @@ void Channel::replaceMessage(size_t index, const MessagePtr &replacement)
     MessagePtr prev;
     if (this->messages_.replaceItem(index, replacement, &prev))
     {
+        this->index_.replace(prev, replacement);
         this->messageReplaced.invoke(index, prev, replacement);
     }
 }
@@ -383,6 +389,7 @@ void Channel::replaceMessage(size_t hint, const MessagePtr &message,
     auto index = this->messages_.replaceItem(hint, message, replacement);
     if (index >= 0)
     {
+        this->index_.replace(message, replacement);
         this->messageReplaced.invoke(hint, message, replacement);
     }
 }
@@ -405,22 +412,18 @@ void Channel::clearMessages()
     }
 
     this->messages_.clear();
+    this->index_.clear();
     this->messagesCleared.invoke();
 }
 
 MessagePtr Channel::findMessageByID(QStringView messageID)
 {
-    MessagePtr res;
-
-    if (auto msg = this->messages_.rfind([messageID](const MessagePtr &msg) {
-            return msg->id == messageID;
-        });
-        msg)
-    {
-        res = *msg;
-    }
+    return this->index_.byID(messageID);
+}
 
-    return res;
+std::vector<MessagePtr> Channel::findMessagesByUser(QStringView login) const
+{
+    return this->index_.byUser(login);
 }
 
 void Channel::applySimilarityFilters(const MessagePtr &message) const
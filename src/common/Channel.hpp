@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "common/ChannelMessageIndex.hpp"
 #include "common/enums/MessageContext.hpp"
 #include "controllers/completion/TabCompletionModel.hpp"
 #include "messages/LimitedQueue.hpp"
@@ -68,7 +69,11 @@ public:
     pajlada::Signals::Signal<size_t, const MessagePtr &, const MessagePtr &>
         messageReplaced;
     /// Invoked when some number of messages were filled in using time received
-    pajlada::Signals::Signal<const std::vector<MessagePtr> &> filledInMessages;
+    /// (messages, indices): `messages[i]` was inserted at `indices[i]`. The
+    /// indices are ascending and refer to the messages after the insertion.
+    pajlada::Signals::Signal<const std::vector<MessagePtr> &,
+                             const std::vector<size_t> &>
+        filledInMessages;
     pajlada::Signals::NoArgSignal displayNameChanged;
     pajlada::Signals::NoArgSignal messagesCleared;
 
@@ -121,6 +126,10 @@ public:
 
     MessagePtr findMessageByID(QStringView messageID) final;
 
+    /// Returns the messages by or about the user `login` (case-insensitive),
+    /// oldest first. This doesn't walk all messages of the channel.
+    std::vector<MessagePtr> findMessagesByUser(QStringView login) const;
+
     bool hasMessages() const;
 
     size_t countMessages() const;
@@ -159,6 +168,8 @@ private:
 
     const QString name_;
     LimitedQueue<MessagePtr> messages_;
+    /// Kept in sync with messages_ once it's built on the first lookup
+    mutable ChannelMessageIndex index_;
     Type type_;
     bool anythingLogged_ = false;
 
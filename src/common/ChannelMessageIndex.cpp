@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/ChannelMessageIndex.hpp"
+
+#include "messages/Message.hpp"
+
+#include <QVarLengthArray>
+
+#include <algorithm>
+
+namespace {
+
+using namespace chatterino;
+
+/// The (lowercase) users a message belongs to
+QVarLengthArray<QString, 3> userKeys(const Message &message)
+{
+    QVarLengthArray<QString, 3> keys;
+    auto add = [&](const QString &user) {
+        if (user.isEmpty())
+        {
+            return;
+        }
+        auto key = user.toLower();
+        if (!keys.contains(key))
+        {
+            keys.push_back(std::move(key));
+        }
+    };
+
+    add(message.loginName);
+    add(message.timeoutUser);
+    // e.g. "forsen subscribed at Tier 1."
+    if (message.flags.has(MessageFlag::Subscription) &&
+        message.loginName.isEmpty())
+    {
+        add(message.messageText.section(u' ', 0, 0));
+    }
+    return keys;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+ChannelMessageIndex::ChannelMessageIndex(MessageLoader loadMessages)
+    : loadMessages_(std::move(loadMessages))
+    , built_(false)
+{
+}
+
+void ChannelMessageIndex::pushBack(const MessagePtr &message)
+{
+    std::lock_guard lock(this->mutex_);
+    if (!this->built_)
+    {
+        return;
+    }
+    this->insert(message, this->nextBack_++);
+}
+
+void ChannelMessageIndex::pushFront(const std::vector<MessagePtr> &messages)
+{
+    std::lock_guard lock(this->mutex_);
+    if (!this->built_)
+    {
+        return;
+    }
+    for (auto it = messages.rbegin(); it != messages.rend(); ++it)
+    {
+        this->insert(*it, this->nextFront_--);
+    }
+}
+
+void ChannelMessageIndex::popFront(const MessagePtr &message)
+{
+    std::lock_guard lock(this->mutex_);
+    this->erase(message, true);
+}
+
+void ChannelMessageIndex::replace(const MessagePtr &message,
+                                  const MessagePtr &replacement)
+{
+    std::lock_guard lock(this->mutex_);
+    auto order = this->erase(message, false);
+    if (order)
+    {
+        this->insert(replacement, *order);
+    }
+}
+
+void ChannelMessageIndex::reset(const std::vector<MessagePtr> &messages)
+{
+    std::lock_guard lock(this->mutex_);
+    this->byUser_.clear();
+    this->byID_.clear();
+    this->orders_.clear();
+    this->nextBack_ = 0;
+    this->nextFront_ = -1;
+    if (!this->built_)
+    {
+        return;
+    }
+    for (const auto &message : messages)
+    {
+        this->insert(message, this->nextBack_++);
+    }
+}
+
+void ChannelMessageIndex::clear()
+{
+    this->reset({});
+}
+
+std::vector<MessagePtr> ChannelMessageIndex::byUser(QStringView login)
+{
+    std::lock_guard lock(this->mutex_);
+    this->ensureBuilt();
+    auto it = this->byUser_.find(login.toString().toLower());
+    if (it == this->byUser_.end())
+    {
+        return {};
+    }
+
+    std::vector<MessagePtr> messages;
+    messages.reserve(it->second.size());
+    for (const auto &entry : it->second)
+    {
+        messages.push_back(entry.message);
+    }
+    return messages;
+}
+
+MessagePtr ChannelMessageIndex::byID(QStringView id)
+{
+    std::lock_guard lock(this->mutex_);
+    this->ensureBuilt();
+    auto it = this->byID_.find(id.toString());
+    if (it == this->byID_.end())
+    {
+        return nullptr;
+    }
+    return it->second.back().message;
+}
+
+size_t ChannelMessageIndex::userCount() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->byUser_.size();
+}
+
+void ChannelMessageIndex::ensureBuilt()
+{
+    if (this->built_)
+    {
+        return;
+    }
+
+    this->built_ = true;
+    // Changes made while the messages are loaded are applied after this
+    // (insert skips messages that are indexed already)
+    for (const auto &message : this->loadMessages_())
+    {
+        this->insert(message, this->nextBack_++);
+    }
+}
+
+void ChannelMessageIndex::insert(const MessagePtr &message, int64_t order)
+{
+    if (!this->orders_.try_emplace(message.get(), order).second)
+    {
+        return;
+    }
+
+    for (auto &key : userKeys(*message))
+    {
+        auto &entries = this->byUser_[std::move(key)];
+        // messages are almost always added at either end
+        if (entries.empty() || entries.back().order < order)
+        {
+            entries.push_back({.order = order, .message = message});
+        }
+        else if (entries.front().order > order)
+        {
+            entries.push_front({.order = order, .message = message});
+        }
+        else
+        {
+            auto pos = std::ranges::lower_bound(entries, order, {},
+                                                &Entry::order);
+            entries.insert(pos, {.order = order, .message = message});
+        }
+    }
+
+    if (!message->id.isEmpty())
+    {
+        auto &entries = this->byID_[message->id];
+        auto pos = std::ranges::lower_bound(entries, order, {}, &Entry::order);
+        entries.insert(pos, {.order = order, .message = message});
+    }
+}
+
+std::optional<int64_t> ChannelMessageIndex::erase(const MessagePtr &message,
+                                                  bool isOld)
+{
+    auto orderIt = this->orders_.find(message.get());
+    if (orderIt == this->orders_.end())
+    {
+        return std::nullopt;
+    }
+    auto order = orderIt->second;
+    this->orders_.erase(orderIt);
+
+    auto isMessage = [&](const Entry &entry) {
+        return entry.message == message;
+    };
+
+    for (const auto &key : userKeys(*message))
+    {
+        auto it = this->byUser_.find(key);
+        if (it == this->byUser_.end())
+        {
+            continue;
+        }
+        auto &entries = it->second;
+
+        auto pos = entries.end();
+        if (isOld)
+        {
+            pos = std::ranges::find_if(entries, isMessage);
+        }
+        else
+        {
+            auto rpos = std::ranges::find_if(entries.rbegin(), entries.rend(),
+                                             isMessage);
+            if (rpos != entries.rend())
+            {
+                pos = std::prev(rpos.base());
+            }
+        }
+        if (pos == entries.end())
+        {
+            continue;
+        }
+
+        entries.erase(pos);
+        if (entries.empty())
+        {
+            this->byUser_.erase(it);
+        }
+    }
+
+    if (!message->id.isEmpty())
+    {
+        auto it = this->byID_.find(message->id);
+        if (it != this->byID_.end())
+        {
+            // an older message with the same ID stays indexed
+            std::erase_if(it->second, isMessage);
+            if (it->second.empty())
+            {
+                this->byID_.erase(it);
+            }
+        }
+    }
+
+    return order;
+}
+
+}  // namespace chatterino
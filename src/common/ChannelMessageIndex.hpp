@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+#include <QStringView>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+/// @brief Finds the messages of a channel by user and by ID.
+///
+/// A message belongs to the users it's about: its author (`loginName`), the
+/// user it's moderating (`timeoutUser`) and, for subscriptions without an
+/// author, the subscriber. Users are matched case-insensitively.
+///
+/// The channel keeps the index in sync with its messages. Messages of a user
+/// are kept in the order of the channel.
+///
+/// An index can be built lazily: it then ignores all changes until the first
+/// lookup, which indexes the messages the channel has at that point. Channels
+/// that are never searched (e.g. /mentions or usercards) don't pay for it.
+///
+/// All methods are thread-safe.
+class ChannelMessageIndex
+{
+public:
+    using MessageLoader = std::function<std::vector<MessagePtr>()>;
+
+    ChannelMessageIndex() = default;
+    /// Builds the index from the messages returned by `loadMessages` on the
+    /// first lookup. The loader is called with the index locked, so it must
+    /// not use the index.
+    explicit ChannelMessageIndex(MessageLoader loadMessages);
+
+    /// Adds a message after all others
+    void pushBack(const MessagePtr &message);
+    /// Adds `messages` (in order) before all others
+    void pushFront(const std::vector<MessagePtr> &messages);
+    /// Removes a message that was dropped from the start of the channel
+    void popFront(const MessagePtr &message);
+    /// Puts `replacement` in the place of `message`
+    void replace(const MessagePtr &message, const MessagePtr &replacement);
+
+    /// Indexes `messages` from scratch
+    void reset(const std::vector<MessagePtr> &messages);
+    void clear();
+
+    /// Returns the messages belonging to `login`, oldest first
+    std::vector<MessagePtr> byUser(QStringView login);
+    /// Returns the newest message with the ID `id` or null if there's none
+    MessagePtr byID(QStringView id);
+
+    /// Number of users with messages (0 if the index wasn't built yet)
+    size_t userCount() const;
+
+private:
+    struct Entry {
+        /// Position relative to the other messages. Messages added to the
+        /// front get negative ones.
+        int64_t order;
+        MessagePtr message;
+    };
+
+    /// Builds the index if it's built lazily and wasn't built yet. Must be
+    /// called with mutex_ held.
+    void ensureBuilt();
+    /// Indexes `message` unless it's indexed already. Must be called with
+    /// mutex_ held.
+    void insert(const MessagePtr &message, int64_t order);
+    /// Removes `message` and returns its order if it was indexed. Old
+    /// messages are searched from the front, others from the back. Must be
+    /// called with mutex_ held.
+    std::optional<int64_t> erase(const MessagePtr &message, bool isOld);
+
+    mutable std::mutex mutex_;
+    MessageLoader loadMessages_;
+    /// False until a lazily built index is built. Changes are ignored until
+    /// then.
+    bool built_ = true;
+    std::unordered_map<QString, std::deque<Entry>> byUser_;
+    /// Every message with an ID, oldest first. IDs can repeat (e.g. a
+    /// message shown again), so there's usually one entry per ID.
+    std::unordered_map<QString, std::vector<Entry>> byID_;
+    /// The order of every indexed message, including the ones without users
+    /// or ID
+    std::unordered_map<const Message *, int64_t> orders_;
+    int64_t nextBack_ = 0;
+    int64_t nextFront_ = -1;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,578 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/network/NetworkCache.hpp"
+
+#include "common/QLogging.hpp"
+#include "util/DebugCount.hpp"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLocale>
+#include <QSaveFile>
+#include <QTimeZone>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr quint32 INDEX_MAGIC = 0x43324e43;  // C2NC
+constexpr quint32 INDEX_VERSION = 1;
+
+/// Length of a hex-encoded SHA-256 hash
+constexpr qsizetype HASH_LENGTH = 64;
+
+/// After eviction, the cache is trimmed to this fraction of the budget so we
+/// don't evict on every store.
+constexpr double EVICTION_TARGET = 0.9;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<qint64> MAX_BYTES = qint64{1024} * 1024 * 1024;
+
+struct Registry {
+    std::mutex mutex;
+    std::map<QString, std::unique_ptr<NetworkCache>> caches;
+};
+
+Registry &registry()
+{
+    // Caches are kept alive until exit
+    static Registry instance;
+    return instance;
+}
+
+qint64 nowSecs()
+{
+    return QDateTime::currentSecsSinceEpoch();
+}
+
+std::optional<qint64> parseMaxAge(const QByteArray &cacheControl)
+{
+    for (auto directive : cacheControl.split(','))
+    {
+        directive = directive.trimmed().toLower();
+        if (directive == "no-cache")
+        {
+            return 0;
+        }
+        if (directive.startsWith("max-age="))
+        {
+            bool ok = false;
+            auto maxAge = directive.mid(8).toLongLong(&ok);
+            if (ok)
+            {
+                return std::max<qint64>(maxAge, 0);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+QDateTime parseHttpDate(const QByteArray &value)
+{
+    // IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+    auto date = QLocale::c().toDateTime(QString::fromLatin1(value).trimmed(),
+                                        "ddd, dd MMM yyyy HH:mm:ss 'GMT'");
+    date.setTimeZone(QTimeZone::utc());
+    return date;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+bool NetworkCache::Entry::isFresh(const QDateTime &now) const
+{
+    return this->expires == 0 || now.toSecsSinceEpoch() < this->expires;
+}
+
+bool NetworkCache::Entry::canRevalidate() const
+{
+    return !this->etag.isEmpty() || !this->lastModified.isEmpty();
+}
+
+NetworkCache::NetworkCache(QString directory)
+    : directory(std::move(directory))
+{
+    this->loadIndex();
+}
+
+NetworkCache::~NetworkCache()
+{
+    this->save();
+}
+
+NetworkCache &NetworkCache::forDirectory(const QString &directory)
+{
+    auto &reg = registry();
+    std::unique_lock lock(reg.mutex);
+    auto &cache = reg.caches[directory];
+    if (!cache)
+    {
+        cache = std::make_unique<NetworkCache>(directory);
+    }
+    return *cache;
+}
+
+void NetworkCache::saveAll()
+{
+    auto &reg = registry();
+    std::unique_lock lock(reg.mutex);
+    for (const auto &[directory, cache] : reg.caches)
+    {
+        cache->save();
+    }
+}
+
+void NetworkCache::setMaxBytes(qint64 maxBytes)
+{
+    MAX_BYTES.store(std::max<qint64>(maxBytes, 0));
+}
+
+bool NetworkCache::isCacheFileName(const QString &fileName)
+{
+    if (fileName == INDEX_FILE_NAME)
+    {
+        return true;
+    }
+    if (fileName.size() != HASH_LENGTH)
+    {
+        return false;
+    }
+    return std::ranges::all_of(fileName, [](QChar c) {
+        return (c >= u'0' && c <= u'9') || (c >= u'a' && c <= u'f');
+    });
+}
+
+NetworkCache::Entry NetworkCache::entryFromHeaders(const RawHeaders &headers,
+                                                   const QDateTime &now)
+{
+    Entry entry;
+    entry.lastAccess = now.toSecsSinceEpoch();
+
+    std::optional<qint64> maxAge;
+    QDateTime expires;
+    for (const auto &[name, value] : headers)
+    {
+        if (name.compare("etag", Qt::CaseInsensitive) == 0)
+        {
+            entry.etag = value;
+        }
+        else if (name.compare("last-modified", Qt::CaseInsensitive) == 0)
+        {
+            entry.lastModified = value;
+        }
+        else if (name.compare("content-type", Qt::CaseInsensitive) == 0)
+        {
+            entry.contentType = value;
+        }
+        else if (name.compare("cache-control", Qt::CaseInsensitive) == 0)
+        {
+            // no-store is intentionally not honored: responses were always
+            // cached before, and some users rely on emotes loading offline.
+            maxAge = parseMaxAge(value);
+        }
+        else if (name.compare("expires", Qt::CaseInsensitive) == 0)
+        {
+            expires = parseHttpDate(value);
+        }
+    }
+
+    if (maxAge)
+    {
+        // max-age=0 (or no-cache) results in an expiry of now, meaning the
+        // entry is revalidated on its next use
+        entry.expires = now.toSecsSinceEpoch() + *maxAge;
+    }
+    else if (expires.isValid())
+    {
+        entry.expires = std::max(expires.toSecsSinceEpoch(), qint64{1});
+    }
+
+    return entry;
+}
+
+std::optional<NetworkCache::Entry> NetworkCache::lookup(
+    const QString &hash) const
+{
+    std::unique_lock lock(this->mutex);
+    auto it = this->entries.find(hash);
+    if (it == this->entries.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<QByteArray> NetworkCache::read(const QString &hash)
+{
+    QFile file(this->filePath(hash));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        // The file was removed behind our back (e.g. "Clear Cache")
+        std::unique_lock lock(this->mutex);
+        auto it = this->entries.find(hash);
+        if (it != this->entries.end())
+        {
+            this->eraseLocked(it);
+            DebugCount::set(DebugObject::BytesNetworkCache, this->totalBytes_);
+        }
+        return std::nullopt;
+    }
+
+    auto bytes = file.readAll();
+
+    std::unique_lock lock(this->mutex);
+    auto it = this->entries.find(hash);
+    if (it != this->entries.end())
+    {
+        it->second.lastAccess = nowSecs();
+        this->dirty = true;
+    }
+
+    return bytes;
+}
+
+void NetworkCache::store(const QString &hash, const QByteArray &bytes,
+                         Entry entry)
+{
+    QFile file(this->filePath(hash));
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCDebug(chatterinoCache)
+            << "Failed to write cache file" << file.fileName()
+            << file.errorString();
+        return;
+    }
+    file.write(bytes);
+    file.close();
+
+    entry.size = bytes.size();
+    entry.lastAccess = nowSecs();
+
+    bool overBudget = false;
+    {
+        std::unique_lock lock(this->mutex);
+        auto &slot = this->entries[hash];
+        this->totalBytes_ += entry.size - slot.size;
+        slot = std::move(entry);
+        this->dirty = true;
+
+        overBudget = this->totalBytes_ > MAX_BYTES.load();
+        DebugCount::set(DebugObject::BytesNetworkCache, this->totalBytes_);
+    }
+
+    if (overBudget)
+    {
+        this->evict();
+    }
+}
+
+void NetworkCache::revalidated(const QString &hash, const Entry &updated)
+{
+    std::unique_lock lock(this->mutex);
+    auto it = this->entries.find(hash);
+    if (it == this->entries.end())
+    {
+        return;
+    }
+
+    auto &entry = it->second;
+    entry.lastAccess = updated.lastAccess;
+    entry.expires = updated.expires;
+    // A 304 only has to carry validators if they changed
+    if (!updated.etag.isEmpty())
+    {
+        entry.etag = updated.etag;
+    }
+    if (!updated.lastModified.isEmpty())
+    {
+        entry.lastModified = updated.lastModified;
+    }
+    this->dirty = true;
+}
+
+void NetworkCache::prune(std::chrono::seconds maxAge)
+{
+    std::vector<QString> removedFiles;
+    {
+        std::unique_lock lock(this->mutex);
+
+        auto cutoff = nowSecs() - maxAge.count();
+        for (auto it = this->entries.begin(); it != this->entries.end();)
+        {
+            if (it->second.lastAccess < cutoff)
+            {
+                auto next = std::next(it);
+                removedFiles.emplace_back(this->eraseLocked(it));
+                it = next;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        DebugCount::set(DebugObject::BytesNetworkCache, this->totalBytes_);
+    }
+    removeFiles(removedFiles);
+
+    this->evict();
+
+    qCDebug(chatterinoCache)
+        << "Pruned" << removedFiles.size() << "unused files in"
+        << this->directory << "- now" << this->entryCount() << "files,"
+        << this->totalBytes() << "bytes";
+
+    this->save();
+}
+
+void NetworkCache::clear()
+{
+    std::unique_lock lock(this->mutex);
+    this->entries.clear();
+    this->totalBytes_ = 0;
+    this->dirty = true;
+    DebugCount::set(DebugObject::BytesNetworkCache, 0);
+}
+
+void NetworkCache::save()
+{
+    QByteArray data;
+    {
+        std::unique_lock lock(this->mutex);
+        if (!this->dirty)
+        {
+            return;
+        }
+
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream << INDEX_MAGIC << INDEX_VERSION
+               << static_cast<quint64>(this->entries.size());
+        for (const auto &[hash, entry] : this->entries)
+        {
+            // store the raw 32 byte hash instead of its hex representation
+            stream << QByteArray::fromHex(hash.toLatin1()) << entry.size
+                   << entry.lastAccess << entry.expires << entry.etag
+                   << entry.lastModified << entry.contentType;
+        }
+        this->dirty = false;
+    }
+
+    QSaveFile file(QDir(this->directory).filePath(INDEX_FILE_NAME.toString()));
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(chatterinoCache)
+            << "Failed to save cache index" << file.errorString();
+        return;
+    }
+    file.write(data);
+    if (!file.commit())
+    {
+        qCWarning(chatterinoCache)
+            << "Failed to save cache index" << file.errorString();
+    }
+}
+
+qint64 NetworkCache::totalBytes() const
+{
+    std::unique_lock lock(this->mutex);
+    return this->totalBytes_;
+}
+
+size_t NetworkCache::entryCount() const
+{
+    std::unique_lock lock(this->mutex);
+    return this->entries.size();
+}
+
+void NetworkCache::loadIndex()
+{
+    QFile file(QDir(this->directory).filePath(INDEX_FILE_NAME.toString()));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        // First start with an index - adopt the files of older versions
+        this->scanDirectory();
+        return;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint64 count = 0;
+    stream >> magic >> version >> count;
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION)
+    {
+        qCWarning(chatterinoCache) << "Ignoring incompatible cache index";
+        this->scanDirectory();
+        return;
+    }
+
+    this->entries.reserve(static_cast<size_t>(count));
+    for (quint64 i = 0; i < count && stream.status() == QDataStream::Ok; i++)
+    {
+        QByteArray rawHash;
+        Entry entry;
+        stream >> rawHash >> entry.size >> entry.lastAccess >> entry.expires >>
+            entry.etag >> entry.lastModified >> entry.contentType;
+        if (stream.status() != QDataStream::Ok)
+        {
+            break;
+        }
+        this->totalBytes_ += entry.size;
+        this->entries.emplace(QString::fromLatin1(rawHash.toHex()),
+                              std::move(entry));
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        qCWarning(chatterinoCache) << "Cache index is corrupt, rebuilding it";
+        this->entries.clear();
+        this->totalBytes_ = 0;
+        this->scanDirectory();
+        return;
+    }
+
+    // The index is only saved from time to time, so files stored before a
+    // crash would otherwise never be evicted
+    this->scanDirectory();
+
+    qCDebug(chatterinoCache) << "Loaded cache index with"
+                             << this->entries.size() << "files,"
+                             << this->totalBytes_ << "bytes";
+}
+
+void NetworkCache::scanDirectory()
+{
+    std::unordered_map<QString, Entry> scanned;
+    scanned.reserve(this->entries.size());
+    qint64 totalBytes = 0;
+    size_t added = 0;
+    size_t resized = 0;
+
+    QDir dir(this->directory);
+    for (const auto &info : dir.entryInfoList(QDir::Files))
+    {
+        if (info.fileName() == INDEX_FILE_NAME ||
+            !isCacheFileName(info.fileName()))
+        {
+            continue;
+        }
+
+        Entry entry;
+        auto it = this->entries.find(info.fileName());
+        if (it != this->entries.end())
+        {
+            entry = std::move(it->second);
+        }
+        else
+        {
+            entry.lastAccess = info.lastModified().toSecsSinceEpoch();
+            added++;
+        }
+        if (entry.size != info.size())
+        {
+            entry.size = info.size();
+            resized++;
+        }
+        totalBytes += entry.size;
+        scanned.emplace(info.fileName(), std::move(entry));
+    }
+
+    auto dropped = this->entries.size() - (scanned.size() - added);
+    if (added > 0 || resized > 0 || dropped > 0)
+    {
+        qCDebug(chatterinoCache)
+            << "Cache index was out of date: added" << added << "files,"
+            << "dropped" << dropped << "entries";
+        this->dirty = true;
+    }
+
+    this->entries = std::move(scanned);
+    this->totalBytes_ = totalBytes;
+    DebugCount::set(DebugObject::BytesNetworkCache, this->totalBytes_);
+}
+
+QString NetworkCache::filePath(const QString &hash) const
+{
+    return this->directory + '/' + hash;
+}
+
+void NetworkCache::evict()
+{
+    auto maxBytes = MAX_BYTES.load();
+
+    std::vector<std::pair<qint64, QString>> byAccess;
+    {
+        std::unique_lock lock(this->mutex);
+        if (this->totalBytes_ <= maxBytes)
+        {
+            return;
+        }
+
+        byAccess.reserve(this->entries.size());
+        for (const auto &[hash, entry] : this->entries)
+        {
+            byAccess.emplace_back(entry.lastAccess, hash);
+        }
+    }
+
+    // Reads and stores can continue while the candidates are sorted
+    std::ranges::sort(byAccess);
+
+    auto target = static_cast<qint64>(static_cast<double>(maxBytes) *
+                                      EVICTION_TARGET);
+    std::vector<QString> evictedFiles;
+    {
+        std::unique_lock lock(this->mutex);
+        for (const auto &[lastAccess, hash] : byAccess)
+        {
+            if (this->totalBytes_ <= target)
+            {
+                break;
+            }
+
+            auto it = this->entries.find(hash);
+            // skip entries that were removed or used in the meantime
+            if (it == this->entries.end() ||
+                it->second.lastAccess != lastAccess)
+            {
+                continue;
+            }
+            evictedFiles.emplace_back(this->eraseLocked(it));
+        }
+        DebugCount::set(DebugObject::BytesNetworkCache, this->totalBytes_);
+    }
+    removeFiles(evictedFiles);
+
+    qCDebug(chatterinoCache) << "Evicted" << evictedFiles.size()
+                             << "files from" << this->directory;
+}
+
+QString NetworkCache::eraseLocked(
+    std::unordered_map<QString, Entry>::iterator it)
+{
+    auto path = this->filePath(it->first);
+    this->totalBytes_ -= it->second.size;
+    this->entries.erase(it);
+    this->dirty = true;
+    return path;
+}
+
+void NetworkCache::removeFiles(const std::vector<QString> &paths)
+{
+    for (const auto &path : paths)
+    {
+        QFile::remove(path);
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QList>
+#include <QString>
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace chatterino {
+
+/// On-disk cache for responses of requests made with NetworkRequest::cache().
+///
+/// Every response is stored in its own file named after the request hash. An
+/// index of all files (size, last access, validators) is kept in memory and
+/// persisted to `INDEX_FILE_NAME` in the cache directory. Once the total size
+/// exceeds the byte budget, the least recently used files are removed.
+///
+/// All functions are thread-safe. File contents are read and written without
+/// holding the index lock.
+class NetworkCache
+{
+public:
+    struct Entry {
+        qint64 size = 0;
+        /// Seconds since epoch
+        qint64 lastAccess = 0;
+        /// Seconds since epoch after which the entry has to be revalidated.
+        /// 0 if the server didn't specify an expiry - such entries are
+        /// considered fresh until they're evicted.
+        qint64 expires = 0;
+        QByteArray etag;
+        QByteArray lastModified;
+        QByteArray contentType;
+
+        bool isFresh(const QDateTime &now) const;
+        bool canRevalidate() const;
+    };
+
+    using RawHeaders = QList<std::pair<QByteArray, QByteArray>>;
+
+    static constexpr QStringView INDEX_FILE_NAME = u"network-cache.idx";
+
+    explicit NetworkCache(QString directory);
+    ~NetworkCache();
+
+    NetworkCache(const NetworkCache &) = delete;
+    NetworkCache &operator=(const NetworkCache &) = delete;
+    NetworkCache(NetworkCache &&) = delete;
+    NetworkCache &operator=(NetworkCache &&) = delete;
+
+    /// Returns the process-wide cache for `directory`
+    static NetworkCache &forDirectory(const QString &directory);
+
+    /// Persists the index of all caches returned by forDirectory
+    static void saveAll();
+
+    /// Sets the byte budget of all caches
+    static void setMaxBytes(qint64 maxBytes);
+
+    /// Returns true for files managed by a NetworkCache
+    static bool isCacheFileName(const QString &fileName);
+
+    /// Builds the metadata of a response from its headers
+    static Entry entryFromHeaders(const RawHeaders &headers,
+                                  const QDateTime &now);
+
+    /// Returns the metadata of the cached response for `hash`
+    std::optional<Entry> lookup(const QString &hash) const;
+
+    /// Reads the cached response for `hash` and marks it as recently used
+    std::optional<QByteArray> read(const QString &hash);
+
+    /// Stores `bytes` as the response for `hash`
+    void store(const QString &hash, const QByteArray &bytes, Entry entry);
+
+    /// Updates the metadata of a revalidated (304) response
+    void revalidated(const QString &hash, const Entry &updated);
+
+    /// Removes entries that haven't been used within `maxAge`, enforces the
+    /// byte budget and persists the index
+    void prune(std::chrono::seconds maxAge);
+
+    /// Forgets all entries (the files are expected to be removed by the caller)
+    void clear();
+
+    /// Persists the index if it changed since it was last saved
+    void save();
+
+    qint64 totalBytes() const;
+    size_t entryCount() const;
+
+private:
+    void loadIndex();
+    /// Makes the index match the files in the directory. Files missing from
+    /// the index (e.g. stored after it was last saved) are added and entries
+    /// without a file are dropped.
+    void scanDirectory();
+    QString filePath(const QString &hash) const;
+
+    /// Removes the least recently used entries until the cache fits into
+    /// the budget. `mutex` must not be held.
+    void evict();
+    /// Removes the entry and returns the path of its file, which the caller
+    /// removes once `mutex` is released
+    QString eraseLocked(std::unordered_map<QString, Entry>::iterator it);
+    static void removeFiles(const std::vector<QString> &paths);
+
+    const QString directory;
+
+    mutable std::mutex mutex;
+    std::unordered_map<QString, Entry> entries;
+    qint64 totalBytes_ = 0;
+    bool dirty = false;
+};
+
+}  // namespace chatterino
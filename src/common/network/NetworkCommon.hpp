@@ -7,6 +7,7 @@
 #include <QString>
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 class QNetworkReply;
@@ -14,10 +15,16 @@ class QNetworkReply;
 namespace chatterino {
 
 class NetworkResult;
+class NetworkData;
 
 using NetworkSuccessCallback = std::function<void(NetworkResult)>;
 using NetworkErrorCallback = std::function<void(NetworkResult)>;
 using NetworkFinallyCallback = std::function<void()>;
+/// Receives a request instead of sending it (see NetworkRequest::scheduler)
+using NetworkScheduleCallback =
+    std::function<void(std::shared_ptr<NetworkData>)>;
+/// Returns false if the response must not be delivered to the callbacks
+using NetworkResponseCallback = std::function<bool(const NetworkResult &)>;
 
 /**
  * @exposeenum c2.HTTPMethod
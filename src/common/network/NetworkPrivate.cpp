@@ -5,6 +5,7 @@
 #include "common/network/NetworkPrivate.hpp"
 
 #include "Application.hpp"
+#include "common/network/NetworkCache.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/network/NetworkTask.hpp"
@@ -17,8 +18,8 @@
 
 #include <magic_enum/magic_enum.hpp>
 #include <QCryptographicHash>
+#include <QDateTime>
 #include <QElapsedTimer>
-#include <QFile>
 #include <QNetworkReply>
 #include <QtConcurrent>
 
@@ -80,22 +81,49 @@ void loadCached(std::shared_ptr<NetworkData> &&data)
         return;
     }
 
-    QFile cachedFile(app->getPaths().cacheDirectory() + "/" + data->getHash());
+    auto &cache = NetworkCache::forDirectory(app->getPaths().cacheDirectory());
+    // The hash has to be computed before any conditional headers are added
+    auto hash = data->getHash();
 
-    if (!cachedFile.exists() || !cachedFile.open(QIODevice::ReadOnly))
+    auto entry = cache.lookup(hash);
+    if (!entry)
     {
         loadUncached(std::move(data));
         return;
     }
 
-    // XXX: check if bytes is empty?
-    QByteArray bytes = cachedFile.readAll();
+    if (!entry->isFresh(QDateTime::currentDateTime()))
+    {
+        if (entry->canRevalidate())
+        {
+            if (!entry->etag.isEmpty())
+            {
+                data->request.setRawHeader("If-None-Match", entry->etag);
+            }
+            if (!entry->lastModified.isEmpty())
+            {
+                data->request.setRawHeader("If-Modified-Since",
+                                           entry->lastModified);
+            }
+            data->revalidatingCache = true;
+        }
+        loadUncached(std::move(data));
+        return;
+    }
 
+    auto bytes = cache.read(hash);
+    if (!bytes)
+    {
+        loadUncached(std::move(data));
+        return;
+    }
+
+    DebugCount::increase(DebugObject::HTTPCacheHit);
     qCDebug(chatterinoHTTP).noquote() << data->typeString() << "[CACHED] 200"
                                       << data->request.url().toString();
 
     data->emitSuccess(
-        {NetworkResult::NetworkError::NoError, QVariant(200), bytes});
+        {NetworkResult::NetworkError::NoError, QVariant(200), *bytes});
     data->emitFinally();
 }
 
@@ -135,6 +163,15 @@ QString NetworkData::getHash()
     return this->hash_;
 }
 
+bool NetworkData::handleResponse(const NetworkResult &result)
+{
+    if (!this->onResponse)
+    {
+        return true;
+    }
+    return this->onResponse(result);
+}
+
 void NetworkData::emitSuccess(NetworkResult &&result)
 {
     if (!this->onSuccess)
@@ -233,6 +270,19 @@ QString NetworkData::typeString() const
 }
 
 void load(std::shared_ptr<NetworkData> &&data)
+{
+    if (data->schedule)
+    {
+        auto schedule = std::move(data->schedule);
+        data->schedule = nullptr;
+        schedule(std::move(data));
+        return;
+    }
+
+    loadScheduled(std::move(data));
+}
+
+void loadScheduled(std::shared_ptr<NetworkData> data)
 {
     if (data->cache)
     {
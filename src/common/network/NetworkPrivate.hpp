@@ -44,12 +44,23 @@ public:
     bool hasCaller{};
     QPointer<QObject> caller;
     bool cache{};
+    /// Set if the request carries validators of a stale cache entry. A 304
+    /// response is then answered from the cache.
+    bool revalidatingCache{};
     bool executeConcurrently{};
 
     NetworkSuccessCallback onSuccess;
     NetworkErrorCallback onError;
     NetworkFinallyCallback finally;
 
+    /// Decides when the request is sent (see NetworkRequest::scheduler)
+    NetworkScheduleCallback schedule;
+    /// Called on the network thread with every response before the callbacks
+    /// run, even if the caller was destroyed. Returns false if the response
+    /// must not be delivered to the callbacks (e.g. because the request will
+    /// be sent again).
+    NetworkResponseCallback onResponse;
+
     NetworkRequestType requestType = NetworkRequestType::Get;
 
     QByteArray payload;
@@ -64,6 +75,10 @@ public:
 
     QString getHash();
 
+    /// Runs `onResponse`. Returns false if the response must not be
+    /// delivered.
+    bool handleResponse(const NetworkResult &result);
+
     void emitSuccess(NetworkResult &&result);
     void emitError(NetworkResult &&result);
     void emitFinally();
@@ -74,6 +89,10 @@ private:
     QString hash_;
 };
 
+/// Sends the request. If it has a scheduler, it's handed to the scheduler
+/// instead, which sends it with loadScheduled.
 void load(std::shared_ptr<NetworkData> &&data);
+/// Sends a request that was handed to a scheduler
+void loadScheduled(std::shared_ptr<NetworkData> data);
 
 }  // namespace chatterino
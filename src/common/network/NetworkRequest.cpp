@@ -132,6 +132,12 @@ NetworkRequest NetworkRequest::concurrent() &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::scheduler(NetworkScheduleCallback schedule) &&
+{
+    this->data->schedule = std::move(schedule);
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::multiPart(QHttpMultiPart *payload) &&
 {
     this->data->multiPartPayload = {payload, {}};
@@ -69,6 +69,11 @@ public:
         const std::vector<std::pair<QByteArray, QByteArray>> &headers) &&;
     NetworkRequest timeout(int ms) &&;
     NetworkRequest concurrent() &&;
+    /// Hands the request to `schedule` when it's executed instead of sending
+    /// it right away. The scheduler sends it with `loadScheduled` and can
+    /// watch its responses with `NetworkData::onResponse` (see
+    /// NetworkPrivate.hpp).
+    NetworkRequest scheduler(NetworkScheduleCallback schedule) &&;
     NetworkRequest multiPart(QHttpMultiPart *payload) &&;
     /**
      * This will change `RedirectPolicyAttribute`.
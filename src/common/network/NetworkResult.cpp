@@ -88,6 +88,23 @@ const QByteArray &NetworkResult::getData() const
     return this->data_;
 }
 
+QByteArray NetworkResult::rawHeader(QByteArrayView name) const
+{
+    for (const auto &[key, value] : this->headers_)
+    {
+        if (name.compare(key, Qt::CaseInsensitive) == 0)
+        {
+            return value;
+        }
+    }
+    return {};
+}
+
+void NetworkResult::setRawHeaders(QList<QNetworkReply::RawHeaderPair> headers)
+{
+    this->headers_ = std::move(headers);
+}
+
 QString NetworkResult::formatError() const
 {
     // Print the status for errors that mirror HTTP status codes (=0 || >99)
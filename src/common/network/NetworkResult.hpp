@@ -38,6 +38,11 @@ public:
     rapidjson::Document parseRapidJson() const;
     const QByteArray &getData() const;
 
+    /// Returns the value of the response header `name` (case-insensitive) or
+    /// an empty array if the response didn't have it.
+    QByteArray rawHeader(QByteArrayView name) const;
+    void setRawHeaders(QList<QNetworkReply::RawHeaderPair> headers);
+
     /// The error code of the reply.
     /// In case of a successful reply, this will be NoError (0)
     NetworkError error() const
@@ -57,6 +62,7 @@ public:
 
 private:
     QByteArray data_;
+    QList<QNetworkReply::RawHeaderPair> headers_;
 
     NetworkError error_;
     std::optional<int> status_;
@@ -5,6 +5,7 @@
 #include "common/network/NetworkTask.hpp"
 
 #include "Application.hpp"
+#include "common/network/NetworkCache.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkPrivate.hpp"
 #include "common/network/NetworkResult.hpp"
@@ -13,7 +14,7 @@
 #include "util/AbandonObject.hpp"
 #include "util/DebugCount.hpp"
 
-#include <QFile>
+#include <QDateTime>
 #include <QNetworkReply>
 #include <QtConcurrent>
 
@@ -153,7 +154,8 @@ void NetworkTask::logReply()
 
 void NetworkTask::writeToCache(const QByteArray &bytes) const
 {
-    std::ignore = QtConcurrent::run([data = this->data_, bytes] {
+    std::ignore = QtConcurrent::run([data = this->data_, bytes,
+                                     headers = this->reply_->rawHeaderPairs()] {
         if (isAppAboutToQuit())
         {
             qCDebug(chatterinoHTTP)
@@ -171,13 +173,44 @@ void NetworkTask::writeToCache(const QByteArray &bytes) const
             return;
         }
 
-        QFile cachedFile(app->getPaths().cacheDirectory() + "/" +
-                         data->getHash());
+        NetworkCache::forDirectory(app->getPaths().cacheDirectory())
+            .store(data->getHash(), bytes,
+                   NetworkCache::entryFromHeaders(
+                       headers, QDateTime::currentDateTime()));
+    });
+}
 
-        if (cachedFile.open(QIODevice::WriteOnly))
+void NetworkTask::loadRevalidated() const
+{
+    std::ignore = QtConcurrent::run([data = this->data_,
+                                     headers = this->reply_->rawHeaderPairs()] {
+        auto *app = tryGetApp();
+        if (isAppAboutToQuit() || !app)
         {
-            cachedFile.write(bytes);
+            return;
         }
+
+        auto &cache =
+            NetworkCache::forDirectory(app->getPaths().cacheDirectory());
+        auto bytes = cache.read(data->getHash());
+        if (!bytes)
+        {
+            // The file was removed since we sent the request
+            data->emitError(
+                {NetworkResult::NetworkError::UnknownContentError,
+                 QVariant(304), {}});
+            data->emitFinally();
+            return;
+        }
+
+        cache.revalidated(data->getHash(),
+                          NetworkCache::entryFromHeaders(
+                              headers, QDateTime::currentDateTime()));
+
+        DebugCount::increase(DebugObject::HTTPCacheRevalidated);
+        data->emitSuccess(
+            {NetworkResult::NetworkError::NoError, QVariant(200), *bytes});
+        data->emitFinally();
     });
 }
 
@@ -194,7 +227,12 @@ void NetworkTask::timeout()
         << this->data_->typeString() << "[timed out]"
         << this->data_->request.url().toString();
 
-    this->data_->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
+    NetworkResult result(NetworkResult::NetworkError::TimeoutError, {}, {});
+    if (!this->data_->handleResponse(result))
+    {
+        return;
+    }
+    this->data_->emitError(std::move(result));
     this->data_->emitFinally();
 }
 
@@ -212,22 +250,43 @@ void NetworkTask::finished()
 
     if (reply->error() == QNetworkReply::OperationCanceledError)
     {
-        // Operation cancelled, most likely timed out
+        // Operation cancelled (timeouts disconnect this slot first). The
+        // scheduler still has to learn that the request is done.
         qCDebug(chatterinoHTTP).noquote()
             << this->data_->typeString() << "[cancelled]"
             << this->data_->request.url().toString();
+        NetworkResult result(reply->error(), status, {});
+        if (!this->data_->handleResponse(result))
+        {
+            return;
+        }
+        this->data_->emitError(std::move(result));
+        this->data_->emitFinally();
         return;
     }
 
     if (reply->error() != QNetworkReply::NoError)
     {
         this->logReply();
-        this->data_->emitError({reply->error(), status, reply->readAll()});
+        NetworkResult result(reply->error(), status, reply->readAll());
+        result.setRawHeaders(reply->rawHeaderPairs());
+        if (!this->data_->handleResponse(result))
+        {
+            return;
+        }
+        this->data_->emitError(std::move(result));
         this->data_->emitFinally();
 
         return;
     }
 
+    if (this->data_->revalidatingCache && status.toInt() == 304)
+    {
+        this->logReply();
+        this->loadRevalidated();
+        return;
+    }
+
     QByteArray bytes = reply->readAll();
 
     if (this->data_->cache)
@@ -237,7 +296,13 @@ void NetworkTask::finished()
 
     DebugCount::increase(DebugObject::HTTPRequestSuccess);
     this->logReply();
-    this->data_->emitSuccess({reply->error(), status, bytes});
+    NetworkResult result(reply->error(), status, bytes);
+    result.setRawHeaders(reply->rawHeaderPairs());
+    if (!this->data_->handleResponse(result))
+    {
+        return;
+    }
+    this->data_->emitSuccess(std::move(result));
     this->data_->emitFinally();
 }
 
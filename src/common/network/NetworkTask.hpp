@@ -41,6 +41,8 @@ private:
 
     void logReply();
     void writeToCache(const QByteArray &bytes) const;
+    /// Answers a 304 response from the cache
+    void loadRevalidated() const;
 
     std::shared_ptr<NetworkData> data_;
     QNetworkReply *reply_{};  // parent: default (accessManager)
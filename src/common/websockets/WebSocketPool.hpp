@@ -8,6 +8,8 @@
 #include <QString>
 #include <QUrl>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 namespace chatterino::ws::detail {
@@ -71,9 +73,44 @@ struct WebSocketListener {
     virtual void onClose(std::unique_ptr<WebSocketListener> self) = 0;
 };
 
+/// Options for the permessage-deflate extension (RFC 7692).
+struct WebSocketCompression {
+    /// Offer permessage-deflate in the handshake. If the server doesn't
+    /// accept it, messages are sent uncompressed.
+    bool enabled = false;
+    /// Compress messages we send with the context of the previous ones. This
+    /// compresses similar messages better, but keeps a compressor alive for
+    /// the whole connection.
+    bool clientContextTakeover = true;
+    /// Ask the server to compress its messages with the context of the
+    /// previous ones.
+    bool serverContextTakeover = true;
+    /// Base-two logarithm of the window used for messages we send (9-15).
+    int clientMaxWindowBits = 15;
+    /// Base-two logarithm of the window the server may use (9-15).
+    int serverMaxWindowBits = 15;
+};
+
+/// Traffic of one or more connections.
+///
+/// The counters are updated from the websocket thread.
+struct WebSocketTraffic {
+    /// Bytes read from the socket (compressed and encrypted)
+    std::atomic<uint64_t> bytesIn{0};
+    /// Bytes written to the socket (compressed and encrypted)
+    std::atomic<uint64_t> bytesOut{0};
+    /// Bytes of received message payloads
+    std::atomic<uint64_t> messageBytesIn{0};
+    /// Bytes of sent message payloads
+    std::atomic<uint64_t> messageBytesOut{0};
+};
+
 struct WebSocketOptions {
     QUrl url;
     std::vector<std::pair<std::string, std::string>> headers;
+    WebSocketCompression compression{};
+    /// If set, the traffic of the connection is added to this
+    std::shared_ptr<WebSocketTraffic> traffic{};
 };
 
 class WebSocketPool
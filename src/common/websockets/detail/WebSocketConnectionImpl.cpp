@@ -29,6 +29,8 @@ WebSocketConnectionHelper<Derived, Inner>::WebSocketConnectionHelper(
                           ioc)
     , stream(std::move(stream))
 {
+    beast::get_lowest_layer(this->stream).rate_policy().traffic =
+        this->options.traffic;
 }
 
 template <typename Derived, typename Inner>
@@ -168,6 +170,17 @@ void WebSocketConnectionHelper<Derived, Inner>::doWsHandshake()
     beast::get_lowest_layer(this->stream).expires_never();
     this->stream.set_option(beast::websocket::stream_base::timeout::suggested(
         beast::role_type::client));
+    if (this->options.compression.enabled)
+    {
+        const auto &compression = this->options.compression;
+        beast::websocket::permessage_deflate pmd;
+        pmd.client_enable = true;
+        pmd.client_no_context_takeover = !compression.clientContextTakeover;
+        pmd.server_no_context_takeover = !compression.serverContextTakeover;
+        pmd.client_max_window_bits = compression.clientMaxWindowBits;
+        pmd.server_max_window_bits = compression.serverMaxWindowBits;
+        this->stream.set_option(pmd);
+    }
     this->stream.set_option(beast::websocket::stream_base::decorator{
         [this](beast::websocket::request_type &req) {
             bool hasUa = false;
@@ -269,6 +282,11 @@ void WebSocketConnectionHelper<Derived, Inner>::onReadDone(
         static_cast<QByteArray::size_type>(bytesRead),
     };
     this->readBuffer.consume(bytesRead);
+    if (this->options.traffic)
+    {
+        this->options.traffic->messageBytesIn.fetch_add(
+            bytesRead, std::memory_order::relaxed);
+    }
 
     if (this->stream.got_text())
     {
@@ -287,8 +305,14 @@ void WebSocketConnectionHelper<Derived, Inner>::onReadDone(
 
 template <typename Derived, typename Inner>
 void WebSocketConnectionHelper<Derived, Inner>::onWriteDone(
-    boost::system::error_code ec, size_t /*bytesWritten*/)
+    boost::system::error_code ec, size_t bytesWritten)
 {
+    if (this->options.traffic)
+    {
+        this->options.traffic->messageBytesOut.fetch_add(
+            bytesWritten, std::memory_order::relaxed);
+    }
+
     if (!this->queuedMessages.empty())
     {
         this->queuedMessages.pop_front();
@@ -9,11 +9,63 @@
 
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/stream.hpp>
-#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/core/basic_stream.hpp>
+#include <boost/beast/core/rate_policy.hpp>
 #include <boost/beast/websocket/stream.hpp>
 
+#include <limits>
+
 namespace chatterino::ws::detail {
 
+/// A rate policy for `beast::basic_stream` that doesn't limit the rate but
+/// counts the bytes read from and written to the socket.
+///
+/// The method names are given by Beast.
+class TrafficRatePolicy
+{
+public:
+    /// Nullable
+    std::shared_ptr<WebSocketTraffic> traffic;
+
+private:
+    friend class boost::beast::rate_policy_access;
+
+    static constexpr size_t ALL = std::numeric_limits<size_t>::max();
+
+    size_t available_read_bytes() const noexcept
+    {
+        return ALL;
+    }
+    size_t available_write_bytes() const noexcept
+    {
+        return ALL;
+    }
+
+    void transfer_read_bytes(size_t n) const noexcept
+    {
+        if (this->traffic)
+        {
+            this->traffic->bytesIn.fetch_add(n, std::memory_order::relaxed);
+        }
+    }
+    void transfer_write_bytes(size_t n) const noexcept
+    {
+        if (this->traffic)
+        {
+            this->traffic->bytesOut.fetch_add(n, std::memory_order::relaxed);
+        }
+    }
+
+    void on_timer() const noexcept
+    {
+    }
+};
+
+/// A TCP stream like `beast::tcp_stream` that counts its traffic.
+using TrafficTcpStream =
+    boost::beast::basic_stream<boost::asio::ip::tcp,
+                               boost::asio::any_io_executor, TrafficRatePolicy>;
+
 /// A CRTP helper to share code between the TLS and TCP connections.
 ///
 /// `Derived` must have a `void afterTcpHandshake()` method, which is called if
@@ -91,7 +143,7 @@ private:
 class TlsWebSocketConnection
     : public WebSocketConnectionHelper<
           TlsWebSocketConnection,
-          boost::asio::ssl::stream<boost::beast::tcp_stream>>
+          boost::asio::ssl::stream<TrafficTcpStream>>
 {
 public:
     static constexpr int DEFAULT_PORT = 443;
@@ -108,13 +160,13 @@ protected:
 
     friend WebSocketConnectionHelper<
         TlsWebSocketConnection,
-        boost::asio::ssl::stream<boost::beast::tcp_stream>>;
+        boost::asio::ssl::stream<TrafficTcpStream>>;
 };
 
 /// A WebSocket connection over TCP (ws://).
 class TcpWebSocketConnection
     : public WebSocketConnectionHelper<TcpWebSocketConnection,
-                                       boost::beast::tcp_stream>
+                                       TrafficTcpStream>
 {
 public:
     static constexpr int DEFAULT_PORT = 80;
@@ -128,7 +180,7 @@ protected:
     void afterTcpHandshake();
 
     friend WebSocketConnectionHelper<TcpWebSocketConnection,
-                                     boost::beast::tcp_stream>;
+                                     TrafficTcpStream>;
 };
 
 }  // namespace chatterino::ws::detail
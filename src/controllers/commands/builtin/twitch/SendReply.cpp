@@ -37,8 +37,8 @@ QString sendReply(const CommandContext &ctx)
     QString username = ctx.words[1];
     stripChannelName(username);
 
-    auto snapshot = ctx.twitchChannel->getMessageSnapshot();
-    for (const auto &msg : snapshot | std::views::reverse)
+    auto userMessages = ctx.twitchChannel->findMessagesByUser(username);
+    for (const auto &msg : userMessages | std::views::reverse)
     {
         if (msg->loginName.compare(username, Qt::CaseInsensitive) == 0)
         {
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <vector>
+
+namespace chatterino::completion {
+
+/// @brief Keeps the items that matched the last query of a source, so that a
+/// query extending it (i.e. while the user is typing) only has to look at
+/// those instead of all items.
+///
+/// Queries are reduced to a "core" by the source. A strategy must only return
+/// items whose core matches, and an item that matches a core must also match
+/// every prefix of it.
+/// @tparam T Type of items to consider
+template <typename T>
+class CandidateCache
+{
+public:
+    /// @brief Returns the items that match `core`.
+    /// @param items All items. Must be the same for every call.
+    /// @param core Core of the query
+    /// @param matches Predicate `bool(const T &, const QString &core)`
+    template <typename Matches>
+    const std::vector<T> &update(const std::vector<T> &items,
+                                 const QString &core, Matches matches)
+    {
+        bool narrow = this->valid_ && core.startsWith(this->core_);
+        if (narrow && core.size() == this->core_.size())
+        {
+            return this->candidates_;
+        }
+
+        std::vector<T> next;
+        for (const auto &item : narrow ? this->candidates_ : items)
+        {
+            if (matches(item, core))
+            {
+                next.push_back(item);
+            }
+        }
+
+        this->candidates_ = std::move(next);
+        this->core_ = core;
+        this->valid_ = true;
+        return this->candidates_;
+    }
+
+private:
+    std::vector<T> candidates_;
+    QString core_;
+    bool valid_ = false;
+};
+
+}  // namespace chatterino::completion
@@ -52,6 +52,103 @@ void addEmojis(std::vector<EmoteItem> &out, const std::vector<EmojiPtr> &map)
     };
 }
 
+/// Emote maps (with their provider name) and emojis the items of a channel
+/// are built from. Maps that aren't available are null.
+struct ItemSources {
+    std::vector<std::pair<std::shared_ptr<const EmoteMap>, QString>> maps;
+    const std::vector<EmojiPtr> *emojis = nullptr;
+};
+
+/// Items built from a set of emote maps.
+///
+/// Emote maps are replaced instead of modified, so the items can be reused
+/// as long as all maps are the same. Only weak references are kept: the
+/// items are freed together with the last source using them.
+struct CachedItems {
+    std::vector<std::pair<std::weak_ptr<const EmoteMap>, QString>> maps;
+    const std::vector<EmojiPtr> *emojis = nullptr;
+    std::weak_ptr<const std::vector<EmoteItem>> items;
+
+    bool builtFrom(const ItemSources &sources) const
+    {
+        if (this->emojis != sources.emojis ||
+            this->maps.size() != sources.maps.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < this->maps.size(); i++)
+        {
+            const auto &[cached, cachedProvider] = this->maps[i];
+            const auto &[map, provider] = sources.maps[i];
+            // compares the control blocks, so an expired map never equals
+            // a new one
+            bool sameMap =
+                !cached.owner_before(map) && !map.owner_before(cached);
+            if (!sameMap || cachedProvider != provider)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+std::shared_ptr<const std::vector<EmoteItem>> buildItems(
+    const ItemSources &sources)
+{
+    // Only accessed from the GUI thread
+    static std::vector<CachedItems> cache;
+
+    std::erase_if(cache, [](const auto &entry) {
+        return entry.items.expired();
+    });
+    for (const auto &entry : cache)
+    {
+        if (entry.builtFrom(sources))
+        {
+            if (auto items = entry.items.lock())
+            {
+                return items;
+            }
+        }
+    }
+
+    auto items = std::make_shared<std::vector<EmoteItem>>();
+    CachedItems entry{.emojis = sources.emojis, .items = items};
+    for (const auto &[map, provider] : sources.maps)
+    {
+        if (map)
+        {
+            addEmotes(*items, *map, provider);
+        }
+        entry.maps.emplace_back(map, provider);
+    }
+    if (sources.emojis)
+    {
+        addEmojis(*items, *sources.emojis);
+    }
+
+    cache.push_back(std::move(entry));
+    return items;
+}
+
+/// Removes the prefixes the strategies ignore when matching. Every item a
+/// strategy returns contains the rest of the query (case-insensitively).
+QString queryCore(const QString &query)
+{
+    QStringView core = query;
+    if (core.startsWith(u':'))
+    {
+        core = core.sliced(1);
+    }
+    if (core.startsWith(u'~'))
+    {
+        core = core.sliced(1);
+    }
+    return core.toString();
+}
+
 }  // namespace
 
 EmoteSource::EmoteSource(const Channel *channel,
@@ -68,7 +165,12 @@ void EmoteSource::update(const QString &query)
     this->output_.clear();
     if (this->strategy_)
     {
-        this->strategy_->apply(this->items_, this->output_, query);
+        const auto &candidates = this->candidates_.update(
+            *this->items_, queryCore(query),
+            [](const EmoteItem &item, const QString &core) {
+                return item.searchName.contains(core, Qt::CaseInsensitive);
+            });
+        this->strategy_->apply(candidates, this->output_, query);
     }
 }
 
@@ -94,53 +196,36 @@ void EmoteSource::initializeFromChannel(const Channel *channel)
 {
     auto *app = getApp();
 
-    std::vector<EmoteItem> emotes;
+    ItemSources sources;
     const auto *tc = dynamic_cast<const TwitchChannel *>(channel);
     // returns true also for special Twitch channels (/live, /mentions, /whispers, etc.)
     if (channel->isTwitchChannel())
     {
         if (tc)
         {
-            if (auto twitch = tc->localTwitchEmotes())
-            {
-                addEmotes(emotes, *twitch, "Local Twitch Emotes");
-            }
+            sources.maps.emplace_back(tc->localTwitchEmotes(),
+                                      "Local Twitch Emotes");
 
             auto user = getApp()->getAccounts()->twitch.getCurrent();
-            addEmotes(emotes, **user->accessEmotes(), "Twitch Emote");
+            sources.maps.emplace_back(*user->accessEmotes(), "Twitch Emote");
 
             // TODO extract "Channel {BetterTTV,7TV,FrankerFaceZ}" text into a #define.
-            if (auto bttv = tc->bttvEmotes())
-            {
-                addEmotes(emotes, *bttv, "Channel BetterTTV");
-            }
-            if (auto ffz = tc->ffzEmotes())
-            {
-                addEmotes(emotes, *ffz, "Channel FrankerFaceZ");
-            }
-            if (auto seventv = tc->seventvEmotes())
-            {
-                addEmotes(emotes, *seventv, "Channel 7TV");
-            }
+            sources.maps.emplace_back(tc->bttvEmotes(), "Channel BetterTTV");
+            sources.maps.emplace_back(tc->ffzEmotes(), "Channel FrankerFaceZ");
+            sources.maps.emplace_back(tc->seventvEmotes(), "Channel 7TV");
         }
 
-        if (auto bttvG = app->getBttvEmotes()->emotes())
-        {
-            addEmotes(emotes, *bttvG, "Global BetterTTV");
-        }
-        if (auto ffzG = app->getFfzEmotes()->emotes())
-        {
-            addEmotes(emotes, *ffzG, "Global FrankerFaceZ");
-        }
-        if (auto seventvG = app->getSeventvEmotes()->globalEmotes())
-        {
-            addEmotes(emotes, *seventvG, "Global 7TV");
-        }
+        sources.maps.emplace_back(app->getBttvEmotes()->emotes(),
+                                  "Global BetterTTV");
+        sources.maps.emplace_back(app->getFfzEmotes()->emotes(),
+                                  "Global FrankerFaceZ");
+        sources.maps.emplace_back(app->getSeventvEmotes()->globalEmotes(),
+                                  "Global 7TV");
     }
 
-    addEmojis(emotes, app->getEmotes()->getEmojis()->getEmojis());
+    sources.emojis = &app->getEmotes()->getEmojis()->getEmojis();
 
-    this->items_ = std::move(emotes);
+    this->items_ = buildItems(sources);
 }
 
 const std::vector<EmoteItem> &EmoteSource::output() const
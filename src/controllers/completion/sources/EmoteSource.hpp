@@ -5,6 +5,7 @@
 #pragma once
 
 #include "common/Channel.hpp"
+#include "controllers/completion/sources/CandidateCache.hpp"
 #include "controllers/completion/sources/Source.hpp"
 #include "controllers/completion/strategies/Strategy.hpp"
 #include "messages/Emote.hpp"
@@ -60,7 +61,9 @@ private:
     std::unique_ptr<EmoteStrategy> strategy_;
     ActionCallback callback_;
 
-    std::vector<EmoteItem> items_{};
+    /// Shared with other sources built from the same emote maps
+    std::shared_ptr<const std::vector<EmoteItem>> items_;
+    CandidateCache<EmoteItem> candidates_;
     std::vector<EmoteItem> output_{};
 };
 
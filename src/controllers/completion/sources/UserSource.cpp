@@ -27,7 +27,18 @@ void UserSource::update(const QString &query)
     this->output_.clear();
     if (this->strategy_)
     {
-        this->strategy_->apply(this->items_, this->output_, query);
+        // Every user a strategy returns contains the query without the @
+        QString core = query.toLower();
+        if (core.startsWith('@'))
+        {
+            core = core.mid(1);
+        }
+
+        const auto &candidates = this->candidates_.update(
+            this->items_, core, [](const UserItem &item, const QString &core) {
+                return item.first.contains(core);
+            });
+        this->strategy_->apply(candidates, this->output_, query);
     }
 }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "common/Channel.hpp"
+#include "controllers/completion/sources/CandidateCache.hpp"
 #include "controllers/completion/sources/Source.hpp"
 #include "controllers/completion/strategies/Strategy.hpp"
 
@@ -51,6 +52,7 @@ private:
     bool prependAt_;
 
     std::vector<UserItem> items_{};
+    CandidateCache<UserItem> candidates_;
     std::vector<UserItem> output_{};
 };
 
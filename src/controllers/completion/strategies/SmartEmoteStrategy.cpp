@@ -76,7 +76,8 @@ int costOfEmote(QStringView query, QStringView emote, bool prioritizeUpper)
 void completeEmotes(
     const std::vector<EmoteItem> &items, std::vector<EmoteItem> &output,
     QStringView query, bool ignoreColonForCost, bool ignoreTildeForCost,
-    const std::function<bool(EmoteItem, Qt::CaseSensitivity)> &matchingFunction)
+    const std::function<bool(const EmoteItem &, Qt::CaseSensitivity)>
+        &matchingFunction)
 {
     // Given these emotes: pajaW, PAJAW
     // There are a few cases of input:
@@ -135,39 +136,52 @@ void completeEmotes(
         }
     }
 
-    std::sort(output.begin(), output.end(),
-              [query, prioritizeUpper, ignoreColonForCost, ignoreTildeForCost](
-                  const EmoteItem &a, const EmoteItem &b) -> bool {
-                  auto tempA = a.searchName;
-                  auto tempB = b.searchName;
-                  if (ignoreColonForCost && tempA.startsWith(":"))
-                  {
-                      tempA = tempA.mid(1);
-                  }
-                  if (ignoreTildeForCost && tempA.startsWith("~"))
-                  {
-                      tempA = tempA.mid(1);
-                  }
-                  if (ignoreColonForCost && tempB.startsWith(":"))
-                  {
-                      tempB = tempB.mid(1);
-                  }
-                  if (ignoreTildeForCost && tempB.startsWith("~"))
-                  {
-                      tempB = tempB.mid(1);
-                  }
+    struct Ranked {
+        /// Search name without the prefixes that are ignored for the cost
+        QStringView name;
+        int cost;
+        size_t index;
+    };
+
+    // Compute the cost of each item once instead of in every comparison
+    std::vector<Ranked> ranked;
+    ranked.reserve(output.size());
+    for (size_t i = 0; i < output.size(); i++)
+    {
+        QStringView name = output[i].searchName;
+        if (ignoreColonForCost && name.startsWith(u':'))
+        {
+            name = name.sliced(1);
+        }
+        if (ignoreTildeForCost && name.startsWith(u'~'))
+        {
+            name = name.sliced(1);
+        }
+        ranked.push_back({
+            .name = name,
+            .cost = costOfEmote(query, name, prioritizeUpper),
+            .index = i,
+        });
+    }
 
-                  auto costA = costOfEmote(query, tempA, prioritizeUpper);
-                  auto costB = costOfEmote(query, tempB, prioritizeUpper);
-                  if (costA == costB)
+    std::sort(ranked.begin(), ranked.end(),
+              [](const Ranked &a, const Ranked &b) -> bool {
+                  if (a.cost == b.cost)
                   {
                       // Case difference and length came up tied for (a, b), break the tie
-                      return QString::compare(tempA, tempB,
-                                              Qt::CaseInsensitive) < 0;
+                      return a.name.compare(b.name, Qt::CaseInsensitive) < 0;
                   }
 
-                  return costA < costB;
+                  return a.cost < b.cost;
               });
+
+    std::vector<EmoteItem> sorted;
+    sorted.reserve(output.size());
+    for (const auto &item : ranked)
+    {
+        sorted.push_back(std::move(output[item.index]));
+    }
+    output = std::move(sorted);
 }
 }  // namespace
 
@@ -176,7 +190,6 @@ void SmartEmoteStrategy::apply(const std::vector<EmoteItem> &items,
                                const QString &query) const
 {
     qCDebug(LOG) << "SmartEmoteStrategy apply" << query;
-    std::vector<EmoteItem> filteredItems = items;
     QString normalizedQuery = query;
     bool ignoreColonForCost = false;
     bool zeroWidthOnly = false;
@@ -189,18 +202,17 @@ void SmartEmoteStrategy::apply(const std::vector<EmoteItem> &items,
     {
         normalizedQuery = normalizedQuery.mid(1);
         zeroWidthOnly = true;
-
-        auto [first, last] = std::ranges::remove_if(
-            filteredItems, [](const EmoteItem &emoteItem) {
-                return !emoteItem.emote->zeroWidth;
-            });
-        filteredItems.erase(first, last);
     }
 
-    completeEmotes(filteredItems, output, normalizedQuery, ignoreColonForCost,
+    completeEmotes(items, output, normalizedQuery, ignoreColonForCost,
                    zeroWidthOnly,
-                   [normalizedQuery](const EmoteItem &left,
-                                     Qt::CaseSensitivity caseHandling) {
+                   [normalizedQuery, zeroWidthOnly](
+                       const EmoteItem &left,
+                       Qt::CaseSensitivity caseHandling) {
+                       if (zeroWidthOnly && !left.emote->zeroWidth)
+                       {
+                           return false;
+                       }
                        return left.searchName.contains(normalizedQuery,
                                                        caseHandling);
                    });
@@ -65,7 +65,7 @@ bool FilterRecord::valid() const
 bool FilterRecord::filter(filters::RunContext context) const
 {
     assert(this->valid());
-    return this->filter_->execute(context).toBool();
+    return this->filter_->matches(context);
 }
 
 bool FilterRecord::operator==(const FilterRecord &other) const
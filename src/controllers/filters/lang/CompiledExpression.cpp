@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
+#include "messages/Message.hpp"
+
+namespace {
+
+using namespace chatterino;
+using namespace chatterino::filters;
+
+/// Walking the expression tree boxes every intermediate value, so make sure
+/// it's always evaluated last.
+constexpr int INTERPRETED_COST = 32;
+
+/// Context used to evaluate constant expressions at compile time
+RunContext constantContext()
+{
+    static const Message message;
+    return {
+        .message = message,
+        .channel = nullptr,
+    };
+}
+
+}  // namespace
+
+namespace chatterino::filters {
+
+CompiledExpression CompiledExpression::fromConstant(const QVariant &value,
+                                                    Type type)
+{
+    auto evaluator = [&]() -> AnyEvaluator {
+        switch (type)
+        {
+            case Type::Bool:
+                return Evaluator<bool>{[v = value.toBool()](RunContext) {
+                    return v;
+                }};
+            case Type::Int:
+                return Evaluator<int>{[v = value.toInt()](RunContext) {
+                    return v;
+                }};
+            case Type::String:
+                return Evaluator<QString>{[v = value.toString()](RunContext) {
+                    return v;
+                }};
+            case Type::StringList:
+                return Evaluator<QStringList>{
+                    [v = value.toStringList()](RunContext) {
+                        return v;
+                    }};
+            default:
+                return Evaluator<QVariant>{[value](RunContext) {
+                    return value;
+                }};
+        }
+    }();
+
+    return {
+        .type = type,
+        .evaluator = std::move(evaluator),
+        .cost = 0,
+        .constant = value,
+    };
+}
+
+CompiledExpression CompiledExpression::interpreted(const Expression *expression,
+                                                   Type type)
+{
+    auto evaluator = [&]() -> AnyEvaluator {
+        switch (type)
+        {
+            case Type::Bool:
+                return Evaluator<bool>{[expression](RunContext ctx) {
+                    return expression->execute(ctx).toBool();
+                }};
+            case Type::Int:
+                return Evaluator<int>{[expression](RunContext ctx) {
+                    return expression->execute(ctx).toInt();
+                }};
+            case Type::String:
+                return Evaluator<QString>{[expression](RunContext ctx) {
+                    return expression->execute(ctx).toString();
+                }};
+            case Type::StringList:
+                return Evaluator<QStringList>{[expression](RunContext ctx) {
+                    return expression->execute(ctx).toStringList();
+                }};
+            default:
+                return Evaluator<QVariant>{[expression](RunContext ctx) {
+                    return expression->execute(ctx);
+                }};
+        }
+    }();
+
+    return {
+        .type = type,
+        .evaluator = std::move(evaluator),
+        .cost = INTERPRETED_COST,
+        .constant = std::nullopt,
+    };
+}
+
+CompiledExpression CompiledExpression::fold(
+    const CompiledExpression &expression)
+{
+    return fromConstant(expression.evaluate(constantContext()),
+                        expression.type);
+}
+
+QVariant CompiledExpression::evaluate(RunContext context) const
+{
+    return std::visit(
+        [&](const auto &fn) -> QVariant {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(fn)>,
+                                         Evaluator<QVariant>>)
+            {
+                return fn(context);
+            }
+            else
+            {
+                return QVariant::fromValue(fn(context));
+            }
+        },
+        this->evaluator);
+}
+
+}  // namespace chatterino::filters
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "controllers/filters/lang/expressions/Expression.hpp"
+#include "controllers/filters/lang/Types.hpp"
+
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+
+#include <functional>
+#include <optional>
+#include <variant>
+
+namespace chatterino::filters {
+
+template <typename T>
+using Evaluator = std::function<T(RunContext)>;
+
+/// An expression lowered to a closure that returns an unboxed value.
+///
+/// Bool, Int, String and StringList expressions are evaluated without going
+/// through QVariant. Colors, regular expressions and mixed lists stay boxed.
+/// Expressions whose result doesn't depend on the message are folded into a
+/// constant when they're compiled.
+struct CompiledExpression {
+    using AnyEvaluator =
+        std::variant<Evaluator<bool>, Evaluator<int>, Evaluator<QString>,
+                     Evaluator<QStringList>, Evaluator<QVariant>>;
+
+    Type type;
+    AnyEvaluator evaluator;
+
+    /// Rough estimate of how expensive evaluating this expression is.
+    /// Used to evaluate the cheaper operand of `&&` and `||` first.
+    int cost = 0;
+
+    /// Set if this expression evaluates to the same value for every message
+    std::optional<QVariant> constant;
+
+    /// Creates an expression that always evaluates to `value`
+    static CompiledExpression fromConstant(const QVariant &value, Type type);
+
+    /// Creates an expression that falls back to the tree-walking interpreter
+    /// (Expression::execute). `expression` must outlive the returned value.
+    static CompiledExpression interpreted(const Expression *expression,
+                                          Type type);
+
+    /// Evaluates `expression` once and turns the result into a constant.
+    /// `expression` must not depend on the message or channel.
+    static CompiledExpression fold(const CompiledExpression &expression);
+
+    template <typename T>
+    static CompiledExpression typed(Type type, Evaluator<T> evaluator,
+                                    int cost)
+    {
+        return {
+            .type = type,
+            .evaluator = std::move(evaluator),
+            .cost = cost,
+            .constant = std::nullopt,
+        };
+    }
+
+    bool isConstant() const
+    {
+        return this->constant.has_value();
+    }
+
+    /// Returns the unboxed evaluator. `T` must match `type`
+    /// (e.g. `bool` for Type::Bool).
+    template <typename T>
+    const Evaluator<T> &get() const
+    {
+        return std::get<Evaluator<T>>(this->evaluator);
+    }
+
+    /// Evaluates the expression and boxes the result like
+    /// Expression::execute would
+    QVariant evaluate(RunContext context) const;
+};
+
+}  // namespace chatterino::filters
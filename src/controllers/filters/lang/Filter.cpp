@@ -25,6 +25,7 @@ FilterResult Filter::fromString(const QString &str)
 Filter::Filter(ExpressionPtr expression, Type returnType)
     : expression_(std::move(expression))
     , returnType_(returnType)
+    , compiled_(expression_->compile())
 {
 }
 
@@ -34,6 +35,20 @@ Type Filter::returnType() const
 }
 
 QVariant Filter::execute(RunContext context) const
+{
+    return this->compiled_.evaluate(context);
+}
+
+bool Filter::matches(RunContext context) const
+{
+    if (this->compiled_.type == Type::Bool)
+    {
+        return this->compiled_.get<bool>()(context);
+    }
+    return this->execute(context).toBool();
+}
+
+QVariant Filter::interpret(RunContext context) const
 {
     return this->expression_->execute(context);
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
 #include "controllers/filters/lang/expressions/Expression.hpp"
 #include "controllers/filters/lang/Types.hpp"
 
@@ -35,8 +36,18 @@ public:
     static FilterResult fromString(const QString &str);
 
     Type returnType() const;
+
+    /// Evaluates the compiled filter
     QVariant execute(RunContext context) const;
 
+    /// Evaluates the compiled filter as a boolean. This avoids boxing the
+    /// result for filters returning a Bool.
+    bool matches(RunContext context) const;
+
+    /// Evaluates the filter by walking the parsed expression tree.
+    /// This gives the same result as `execute` but is slower.
+    QVariant interpret(RunContext context) const;
+
     QString filterString() const;
     QString debugString() const;
 
@@ -45,6 +56,9 @@ private:
 
     ExpressionPtr expression_;
     Type returnType_;
+
+    /// Refers to nodes in `expression_`
+    CompiledExpression compiled_;
 };
 
 }  // namespace chatterino::filters
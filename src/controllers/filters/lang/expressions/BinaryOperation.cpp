@@ -4,10 +4,39 @@
 
 #include "controllers/filters/lang/expressions/BinaryOperation.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
 #include <QRegularExpression>
 
+#include <functional>
+#include <type_traits>
+
 namespace {
 
+using namespace chatterino::filters;
+
+/// Combines two typed operands with `op`. `L` and `R` are the unboxed types
+/// of the operands (e.g. `QString` for Type::String).
+template <typename L, typename R, typename Op>
+CompiledExpression combine(Type type, const CompiledExpression &left,
+                           const CompiledExpression &right, int cost, Op op)
+{
+    using Result = std::invoke_result_t<Op, L, R>;
+    return CompiledExpression::typed<Result>(
+        type,
+        [l = left.get<L>(), r = right.get<R>(), op](RunContext ctx) {
+            return op(l(ctx), r(ctx));
+        },
+        left.cost + right.cost + cost);
+}
+
+bool operandsAre(const CompiledExpression &left,
+                 const CompiledExpression &right, Type leftType,
+                 Type rightType)
+{
+    return left.type == leftType && right.type == rightType;
+}
+
 /// Loosely compares `lhs` with `rhs`.
 /// This attempts to convert both variants to a common type if they're not equal.
 bool looselyCompareVariants(QVariant &lhs, QVariant &rhs)
@@ -375,6 +404,289 @@ PossibleType BinaryOperation::synthesizeType() const
     }
 }
 
+CompiledExpression BinaryOperation::compile() const
+{
+    // Rough relative costs of the operations, see CompiledExpression::cost
+    constexpr int arithmeticCost = 1;
+    constexpr int compareStringCost = 2;
+    constexpr int searchStringCost = 4;
+    constexpr int regexCost = 16;
+
+    auto left = this->left_->compile();
+    auto right = this->right_->compile();
+    auto type = std::get<TypeClass>(this->synthesizeType()).type;
+
+    if ((this->op_ == DIVIDE || this->op_ == MOD) && right.isConstant() &&
+        right.constant->toInt() == 0)
+    {
+        // Don't divide by zero while compiling
+        return Expression::compile();
+    }
+
+    auto compiled = [&]() -> CompiledExpression {
+        switch (this->op_)
+        {
+            case PLUS:
+                if (operandsAre(left, right, Type::String, Type::String))
+                {
+                    return combine<QString, QString>(
+                        type, left, right, compareStringCost,
+                        [](const QString &a, const QString &b) {
+                            return a + b;
+                        });
+                }
+                if (operandsAre(left, right, Type::String, Type::Int))
+                {
+                    return combine<QString, int>(
+                        type, left, right, compareStringCost,
+                        [](const QString &a, int b) {
+                            return a + QString::number(b);
+                        });
+                }
+                if (operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    return combine<int, int>(type, left, right,
+                                             arithmeticCost, std::plus{});
+                }
+                break;
+            case MINUS:
+                if (operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    return combine<int, int>(type, left, right,
+                                             arithmeticCost, std::minus{});
+                }
+                break;
+            case MULTIPLY:
+                if (operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    return combine<int, int>(type, left, right,
+                                             arithmeticCost,
+                                             std::multiplies{});
+                }
+                break;
+            case DIVIDE:
+            case MOD:
+                if (operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    if (this->op_ == DIVIDE)
+                    {
+                        return combine<int, int>(type, left, right,
+                                                 arithmeticCost,
+                                                 std::divides{});
+                    }
+                    return combine<int, int>(type, left, right,
+                                             arithmeticCost, std::modulus{});
+                }
+                break;
+            case AND:
+            case OR: {
+                bool isAnd = this->op_ == AND;
+                if (left.isConstant() || right.isConstant())
+                {
+                    // `false && x` and `true || x` don't depend on x,
+                    // `true && x` and `false || x` are just x
+                    const auto &known = left.isConstant() ? left : right;
+                    const auto &other = left.isConstant() ? right : left;
+                    if (known.constant->toBool() != isAnd)
+                    {
+                        return CompiledExpression::fromConstant(!isAnd,
+                                                                Type::Bool);
+                    }
+                    return other;
+                }
+
+                // Operands have no side effects, so the cheaper one can be
+                // evaluated first to short-circuit the expensive one
+                const auto &first = left.cost <= right.cost ? left : right;
+                const auto &second = left.cost <= right.cost ? right : left;
+                if (isAnd)
+                {
+                    return CompiledExpression::typed<bool>(
+                        type,
+                        [a = first.get<bool>(),
+                         b = second.get<bool>()](RunContext ctx) {
+                            return a(ctx) && b(ctx);
+                        },
+                        first.cost + second.cost);
+                }
+                return CompiledExpression::typed<bool>(
+                    type,
+                    [a = first.get<bool>(),
+                     b = second.get<bool>()](RunContext ctx) {
+                        return a(ctx) || b(ctx);
+                    },
+                    first.cost + second.cost);
+            }
+            case EQ:
+            case NEQ: {
+                bool isEq = this->op_ == EQ;
+                if (operandsAre(left, right, Type::String, Type::String))
+                {
+                    return combine<QString, QString>(
+                        type, left, right, compareStringCost,
+                        [isEq](const QString &a, const QString &b) {
+                            return (a.compare(b, Qt::CaseInsensitive) == 0) ==
+                                   isEq;
+                        });
+                }
+                if (operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    return combine<int, int>(type, left, right,
+                                             arithmeticCost,
+                                             [isEq](int a, int b) {
+                                                 return (a == b) == isEq;
+                                             });
+                }
+                if (operandsAre(left, right, Type::Bool, Type::Bool))
+                {
+                    return combine<bool, bool>(type, left, right,
+                                               arithmeticCost,
+                                               [isEq](bool a, bool b) {
+                                                   return (a == b) == isEq;
+                                               });
+                }
+                // Mixed types need the loose QVariant comparison
+                break;
+            }
+            case LT:
+            case GT:
+            case LTE:
+            case GTE:
+                if (!operandsAre(left, right, Type::Int, Type::Int))
+                {
+                    break;
+                }
+                switch (this->op_)
+                {
+                    case LT:
+                        return combine<int, int>(type, left, right,
+                                                 arithmeticCost, std::less{});
+                    case GT:
+                        return combine<int, int>(type, left, right,
+                                                 arithmeticCost,
+                                                 std::greater{});
+                    case LTE:
+                        return combine<int, int>(type, left, right,
+                                                 arithmeticCost,
+                                                 std::less_equal{});
+                    default:
+                        return combine<int, int>(type, left, right,
+                                                 arithmeticCost,
+                                                 std::greater_equal{});
+                }
+            case CONTAINS:
+                if (operandsAre(left, right, Type::StringList, Type::String))
+                {
+                    return combine<QStringList, QString>(
+                        type, left, right, searchStringCost,
+                        [](const QStringList &list, const QString &s) {
+                            return list.contains(s, Qt::CaseInsensitive);
+                        });
+                }
+                if (operandsAre(left, right, Type::String, Type::String))
+                {
+                    return combine<QString, QString>(
+                        type, left, right, searchStringCost,
+                        [](const QString &a, const QString &b) {
+                            return a.contains(b, Qt::CaseInsensitive);
+                        });
+                }
+                break;
+            case STARTS_WITH:
+                if (operandsAre(left, right, Type::StringList, Type::String))
+                {
+                    return combine<QStringList, QString>(
+                        type, left, right, compareStringCost,
+                        [](const QStringList &list, const QString &s) {
+                            return !list.isEmpty() &&
+                                   list.first().compare(
+                                       s, Qt::CaseInsensitive) == 0;
+                        });
+                }
+                if (operandsAre(left, right, Type::String, Type::String))
+                {
+                    return combine<QString, QString>(
+                        type, left, right, compareStringCost,
+                        [](const QString &a, const QString &b) {
+                            return a.startsWith(b, Qt::CaseInsensitive);
+                        });
+                }
+                break;
+            case ENDS_WITH:
+                if (operandsAre(left, right, Type::StringList, Type::String))
+                {
+                    return combine<QStringList, QString>(
+                        type, left, right, compareStringCost,
+                        [](const QStringList &list, const QString &s) {
+                            return !list.isEmpty() &&
+                                   list.last().compare(
+                                       s, Qt::CaseInsensitive) == 0;
+                        });
+                }
+                if (operandsAre(left, right, Type::String, Type::String))
+                {
+                    return combine<QString, QString>(
+                        type, left, right, compareStringCost,
+                        [](const QString &a, const QString &b) {
+                            return a.endsWith(b, Qt::CaseInsensitive);
+                        });
+                }
+                break;
+            case MATCH: {
+                // Regular expressions are literals, so they're always
+                // constant and compiled ahead of time
+                if (left.type != Type::String || !right.isConstant())
+                {
+                    break;
+                }
+                const auto &value = *right.constant;
+                if (right.type == Type::RegularExpression)
+                {
+                    return CompiledExpression::typed<bool>(
+                        type,
+                        [fn = left.get<QString>(),
+                         regex = value.toRegularExpression()](RunContext ctx) {
+                            return regex.match(fn(ctx)).hasMatch();
+                        },
+                        left.cost + regexCost);
+                }
+
+                auto list = value.toList();
+                if (right.type != Type::MatchingSpecifier ||
+                    list.size() != 2 ||
+                    variantIsNot(list.at(0), QMetaType::QRegularExpression) ||
+                    variantIsNot(list.at(1), QMetaType::Int))
+                {
+                    break;
+                }
+                return CompiledExpression::typed<QString>(
+                    type,
+                    [fn = left.get<QString>(),
+                     regex = list.at(0).toRegularExpression(),
+                     group = list.at(1).toInt()](RunContext ctx) {
+                        auto match = regex.match(fn(ctx));
+                        if (match.hasMatch())
+                        {
+                            return match.captured(group);
+                        }
+                        return QString{};
+                    },
+                    left.cost + regexCost);
+            }
+            default:
+                break;
+        }
+
+        return Expression::compile();
+    }();
+
+    if (left.isConstant() && right.isConstant() && !compiled.isConstant())
+    {
+        return CompiledExpression::fold(compiled);
+    }
+    return compiled;
+}
+
 QString BinaryOperation::debug() const
 {
     return QString("BinaryOp[%1](%2 : %3, %4 : %5)")
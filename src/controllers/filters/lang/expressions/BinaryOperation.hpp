@@ -18,6 +18,7 @@ public:
     PossibleType synthesizeType() const override;
     QString debug() const override;
     QString filterString() const override;
+    CompiledExpression compile() const override;
 
 private:
     TokenType op_;
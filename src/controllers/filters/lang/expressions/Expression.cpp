@@ -4,6 +4,14 @@
 
 #include "controllers/filters/lang/expressions/Expression.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
 namespace chatterino::filters {
 
+CompiledExpression Expression::compile() const
+{
+    return CompiledExpression::interpreted(
+        this, std::get<TypeClass>(this->synthesizeType()).type);
+}
+
 }  // namespace chatterino::filters
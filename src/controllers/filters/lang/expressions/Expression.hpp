@@ -25,6 +25,8 @@ struct RunContext {
     Channel *channel;
 };
 
+struct CompiledExpression;
+
 class Expression
 {
 public:
@@ -34,6 +36,11 @@ public:
     virtual PossibleType synthesizeType() const = 0;
     virtual QString debug() const = 0;
     virtual QString filterString() const = 0;
+
+    /// Lowers this (well-typed) expression to typed closures.
+    /// The result may refer to this expression, so it must not outlive it.
+    /// By default, this falls back to `execute`.
+    virtual CompiledExpression compile() const;
 };
 
 using ExpressionPtr = std::unique_ptr<Expression>;
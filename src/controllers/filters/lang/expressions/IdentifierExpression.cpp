@@ -6,6 +6,7 @@
 
 #include "Application.hpp"
 #include "common/Channel.hpp"
+#include "controllers/filters/lang/CompiledExpression.hpp"
 #include "controllers/filters/lang/Types.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageFlag.hpp"
@@ -47,13 +48,38 @@ QVariant makeVariantFor(T &&v)
     return QVariant::fromValue(std::forward<typename Narrow<T>::Type>(v));
 }
 
+/// Wraps `fn` in an evaluator returning its unboxed result. Results that
+/// have no unboxed representation in compiled filters (e.g. `QColor`) are
+/// returned as a QVariant.
+template <typename Fn>
+CompiledExpression::AnyEvaluator makeEvaluator(Fn fn)
+{
+    using Result = typename Narrow<
+        std::remove_cvref_t<std::invoke_result_t<Fn, RunContext>>>::Type;
+    if constexpr (std::is_same_v<Result, bool> || std::is_same_v<Result, int> ||
+                  std::is_same_v<Result, QString> ||
+                  std::is_same_v<Result, QStringList>)
+    {
+        return Evaluator<Result>{[fn = std::move(fn)](RunContext ctx) {
+            return static_cast<Result>(fn(ctx));
+        }};
+    }
+    else
+    {
+        return Evaluator<QVariant>{[fn = std::move(fn)](RunContext ctx) {
+            return makeVariantFor(fn(ctx));
+        }};
+    }
+}
+
 struct Accessor {
     /// Create an accessor from a function. The function should not return a
     /// QVariant but the type that should be contained in it (e.g. `QString`).
     Accessor(std::invocable<RunContext> auto &&fn)
-        : fn([fn = std::forward<decltype(fn)>(fn)](RunContext ctx) {
+        : fn([fn](RunContext ctx) {
             return makeVariantFor(fn(ctx));
         })
+        , typed(makeEvaluator(std::forward<decltype(fn)>(fn)))
     {
     }
 
@@ -62,12 +88,34 @@ struct Accessor {
         : fn([](RunContext /* ctx */) {
             return false;
         })
+        , typed(Evaluator<bool>{[](RunContext /* ctx */) {
+            return false;
+        }})
     {
     }
 
     std::function<QVariant(RunContext)> fn;
+
+    /// Used by compiled filters
+    CompiledExpression::AnyEvaluator typed;
 };
 
+/// Rough cost of evaluating an accessor of the given type, see
+/// CompiledExpression::cost
+int accessorCost(Type type)
+{
+    switch (type)
+    {
+        case Type::Bool:
+        case Type::Int:
+            return 1;
+        case Type::StringList:
+            return 4;
+        default:
+            return 2;
+    }
+}
+
 struct IdentifierExpression final : public Expression {
     IdentifierExpression(QString name, std::optional<Type> type,
                          Accessor accessor)
@@ -102,6 +150,20 @@ struct IdentifierExpression final : public Expression {
         return this->accessor.fn(context);
     }
 
+    CompiledExpression compile() const override
+    {
+        if (!this->type)
+        {
+            return Expression::compile();
+        }
+        return {
+            .type = *this->type,
+            .evaluator = this->accessor.typed,
+            .cost = accessorCost(*this->type),
+            .constant = std::nullopt,
+        };
+    }
+
 private:
     QString name;
     std::optional<Type> type;
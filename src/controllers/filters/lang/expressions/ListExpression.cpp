@@ -4,6 +4,8 @@
 
 #include "controllers/filters/lang/expressions/ListExpression.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
 namespace chatterino::filters {
 
 ListExpression::ListExpression(ExpressionList &&list)
@@ -94,4 +96,50 @@ QString ListExpression::filterString() const
     return QString("{%1}").arg(strings.join(", "));
 }
 
+CompiledExpression ListExpression::compile() const
+{
+    std::vector<CompiledExpression> items;
+    items.reserve(this->list_.size());
+    bool allConstant = true;
+    for (const auto &exp : this->list_)
+    {
+        items.emplace_back(exp->compile());
+        allConstant = allConstant && items.back().isConstant();
+    }
+
+    auto type = std::get<TypeClass>(this->synthesizeType()).type;
+    if (allConstant)
+    {
+        // Lists like {"moderator", "vip"} or {r"(\d+)", 1} are built once
+        return CompiledExpression::fold(Expression::compile());
+    }
+
+    if (type != Type::StringList)
+    {
+        return Expression::compile();
+    }
+
+    std::vector<Evaluator<QString>> fns;
+    fns.reserve(items.size());
+    int cost = 0;
+    for (const auto &item : items)
+    {
+        fns.emplace_back(item.get<QString>());
+        cost += item.cost;
+    }
+
+    return CompiledExpression::typed<QStringList>(
+        type,
+        [fns = std::move(fns)](RunContext ctx) {
+            QStringList strings;
+            strings.reserve(static_cast<qsizetype>(fns.size()));
+            for (const auto &fn : fns)
+            {
+                strings.append(fn(ctx));
+            }
+            return strings;
+        },
+        cost);
+}
+
 }  // namespace chatterino::filters
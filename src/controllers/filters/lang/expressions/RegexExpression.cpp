@@ -4,6 +4,8 @@
 
 #include "controllers/filters/lang/expressions/RegexExpression.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
 namespace chatterino::filters {
 
 RegexExpression::RegexExpression(const QString &regex, bool caseInsensitive)
@@ -36,4 +38,13 @@ QString RegexExpression::filterString() const
         .arg(s.replace("\"", "\\\""));
 }
 
+CompiledExpression RegexExpression::compile() const
+{
+    // Compile the pattern now rather than on the first message it's matched
+    // against. Copies share the compiled pattern.
+    auto regex = this->regex_;
+    regex.optimize();
+    return CompiledExpression::fromConstant(regex, Type::RegularExpression);
+}
+
 }  // namespace chatterino::filters
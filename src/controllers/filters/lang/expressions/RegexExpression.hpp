@@ -20,6 +20,7 @@ public:
     PossibleType synthesizeType() const override;
     QString debug() const override;
     QString filterString() const override;
+    CompiledExpression compile() const override;
 
 private:
     QString regexString_;
@@ -4,6 +4,8 @@
 
 #include "controllers/filters/lang/expressions/UnaryOperation.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
+
 namespace chatterino::filters {
 
 UnaryOperation::UnaryOperation(TokenType op, ExpressionPtr right)
@@ -70,4 +72,26 @@ QString UnaryOperation::filterString() const
     return QString("(%1%2)").arg(opText).arg(this->right_->filterString());
 }
 
+CompiledExpression UnaryOperation::compile() const
+{
+    if (this->op_ != NOT)
+    {
+        return Expression::compile();
+    }
+
+    auto right = this->right_->compile();
+    auto compiled = CompiledExpression::typed<bool>(
+        Type::Bool,
+        [fn = right.get<bool>()](RunContext ctx) {
+            return !fn(ctx);
+        },
+        right.cost);
+
+    if (right.isConstant())
+    {
+        return CompiledExpression::fold(compiled);
+    }
+    return compiled;
+}
+
 }  // namespace chatterino::filters
@@ -4,6 +4,7 @@
 
 #include "controllers/filters/lang/expressions/ValueExpression.hpp"
 
+#include "controllers/filters/lang/CompiledExpression.hpp"
 #include "controllers/filters/lang/Tokenizer.hpp"
 
 namespace chatterino::filters {
@@ -56,4 +57,10 @@ QString ValueExpression::filterString() const
     }
 }
 
+CompiledExpression ValueExpression::compile() const
+{
+    return CompiledExpression::fromConstant(
+        this->value_, std::get<TypeClass>(this->synthesizeType()).type);
+}
+
 }  // namespace chatterino::filters
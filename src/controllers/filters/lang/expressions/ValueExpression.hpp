@@ -19,6 +19,7 @@ public:
     PossibleType synthesizeType() const override;
     QString debug() const override;
     QString filterString() const override;
+    CompiledExpression compile() const override;
 
 private:
     QVariant value_;
@@ -17,18 +17,137 @@
 #include "providers/twitch/TwitchAccount.hpp"  // IWYU pragma: keep
 #include "providers/twitch/TwitchBadge.hpp"
 #include "singletons/Settings.hpp"
+#include "util/PhraseMatcher.hpp"
 
 namespace {
 
 using namespace chatterino;
 
-auto highlightPhraseCheck(const HighlightPhrase &highlight) -> HighlightCheck
+/// Fills the parts of `result` that aren't set yet from `checkResult`.
+/// Earlier checks take precedence over later ones.
+void mergeHighlightResult(HighlightResult &result,
+                          const HighlightResult &checkResult)
 {
+    if (checkResult.alert)
+    {
+        if (!result.alert)
+        {
+            result.alert = checkResult.alert;
+        }
+    }
+
+    if (checkResult.playSound)
+    {
+        if (!result.playSound)
+        {
+            result.playSound = checkResult.playSound;
+        }
+    }
+
+    if (checkResult.customSoundUrl)
+    {
+        if (!result.customSoundUrl)
+        {
+            result.customSoundUrl = checkResult.customSoundUrl;
+        }
+    }
+
+    if (checkResult.color)
+    {
+        if (!result.color)
+        {
+            result.color = checkResult.color;
+        }
+    }
+
+    if (checkResult.showInMentions)
+    {
+        if (!result.showInMentions)
+        {
+            result.showInMentions = checkResult.showInMentions;
+        }
+    }
+}
+
+HighlightResult phraseResult(const HighlightPhrase &highlight)
+{
+    std::optional<QUrl> highlightSoundUrl;
+    if (highlight.hasCustomSound())
+    {
+        highlightSoundUrl = highlight.getSoundUrl();
+    }
+
+    return HighlightResult{
+        highlight.hasAlert(),       highlight.hasSound(),
+        highlightSoundUrl,          highlight.getColor(),
+        highlight.showInMentions(),
+    };
+}
+
+/// A list of highlight phrases that are checked together
+struct PhraseList {
+    explicit PhraseList(std::vector<HighlightPhrase> phrases)
+        : phrases(std::move(phrases))
+        , matcher([&] {
+            std::vector<PhraseMatcher::Phrase> patterns;
+            patterns.reserve(this->phrases.size());
+            for (const auto &phrase : this->phrases)
+            {
+                patterns.push_back({
+                    .pattern = phrase.getPattern(),
+                    .isRegex = phrase.isRegex(),
+                    .isCaseSensitive = phrase.isCaseSensitive(),
+                });
+            }
+            return PhraseMatcher(patterns);
+        }())
+    {
+    }
+
+    /// Merges the results of all phrases matching `subject` in order. This is
+    /// the same as checking each phrase on its own, but only the phrases the
+    /// matcher can't rule out are checked.
+    std::optional<HighlightResult> check(const QString &subject) const
+    {
+        std::optional<HighlightResult> result;
+        for (auto i : this->matcher.candidates(subject))
+        {
+            const auto &highlight = this->phrases[i];
+            if (!highlight.isMatch(subject))
+            {
+                continue;
+            }
+
+            if (!result)
+            {
+                result = phraseResult(highlight);
+            }
+            else
+            {
+                mergeHighlightResult(*result, phraseResult(highlight));
+            }
+
+            if (result->full())
+            {
+                break;
+            }
+        }
+        return result;
+    }
+
+    std::vector<HighlightPhrase> phrases;
+    PhraseMatcher matcher;
+};
+
+auto highlightPhrasesCheck(std::vector<HighlightPhrase> highlights)
+    -> HighlightCheck
+{
+    auto list = std::make_shared<const PhraseList>(std::move(highlights));
     return HighlightCheck{
-        [highlight](const auto &args, const auto &twitchBadges,
-                    const auto &senderName, const auto &originalMessage,
-                    const auto &flags,
-                    const auto self) -> std::optional<HighlightResult> {
+        [list](const auto &args, const auto &twitchBadges,
+               const auto &senderName, const auto &originalMessage,
+               const auto &flags,
+               const auto self) -> std::optional<HighlightResult> {
             (void)args;          // unused
             (void)twitchBadges;  // unused
             (void)senderName;    // unused
@@ -40,22 +159,7 @@ auto highlightPhraseCheck(const HighlightPhrase &highlight) -> HighlightCheck
                 return std::nullopt;
             }
 
-            if (!highlight.isMatch(originalMessage))
-            {
-                return std::nullopt;
-            }
-
-            std::optional<QUrl> highlightSoundUrl;
-            if (highlight.hasCustomSound())
-            {
-                highlightSoundUrl = highlight.getSoundUrl();
-            }
-
-            return HighlightResult{
-                highlight.hasAlert(),       highlight.hasSound(),
-                highlightSoundUrl,          highlight.getColor(),
-                highlight.showInMentions(),
-            };
+            return list->check(originalMessage);
         }};
 }
 
@@ -193,23 +297,26 @@ void rebuildMessageHighlights(Settings &settings,
     auto currentUser = getApp()->getAccounts()->twitch.getCurrent();
     QString currentUsername = currentUser->getUserName();
 
+    // The self highlight is checked before the user's own phrases
+    std::vector<HighlightPhrase> phrases;
     if (settings.enableSelfHighlight && !currentUsername.isEmpty() &&
         !currentUser->isAnon())
     {
-        HighlightPhrase highlight(
+        phrases.emplace_back(
             currentUsername, settings.showSelfHighlightInMentions,
             settings.enableSelfHighlightTaskbar,
             settings.enableSelfHighlightSound, false, false,
             settings.selfHighlightSoundUrl.getValue(),
             ColorProvider::instance().color(ColorType::SelfHighlight));
-
-        checks.emplace_back(highlightPhraseCheck(highlight));
     }
 
     auto messageHighlights = settings.highlightedMessages.readOnly();
-    for (const auto &highlight : *messageHighlights)
+    phrases.insert(phrases.end(), messageHighlights->begin(),
+                   messageHighlights->end());
+
+    if (!phrases.empty())
     {
-        checks.emplace_back(highlightPhraseCheck(highlight));
+        checks.emplace_back(highlightPhrasesCheck(std::move(phrases)));
     }
 
     if (settings.enableAutomodHighlight)
@@ -285,37 +392,21 @@ void rebuildUserHighlights(Settings &settings,
             }});
     }
 
-    for (const auto &highlight : *userHighlights)
+    if (!userHighlights->empty())
     {
+        auto list = std::make_shared<const PhraseList>(*userHighlights);
         checks.emplace_back(HighlightCheck{
-            [highlight](const auto &args, const auto &twitchBadges,
-                        const auto &senderName, const auto &originalMessage,
-                        const auto &flags,
-                        const auto self) -> std::optional<HighlightResult> {
+            [list](const auto &args, const auto &twitchBadges,
+                   const auto &senderName, const auto &originalMessage,
+                   const auto &flags,
+                   const auto self) -> std::optional<HighlightResult> {
                 (void)args;             // unused
                 (void)twitchBadges;     // unused
                 (void)originalMessage;  // unused
                 (void)flags;            // unused
                 (void)self;             // unused
 
-                if (!highlight.isMatch(senderName))
-                {
-                    return std::nullopt;
-                }
-
-                std::optional<QUrl> highlightSoundUrl;
-                if (highlight.hasCustomSound())
-                {
-                    highlightSoundUrl = highlight.getSoundUrl();
-                }
-
-                return HighlightResult{
-                    highlight.hasAlert(),        //
-                    highlight.hasSound(),        //
-                    highlightSoundUrl,           //
-                    highlight.getColor(),        //
-                    highlight.showInMentions(),  //
-                };
+                return list->check(senderName);
             }});
     }
 }
@@ -494,45 +585,7 @@ std::pair<bool, HighlightResult> HighlightController::check(
         {
             highlighted = true;
 
-            if (checkResult->alert)
-            {
-                if (!result.alert)
-                {
-                    result.alert = checkResult->alert;
-                }
-            }
-
-            if (checkResult->playSound)
-            {
-                if (!result.playSound)
-                {
-                    result.playSound = checkResult->playSound;
-                }
-            }
-
-            if (checkResult->customSoundUrl)
-            {
-                if (!result.customSoundUrl)
-                {
-                    result.customSoundUrl = checkResult->customSoundUrl;
-                }
-            }
-
-            if (checkResult->color)
-            {
-                if (!result.color)
-                {
-                    result.color = checkResult->color;
-                }
-            }
-
-            if (checkResult->showInMentions)
-            {
-                if (!result.showInMentions)
-                {
-                    result.showInMentions = checkResult->showInMentions;
-                }
-            }
+            mergeHighlightResult(result, *checkResult);
 
             if (result.full())
             {
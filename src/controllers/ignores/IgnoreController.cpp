@@ -12,9 +12,14 @@
 #include "providers/twitch/TwitchAccount.hpp"
 #include "providers/twitch/TwitchIrc.hpp"
 #include "singletons/Settings.hpp"
+#include "util/PhraseMatcher.hpp"
+
+#include <memory>
+#include <mutex>
 
 namespace {
 
+using namespace chatterino;
 using namespace chatterino::literals;
 
 /**
@@ -131,6 +136,49 @@ QString makeRegexReplacement(QStringView source,
     return dst;
 }
 
+/// The block phrases of one version of the ignored phrases
+struct BlockPhrases {
+    std::shared_ptr<const std::vector<IgnorePhrase>> source;
+    std::vector<const IgnorePhrase *> phrases;
+    PhraseMatcher matcher;
+};
+
+/// Returns the block phrases of `source`. The matcher is only rebuilt if the
+/// ignored phrases changed since the last call.
+std::shared_ptr<const BlockPhrases> blockPhrases(
+    std::shared_ptr<const std::vector<IgnorePhrase>> source)
+{
+    static std::mutex mutex;
+    static std::shared_ptr<const BlockPhrases> cached;
+
+    std::lock_guard guard(mutex);
+    if (cached && cached->source == source)
+    {
+        return cached;
+    }
+
+    auto block = std::make_shared<BlockPhrases>();
+    std::vector<PhraseMatcher::Phrase> patterns;
+    for (const auto &phrase : *source)
+    {
+        if (!phrase.isBlock())
+        {
+            continue;
+        }
+        block->phrases.push_back(&phrase);
+        patterns.push_back({
+            .pattern = phrase.getPattern(),
+            .isRegex = phrase.isRegex(),
+            .isCaseSensitive = phrase.isCaseSensitive(),
+        });
+    }
+    block->matcher = PhraseMatcher(patterns);
+    block->source = std::move(source);
+
+    cached = std::move(block);
+    return cached;
+}
+
 }  // namespace
 
 namespace chatterino {
@@ -139,11 +187,11 @@ bool isIgnoredMessage(IgnoredMessageParameters &&params)
 {
     if (!params.message.isEmpty())
     {
-        // TODO(pajlada): Do we need to check if the phrase is valid first?
-        auto phrases = getSettings()->ignoredMessages.readOnly();
-        for (const auto &phrase : *phrases)
+        auto block = blockPhrases(getSettings()->ignoredMessages.readOnly());
+        for (auto i : block->matcher.candidates(params.message))
         {
-            if (phrase.isBlock() && phrase.isMatch(params.message))
+            const auto &phrase = *block->phrases[i];
+            if (phrase.isMatch(params.message))
             {
                 qCDebug(chatterinoMessage)
                     << "Blocking message because it contains ignored phrase"
@@ -163,7 +211,7 @@ bool isIgnoredMessage(IgnoredMessageParameters &&params)
                             ->getAccounts()
                             ->twitch.getCurrent()
                             ->blockedUserIds()
-                            .contains(params.twitchUserID);
+                            ->contains(params.twitchUserID);
         }
         else if (!params.twitchUserLogin.isEmpty())
         {
@@ -171,7 +219,7 @@ bool isIgnoredMessage(IgnoredMessageParameters &&params)
                             ->getAccounts()
                             ->twitch.getCurrent()
                             ->blockedUserLogins()
-                            .contains(params.twitchUserLogin);
+                            ->contains(params.twitchUserLogin);
         }
 
         if (isBlocked)
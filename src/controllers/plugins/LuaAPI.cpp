@@ -121,6 +121,8 @@ void c2_later(ThisPluginState L, sol::protected_function callback, int time)
         [pl = L.plugin(), name, timer, cb, thread, main]() {
             timer->deleteLater();
             pl->removeTimeout(timer);
+            auto call = pl->profile.measure(thread.lua_state(),
+                                            QStringLiteral("c2.later"));
             sol::protected_function_result res = cb();
 
             if (res.return_count() != 0)
@@ -49,9 +49,10 @@ std::unordered_set<QString> Plugin::listRegisteredCommands()
     return out;
 }
 
-lua::SignalCallback Plugin::createCallback(sol::main_protected_function pfn)
+lua::SignalCallback Plugin::createCallback(sol::main_protected_function pfn,
+                                           QString entryPoint)
 {
-    return {this->selfRef_.weak(), std::move(pfn)};
+    return {this->selfRef_.weak(), std::move(pfn), std::move(entryPoint)};
 }
 
 Plugin::~Plugin()
@@ -9,6 +9,7 @@
 #    include "controllers/plugins/api/HTTPRequest.hpp"
 #    include "controllers/plugins/ConnectionManager.hpp"
 #    include "controllers/plugins/PluginMeta.hpp"
+#    include "controllers/plugins/PluginProfile.hpp"
 #    include "controllers/plugins/PluginRef.hpp"
 
 #    include <pajlada/signals/signal.hpp>
@@ -124,7 +125,9 @@ public:
         return it->second;
     }
 
-    lua::SignalCallback createCallback(sol::main_protected_function pfn);
+    /// @param entryPoint The name of the callback in the plugin's profile
+    lua::SignalCallback createCallback(sol::main_protected_function pfn,
+                                       QString entryPoint);
 
     /**
      * If the plugin crashes while evaluating the main file, this function will return the error
@@ -158,6 +161,9 @@ public:
     pajlada::Signals::Signal<lua::api::LogLevel, const QString &> onLog;
     lua::ConnectionManager connections;
 
+    /// Time spent in the plugin's commands and callbacks
+    lua::PluginProfile profile;
+
 private:
     QDir loadDirectory_;
     lua_State *state_;
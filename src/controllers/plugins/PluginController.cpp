@@ -47,9 +47,11 @@
 #    include <sol/variadic_args.hpp>
 #    include <sol/variadic_results.hpp>
 
+#    include <algorithm>
 #    include <memory>
 #    include <utility>
 #    include <variant>
+#    include <vector>
 
 namespace chatterino {
 
@@ -409,6 +411,8 @@ QString PluginController::tryExecPluginCommand(const QString &commandName,
                 "channel", lua::api::ChannelRef(ctx.channel)  //
             );
 
+            auto call = plugin->profile.measure(
+                plugin->state_, QStringLiteral("command ") + commandName);
             auto result =
                 lua::tryCall<std::optional<QString>>(it->second, args);
             if (!result)
@@ -509,6 +513,8 @@ std::pair<bool, QStringList> PluginController::updateCustomCompletions(
                 << "Processing custom completions from plugin" << name;
             auto &cb = *opt;
             sol::state_view view(pl->state_);
+            auto call =
+                pl->profile.measure(pl->state_, QStringLiteral("completion"));
             auto errOrList = lua::tryCall<sol::table>(
                 cb,
                 toTable(pl->state_, lua::api::CompletionEvent{
@@ -544,6 +550,40 @@ WebSocketPool &PluginController::webSocketPool()
     return this->webSocketPool_;
 }
 
+QString PluginController::formatProfiles(size_t maxEntries) const
+{
+    struct Entry {
+        const Plugin *plugin;
+        const QString *name;
+        const lua::CallStats *stats;
+    };
+    std::vector<Entry> entries;
+    this->forEachPlugin([&](const auto &plugin) {
+        for (const auto &[name, stats] : plugin->profile.entryPoints())
+        {
+            entries.push_back({plugin.get(), &name, &stats});
+        }
+    });
+    std::ranges::sort(entries, [](const auto &a, const auto &b) {
+        return a.stats->total > b.stats->total;
+    });
+    if (entries.size() > maxEntries)
+    {
+        entries.resize(maxEntries);
+    }
+
+    QString text;
+    for (const auto &entry : entries)
+    {
+        text += QStringView(u"%1 - %2: %3 calls, %4 total, %5 max\n")
+                    .arg(entry.plugin->id, *entry.name,
+                         QString::number(entry.stats->calls),
+                         lua::formatDuration(entry.stats->total),
+                         lua::formatDuration(entry.stats->max));
+    }
+    return text;
+}
+
 void PluginController::queueChangeNotification()
 {
     if (this->changeNotificationQueued)
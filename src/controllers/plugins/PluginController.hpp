@@ -72,6 +72,10 @@ public:
 
     WebSocketPool &webSocketPool();
 
+    /// Formats the `maxEntries` entry points of all plugins that took the
+    /// most time (see PluginProfile)
+    QString formatProfiles(size_t maxEntries) const;
+
     pajlada::Signals::Signal<Plugin *> onPluginLoaded;
     pajlada::Signals::NoArgSignal onPluginsUpdated;
 
@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/PluginProfile.hpp"
+
+#    include "controllers/plugins/Plugin.hpp"
+#    include "debug/AssertInGuiThread.hpp"
+#    include "singletons/Settings.hpp"
+
+#    include <lauxlib.h>
+#    include <lua.h>
+#    include <QStringBuilder>
+
+#    include <algorithm>
+#    include <vector>
+
+namespace {
+
+using namespace chatterino::lua;
+
+/// The innermost call that's running. Calls only happen on the GUI thread.
+PluginProfile::Call *currentCall = nullptr;
+
+QString formatLimit(std::chrono::microseconds limit)
+{
+    if (limit < std::chrono::milliseconds{1})
+    {
+        return QString::number(limit.count()) % u"us";
+    }
+    if (limit < std::chrono::seconds{1})
+    {
+        return QString::number(
+                   std::chrono::duration_cast<std::chrono::milliseconds>(limit)
+                       .count()) %
+               u"ms";
+    }
+    return QString::number(
+               std::chrono::duration_cast<std::chrono::seconds>(limit)
+                   .count()) %
+           u"s";
+}
+
+}  // namespace
+
+namespace chatterino::lua {
+
+void CallStats::record(std::chrono::nanoseconds duration, bool wasAborted)
+{
+    this->calls++;
+    if (wasAborted)
+    {
+        this->aborted++;
+    }
+    this->total += duration;
+    this->max = std::max(this->max, duration);
+
+    auto bucket = std::ranges::find_if(BUCKET_LIMITS, [&](auto limit) {
+        return duration <= limit;
+    });
+    this->histogram[bucket - BUCKET_LIMITS.begin()]++;
+}
+
+PluginProfile::Call::Call(PluginProfile *profile, lua_State *L,
+                          QString entryPoint)
+    : profile_(profile)
+    , state_(L)
+    , entryPoint_(std::move(entryPoint))
+    , start_(std::chrono::steady_clock::now())
+    , outer_(currentCall)
+{
+    assertInGuiThread();
+    currentCall = this;
+
+    auto budget = getSettings()->pluginInstructionBudget.getValue();
+    if (budget <= 0 || L == nullptr)
+    {
+        return;
+    }
+    this->hasBudget_ = true;
+    this->remaining_ = budget;
+    // nested calls into the same plugin reuse the hook of the outer call
+    if (lua_gethook(L) == nullptr)
+    {
+        lua_sethook(L, &Call::hook, LUA_MASKCOUNT, HOOK_INTERVAL);
+        this->ownsHook_ = true;
+    }
+}
+
+PluginProfile::Call::~Call()
+{
+    if (this->ownsHook_)
+    {
+        lua_sethook(this->state_, nullptr, 0, 0);
+    }
+    else if (this->aborted_)
+    {
+        // the hook runs on every instruction after an abort (see hook())
+        lua_sethook(this->state_, &Call::hook, LUA_MASKCOUNT, HOOK_INTERVAL);
+    }
+
+    assert(currentCall == this);
+    currentCall = this->outer_;
+
+    if (this->profile_ != nullptr)
+    {
+        this->profile_->entryPoints_[this->entryPoint_].record(
+            std::chrono::steady_clock::now() - this->start_, this->aborted_);
+    }
+}
+
+void PluginProfile::Call::hook(lua_State *L, lua_Debug * /*ar*/)
+{
+    // Lua errors unwind this frame, so don't create objects with destructors
+    // here.
+    auto *call = currentCall;
+    if (call == nullptr || !call->hasBudget_)
+    {
+        // e.g. a coroutine that inherited the hook
+        return;
+    }
+
+    if (!call->aborted_)
+    {
+        call->remaining_ -= HOOK_INTERVAL;
+        if (call->remaining_ > 0)
+        {
+            return;
+        }
+        call->aborted_ = true;
+        // Fail on every instruction from now on, so the plugin can't keep
+        // running by catching the error with pcall.
+        lua_sethook(L, &Call::hook, LUA_MASKCOUNT, 1);
+    }
+
+    luaL_error(L, "Instruction budget exceeded - the call was aborted");
+}
+
+const std::map<QString, CallStats> &PluginProfile::entryPoints() const
+{
+    return this->entryPoints_;
+}
+
+std::chrono::nanoseconds PluginProfile::totalTime() const
+{
+    std::chrono::nanoseconds total{0};
+    for (const auto &[_, stats] : this->entryPoints_)
+    {
+        total += stats.total;
+    }
+    return total;
+}
+
+void PluginProfile::reset()
+{
+    this->entryPoints_.clear();
+}
+
+QString PluginProfile::format() const
+{
+    std::vector<std::pair<QString, const CallStats *>> sorted;
+    sorted.reserve(this->entryPoints_.size());
+    for (const auto &[name, stats] : this->entryPoints_)
+    {
+        sorted.emplace_back(name, &stats);
+    }
+    std::ranges::sort(sorted, [](const auto &a, const auto &b) {
+        return a.second->total > b.second->total;
+    });
+
+    QString text;
+    for (const auto &[name, stats] : sorted)
+    {
+        text += name % u": " % QString::number(stats->calls) % u" calls, " %
+                formatDuration(stats->total) % u" total, " %
+                formatDuration(stats->max) % u" max";
+        if (stats->aborted > 0)
+        {
+            text += u", " % QString::number(stats->aborted) % u" aborted";
+        }
+        text += u"\n   ";
+        for (size_t i = 0; i < stats->histogram.size(); i++)
+        {
+            if (i < CallStats::BUCKET_LIMITS.size())
+            {
+                text += u" <=" % formatLimit(CallStats::BUCKET_LIMITS[i]);
+            }
+            else
+            {
+                text += u" >" % formatLimit(CallStats::BUCKET_LIMITS.back());
+            }
+            text += u": " % QString::number(stats->histogram[i]);
+        }
+        text += u'\n';
+    }
+    return text;
+}
+
+PluginProfile::Call measureCall(Plugin *plugin, lua_State *L,
+                                QStringView entryPoint)
+{
+    if (plugin == nullptr)
+    {
+        return {nullptr, L, entryPoint.toString()};
+    }
+    return plugin->profile.measure(L, entryPoint.toString());
+}
+
+QString formatDuration(std::chrono::nanoseconds duration)
+{
+    using namespace std::chrono_literals;
+
+    if (duration < 1ms)
+    {
+        return QString::number(static_cast<double>(duration.count()) / 1e3,
+                               'f', 1) %
+               u" us";
+    }
+    if (duration < 1s)
+    {
+        return QString::number(static_cast<double>(duration.count()) / 1e6,
+                               'f', 2) %
+               u" ms";
+    }
+    return QString::number(static_cast<double>(duration.count()) / 1e9, 'f',
+                           2) %
+           u" s";
+}
+
+}  // namespace chatterino::lua
+
+#endif
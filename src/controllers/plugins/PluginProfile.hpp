@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include <QString>
+#    include <QStringView>
+
+#    include <array>
+#    include <chrono>
+#    include <cstddef>
+#    include <cstdint>
+#    include <map>
+
+struct lua_State;
+struct lua_Debug;
+
+namespace chatterino {
+class Plugin;
+}  // namespace chatterino
+
+namespace chatterino::lua {
+
+/// Timings of one entry point of a plugin (e.g. a command or a callback)
+struct CallStats {
+    /// Upper bounds of the histogram buckets. The last bucket counts all
+    /// calls that took longer.
+    static constexpr std::array<std::chrono::microseconds, 5> BUCKET_LIMITS{
+        std::chrono::microseconds{100},   std::chrono::milliseconds{1},
+        std::chrono::milliseconds{10},    std::chrono::milliseconds{100},
+        std::chrono::milliseconds{1000},
+    };
+
+    size_t calls = 0;
+    /// Calls that were aborted because they ran out of instructions
+    size_t aborted = 0;
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds max{0};
+    std::array<size_t, BUCKET_LIMITS.size() + 1> histogram{};
+
+    void record(std::chrono::nanoseconds duration, bool wasAborted);
+};
+
+/// @brief Measures the time a plugin spends in its entry points.
+///
+/// Every call from Chatterino into a plugin should be wrapped in a `Call`.
+/// Besides measuring, a `Call` aborts the plugin's code once it ran more Lua
+/// instructions than the budget in the settings allows
+/// (`/plugins/instructionBudget`). This keeps a runaway callback from
+/// freezing the GUI thread.
+///
+/// Times are inclusive: if a plugin calls into Chatterino, which calls back
+/// into a plugin, the inner call is counted in the outer one as well.
+class PluginProfile
+{
+public:
+    /// Lua instructions between checks of the budget
+    static constexpr int HOOK_INTERVAL = 1000;
+
+    class Call
+    {
+    public:
+        /// @param profile The profile to record into (nullable)
+        /// @param L The Lua thread that will run the call
+        Call(PluginProfile *profile, lua_State *L, QString entryPoint);
+        ~Call();
+
+        Call(const Call &) = delete;
+        Call(Call &&) = delete;
+        Call &operator=(const Call &) = delete;
+        Call &operator=(Call &&) = delete;
+
+    private:
+        static void hook(lua_State *L, lua_Debug *ar);
+
+        PluginProfile *profile_;
+        lua_State *state_;
+        QString entryPoint_;
+        std::chrono::steady_clock::time_point start_;
+
+        /// The call that was running when this one started (if any)
+        Call *outer_ = nullptr;
+        /// True if this call installed the hook on `state_`
+        bool ownsHook_ = false;
+        /// Instructions left (only used if there's a budget)
+        int64_t remaining_ = 0;
+        bool hasBudget_ = false;
+        bool aborted_ = false;
+    };
+
+    /// Starts measuring a call to `entryPoint`, which ends when the returned
+    /// object is destroyed.
+    [[nodiscard]] Call measure(lua_State *L, QString entryPoint)
+    {
+        return {this, L, std::move(entryPoint)};
+    }
+
+    const std::map<QString, CallStats> &entryPoints() const;
+
+    /// Total time spent in all entry points
+    std::chrono::nanoseconds totalTime() const;
+
+    void reset();
+
+    /// Formats the entry points as a table, the most expensive first
+    QString format() const;
+
+private:
+    std::map<QString, CallStats> entryPoints_;
+};
+
+/// Measures a call into `plugin` (see PluginProfile). `plugin` may be null.
+[[nodiscard]] PluginProfile::Call measureCall(Plugin *plugin, lua_State *L,
+                                              QStringView entryPoint);
+
+/// Formats a duration with a fitting unit (e.g. "1.25 ms")
+QString formatDuration(std::chrono::nanoseconds duration);
+
+}  // namespace chatterino::lua
+
+#endif
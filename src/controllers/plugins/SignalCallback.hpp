@@ -9,9 +9,11 @@
 namespace chatterino::lua {
 
 struct SignalCallback {
-    SignalCallback(PluginWeakRef pluginRef, sol::main_protected_function pfn)
+    SignalCallback(PluginWeakRef pluginRef, sol::main_protected_function pfn,
+                   QString entryPoint)
         : pluginRef(std::move(pluginRef))
         , pfn(std::move(pfn))
+        , entryPoint(std::move(entryPoint))
     {
         assert(this->pfn.valid());
     }
@@ -34,6 +36,7 @@ struct SignalCallback {
         }
         this->pluginRef = other.pluginRef;
         this->pfn = other.pfn;
+        this->entryPoint = other.entryPoint;
         return *this;
     }
 
@@ -41,6 +44,7 @@ struct SignalCallback {
     {
         std::swap(this->pfn, other.pfn);
         std::swap(this->pluginRef, other.pluginRef);
+        std::swap(this->entryPoint, other.entryPoint);
         return *this;
     }
 
@@ -67,13 +71,15 @@ struct SignalCallback {
             assert(false && "faulty signal handling");
             return;
         }
-        loggedVoidCall(this->pfn, u"SignalCallback::operator()",
-                       strong.plugin(), std::forward<decltype(args)>(args)...);
+        loggedVoidCall(this->pfn, this->entryPoint, strong.plugin(),
+                       std::forward<decltype(args)>(args)...);
     }
 
 private:
     PluginWeakRef pluginRef;
     sol::main_protected_function pfn;
+    /// Used for logging and profiling
+    QString entryPoint;
 };
 
 }  // namespace chatterino::lua
@@ -4,6 +4,7 @@
 
 #pragma once
 #ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/PluginProfile.hpp"
 #    include "util/Expected.hpp"
 #    include "util/FunctionRef.hpp"
 #    include "util/QMagicEnum.hpp"
@@ -170,9 +171,12 @@ bool hasValueOrLog(const Expected<T, QString> &res, QStringView context,
     return true;
 }
 
+/// Calls @a fn and logs errors. The call is measured in the profile of
+/// @a plugin with @a context as the entry point.
 void loggedVoidCall(const auto &fn, QStringView context, Plugin *plugin,
                     auto &&...args)
 {
+    auto call = measureCall(plugin, fn.lua_state(), context);
     auto res = tryCall<void>(fn, std::forward<decltype(args)>(args)...);
     hasValueOrLog(res, context, plugin);
 }
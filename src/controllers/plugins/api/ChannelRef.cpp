@@ -23,6 +23,8 @@
 
 namespace chatterino::lua::api {
 
+using namespace Qt::Literals;
+
 ChannelRef::ChannelRef(const std::shared_ptr<Channel> &chan)
     : weak(chan)
 {
@@ -251,7 +253,8 @@ api::ConnectionHandle ChannelRef::on_display_name_changed(
     auto *plugin = state.plugin();
     return plugin->connections.managedConnect(
         this->strong()->displayNameChanged,
-        plugin->createCallback(std::move(pfn)));
+        plugin->createCallback(std::move(pfn),
+                               u"Channel:on_display_name_changed"_s));
 }
 
 api::ConnectionHandle ChannelRef::on_messages_cleared(
@@ -260,14 +263,16 @@ api::ConnectionHandle ChannelRef::on_messages_cleared(
     auto *plugin = state.plugin();
     return plugin->connections.managedConnect(
         this->strong()->messagesCleared,
-        plugin->createCallback(std::move(pfn)));
+        plugin->createCallback(std::move(pfn),
+                               u"Channel:on_messages_cleared"_s));
 }
 
 api::ConnectionHandle ChannelRef::on_message_replaced(
     ThisPluginState state, sol::main_protected_function pfn)
 {
     auto *plugin = state.plugin();
-    auto cb = plugin->createCallback(std::move(pfn));
+    auto cb = plugin->createCallback(std::move(pfn),
+                                     u"Channel:on_message_replaced"_s);
     return plugin->connections.managedConnect(
         this->strong()->messageReplaced,
         [cb = std::move(cb)](size_t idx, const auto &old,
@@ -281,7 +286,8 @@ api::ConnectionHandle ChannelRef::on_message_appended(
     ThisPluginState state, sol::main_protected_function pfn)
 {
     auto *plugin = state.plugin();
-    auto cb = plugin->createCallback(std::move(pfn));
+    auto cb = plugin->createCallback(std::move(pfn),
+                                     u"Channel:on_message_appended"_s);
     return plugin->connections.managedConnect(
         this->strong()->messageAppended,
         [cb = std::move(cb)](const auto &msg, const auto &flags) {
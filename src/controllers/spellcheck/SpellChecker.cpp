@@ -7,7 +7,6 @@
 #include "Application.hpp"
 #include "common/QLogging.hpp"
 #include "singletons/Paths.hpp"
-#include "singletons/Settings.hpp"
 #include "util/CombinePath.hpp"
 #include "util/FilesystemHelpers.hpp"
 #include "util/XDGDirectory.hpp"
@@ -136,30 +135,36 @@ SpellCheckerPrivate::SpellCheckerPrivate(const char *affpath, const char *dpath)
 {
 }
 
-SpellChecker::SpellChecker()
-    : private_(SpellCheckerPrivate::tryLoad(
-          getSettings()->spellCheckingDefaultDictionary))
-{
-}
 #else
 class SpellCheckerPrivate
 {
 };
-SpellChecker::SpellChecker() = default;
 #endif
 
+SpellChecker::SpellChecker() = default;
 SpellChecker::~SpellChecker() = default;
 
+void SpellChecker::load(const QString &path)
+{
+#ifdef CHATTERINO_WITH_SPELLCHECK
+    assert(!this->loaded_);
+    this->private_ = SpellCheckerPrivate::tryLoad(path);
+    this->loaded_.store(this->private_ != nullptr, std::memory_order_release);
+#else
+    (void)path;
+#endif
+}
+
 bool SpellChecker::isLoaded() const
 {
-    return this->private_ != nullptr;
+    return this->loaded_.load(std::memory_order_acquire);
 }
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 bool SpellChecker::check(const QString &word)
 {
 #ifdef CHATTERINO_WITH_SPELLCHECK
-    if (!this->private_)
+    if (!this->isLoaded())
     {
         return true;
     }
@@ -175,7 +180,7 @@ bool SpellChecker::check(const QString &word)
 std::vector<std::string> SpellChecker::suggestions(const QString &word)
 {
 #ifdef CHATTERINO_WITH_SPELLCHECK
-    if (!this->private_)
+    if (!this->isLoaded())
     {
         return {};
     }
@@ -6,6 +6,7 @@
 
 #include <QString>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +38,13 @@ public:
     SpellChecker();
     ~SpellChecker();
 
+    /// Loads the dictionary at `path` (see DictionaryInfo::path).
+    ///
+    /// Parsing a dictionary is slow, so this runs on a background thread
+    /// during startup. Until it's done, the checker acts as if no dictionary
+    /// was loaded. Must only be called once.
+    void load(const QString &path);
+
     bool isLoaded() const;
 
     bool check(const QString &word);
@@ -50,6 +58,8 @@ public:
 
 private:
     std::unique_ptr<SpellCheckerPrivate> private_;
+    /// Set once `private_` can be used
+    std::atomic<bool> loaded_ = false;
 };
 
 }  // namespace chatterino
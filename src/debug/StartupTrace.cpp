@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "debug/StartupTrace.hpp"
+
+#include "common/QLogging.hpp"
+#include "util/QMagicEnum.hpp"
+
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStringBuilder>
+#include <QThread>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using namespace chatterino;
+using namespace Qt::Literals;
+
+/// Static initialization runs right after the process started
+const auto PROCESS_START = std::chrono::steady_clock::now();
+
+struct Event {
+    QString name;
+    std::chrono::nanoseconds start;
+    /// Zero for milestones
+    std::chrono::nanoseconds duration;
+    int threadID;
+    bool isMilestone;
+};
+
+struct ThreadInfo {
+    int id;
+    QString name;
+};
+
+std::atomic<bool> enabled = false;
+std::atomic<uint32_t> reachedMilestones = 0;
+
+std::mutex mutex;
+// all guarded by `mutex`
+QString tracePath;
+std::vector<Event> events;
+std::vector<ThreadInfo> threads;
+size_t writtenEvents = 0;
+
+/// Must be called with `mutex` held
+int currentThreadID()
+{
+    thread_local int id = -1;
+    if (id >= 0)
+    {
+        return id;
+    }
+
+    id = static_cast<int>(threads.size());
+    auto *thread = QThread::currentThread();
+    QString name = thread->objectName();
+    if (QCoreApplication::instance() != nullptr &&
+        thread == QCoreApplication::instance()->thread())
+    {
+        name = u"GUI"_s;
+    }
+    else if (name.isEmpty())
+    {
+        name = u"Thread " % QString::number(id);
+    }
+    threads.push_back({.id = id, .name = name});
+    return id;
+}
+
+double toMicroseconds(std::chrono::nanoseconds ns)
+{
+    return static_cast<double>(ns.count()) / 1000.0;
+}
+
+/// Must be called with `mutex` held
+QJsonDocument toChromeTrace()
+{
+    auto pid = QCoreApplication::applicationPid();
+
+    QJsonArray traceEvents;
+    for (const auto &thread : threads)
+    {
+        traceEvents.append(QJsonObject{
+            {u"name"_s, u"thread_name"_s},
+            {u"ph"_s, u"M"_s},
+            {u"pid"_s, pid},
+            {u"tid"_s, thread.id},
+            {u"args"_s, QJsonObject{{u"name"_s, thread.name}}},
+        });
+    }
+    for (const auto &event : events)
+    {
+        QJsonObject obj{
+            {u"name"_s, event.name},
+            {u"cat"_s, u"startup"_s},
+            {u"ts"_s, toMicroseconds(event.start)},
+            {u"pid"_s, pid},
+            {u"tid"_s, event.threadID},
+        };
+        if (event.isMilestone)
+        {
+            obj.insert(u"ph"_s, u"i"_s);
+            // global scope, drawn across all threads
+            obj.insert(u"s"_s, u"g"_s);
+        }
+        else
+        {
+            obj.insert(u"ph"_s, u"X"_s);
+            obj.insert(u"dur"_s, toMicroseconds(event.duration));
+        }
+        traceEvents.append(obj);
+    }
+
+    return QJsonDocument(QJsonObject{
+        {u"traceEvents"_s, traceEvents},
+        {u"displayTimeUnit"_s, u"ms"_s},
+    });
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void StartupTrace::enable(const QString &path)
+{
+    {
+        std::lock_guard lock(mutex);
+        tracePath = path;
+    }
+    enabled = true;
+    qCInfo(chatterinoBenchmark) << "Recording startup trace to" << path;
+}
+
+bool StartupTrace::isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void StartupTrace::milestone(Milestone milestone)
+{
+    auto bit = uint32_t{1} << static_cast<uint32_t>(milestone);
+    if ((reachedMilestones.load(std::memory_order_relaxed) & bit) != 0)
+    {
+        return;
+    }
+    if ((reachedMilestones.fetch_or(bit) & bit) != 0)
+    {
+        return;
+    }
+
+    auto now = elapsed();
+    auto name = qmagicenum::enumNameString(milestone);
+    qCInfo(chatterinoBenchmark).noquote()
+        << name << "after"
+        << std::chrono::duration<double, std::milli>(now).count() << "ms";
+
+    if (!isEnabled())
+    {
+        return;
+    }
+    {
+        std::lock_guard lock(mutex);
+        events.push_back({
+            .name = name,
+            .start = now,
+            .duration = {},
+            .threadID = currentThreadID(),
+            .isMilestone = true,
+        });
+    }
+    if (milestone == Milestone::FirstMessagesPainted)
+    {
+        write();
+    }
+}
+
+std::chrono::nanoseconds StartupTrace::elapsed()
+{
+    return std::chrono::steady_clock::now() - PROCESS_START;
+}
+
+void StartupTrace::write()
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard lock(mutex);
+    if (writtenEvents == events.size())
+    {
+        return;
+    }
+
+    QSaveFile file(tracePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(chatterinoBenchmark)
+            << "Failed to open" << tracePath << "-" << file.errorString();
+        return;
+    }
+    file.write(toChromeTrace().toJson(QJsonDocument::Compact));
+    if (!file.commit())
+    {
+        qCWarning(chatterinoBenchmark)
+            << "Failed to write" << tracePath << "-" << file.errorString();
+        return;
+    }
+    writtenEvents = events.size();
+    qCInfo(chatterinoBenchmark)
+        << "Wrote" << writtenEvents << "startup events to" << tracePath;
+}
+
+void StartupTrace::record(const QString &name, std::chrono::nanoseconds start,
+                          std::chrono::nanoseconds duration)
+{
+    std::lock_guard lock(mutex);
+    events.push_back({
+        .name = name,
+        .start = start,
+        .duration = duration,
+        .threadID = currentThreadID(),
+        .isMilestone = false,
+    });
+}
+
+StartupSpan::StartupSpan(QString name)
+{
+    if (!StartupTrace::isEnabled())
+    {
+        return;
+    }
+    this->name_ = std::move(name);
+    this->start_ = StartupTrace::elapsed();
+    this->active_ = true;
+}
+
+StartupSpan::~StartupSpan()
+{
+    this->end();
+}
+
+void StartupSpan::end()
+{
+    if (!this->active_)
+    {
+        return;
+    }
+    this->active_ = false;
+    StartupTrace::record(this->name_, this->start_,
+                         StartupTrace::elapsed() - this->start_);
+}
+
+}  // namespace chatterino
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <chrono>
+#include <cstdint>
+
+namespace chatterino {
+
+/// @brief Records what Chatterino does while it starts.
+///
+/// Startup steps are measured with a `StartupSpan`. Spans can be nested and
+/// can be started from any thread. Recording is off by default and enabled
+/// with `--startup-trace=file`. The trace is written as Chrome trace JSON,
+/// which can be opened in https://ui.perfetto.dev or chrome://tracing.
+///
+/// Milestones (e.g. the first painted chat) are always logged to
+/// `chatterino.benchmark`, with or without a trace.
+class StartupTrace
+{
+public:
+    enum class Milestone : uint8_t {
+        /// A chat (ChannelView) was painted for the first time
+        FirstChatPainted,
+        /// A chat with messages was painted for the first time
+        FirstMessagesPainted,
+    };
+
+    /// Starts recording. The trace is written to `path` once the first
+    /// messages were painted and again when Chatterino quits.
+    static void enable(const QString &path);
+    static bool isEnabled();
+
+    /// Records `milestone` the first time it's reached
+    static void milestone(Milestone milestone);
+
+    /// Time since the process started (approximately)
+    static std::chrono::nanoseconds elapsed();
+
+    /// Writes the trace if it's enabled and there's something new
+    static void write();
+
+private:
+    friend class StartupSpan;
+
+    static void record(const QString &name, std::chrono::nanoseconds start,
+                       std::chrono::nanoseconds duration);
+};
+
+/// Measures a startup step from its construction until it's destroyed or
+/// `end()` is called.
+class StartupSpan
+{
+public:
+    explicit StartupSpan(QString name);
+    ~StartupSpan();
+
+    StartupSpan(const StartupSpan &) = delete;
+    StartupSpan &operator=(const StartupSpan &) = delete;
+    StartupSpan(StartupSpan &&) = delete;
+    StartupSpan &operator=(StartupSpan &&) = delete;
+
+    void end();
+
+private:
+    QString name_;
+    std::chrono::nanoseconds start_{0};
+    bool active_ = false;
+};
+
+}  // namespace chatterino
@@ -8,6 +8,7 @@
 #include "common/Modes.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "debug/StartupTrace.hpp"
 #include "providers/IvrApi.hpp"
 #include "providers/NetworkConfigurationProvider.hpp"
 #include "providers/twitch/api/Helix.hpp"
@@ -56,6 +57,10 @@ int main(int argc, char **argv)
 #endif
 
     const Args args(a);
+    if (args.startupTrace)
+    {
+        StartupTrace::enable(*args.startupTrace);
+    }
     const Modes modes(args);
     std::unique_ptr<Paths> paths;
 
@@ -140,7 +145,9 @@ int main(int argc, char **argv)
         qCInfo(chatterinoApp) << "Chatterino Qt SSL active backend protocols:"
                               << QSslSocket::supportedProtocols();
 
+        StartupSpan loadingSettings(QStringLiteral("Load settings"));
         Settings settings(modes, args, paths->settingsDirectory);
+        loadingSettings.end();
 
         Updates updates(modes, *paths, settings);
 
@@ -8,7 +8,13 @@
 
 #include <QJsonObject>
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
 namespace chatterino {
 
@@ -84,6 +90,314 @@ EmotePtr cachedOrMakeEmotePtr(
     }
 }
 
+namespace {
+
+/// Bits of the hash used per level of the trie
+constexpr size_t LEVEL_BITS = 5;
+constexpr size_t HASH_BITS = sizeof(size_t) * 8;
+
+size_t hashName(const EmoteName &name)
+{
+    return std::hash<EmoteName>{}(name);
+}
+
+uint32_t bitAt(size_t hash, size_t shift)
+{
+    return 1U << ((hash >> shift) & ((1U << LEVEL_BITS) - 1));
+}
+
+/// Index of `bit` in the entries or children marked in `bitmap`
+uint32_t indexOf(uint32_t bitmap, uint32_t bit)
+{
+    return static_cast<uint32_t>(std::popcount(bitmap & (bit - 1)));
+}
+
+}  // namespace
+
+/// A node of the trie. Each level consumes LEVEL_BITS of the hash to select
+/// one of 32 slots, which holds either an entry or a child node. Once the hash
+/// is exhausted, a node holds all colliding entries in `entries` and has no
+/// children.
+struct EmoteMap::Node {
+    /// Slots that hold an entry
+    uint32_t entryMap = 0;
+    /// Slots that hold a child
+    uint32_t childMap = 0;
+    /// Entries in slot order
+    std::vector<value_type> entries;
+    /// Children in slot order
+    std::vector<std::shared_ptr<Node>> children;
+};
+
+EmoteMap::Node &EmoteMap::ownNode(std::shared_ptr<Node> &node)
+{
+    if (!node)
+    {
+        node = std::make_shared<Node>();
+    }
+    else if (node.use_count() != 1)
+    {
+        node = std::make_shared<Node>(*node);
+    }
+    else
+    {
+        // Another map might have released the node just now. Synchronize
+        // with that release before writing to the node.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *node;
+}
+
+EmotePtr &EmoteMap::nodeSlot(std::shared_ptr<Node> &ptr, size_t hash,
+                             const EmoteName &name, size_t shift,
+                             bool &inserted)
+{
+    auto &node = ownNode(ptr);
+
+    if (shift >= HASH_BITS)
+    {
+        for (auto &entry : node.entries)
+        {
+            if (entry.first == name)
+            {
+                return entry.second;
+            }
+        }
+        inserted = true;
+        return node.entries.emplace_back(name, nullptr).second;
+    }
+
+    auto bit = bitAt(hash, shift);
+    if (node.entryMap & bit)
+    {
+        auto idx = indexOf(node.entryMap, bit);
+        if (node.entries[idx].first == name)
+        {
+            return node.entries[idx].second;
+        }
+
+        // Both entries share this slot, so they're moved to a new child
+        auto existing = std::move(node.entries[idx]);
+        node.entries.erase(node.entries.begin() + idx);
+        node.entryMap &= ~bit;
+
+        std::shared_ptr<Node> child;
+        bool unused = false;
+        nodeSlot(child, hashName(existing.first), existing.first,
+                 shift + LEVEL_BITS, unused) = std::move(existing.second);
+
+        auto childIdx = indexOf(node.childMap, bit);
+        node.children.insert(node.children.begin() + childIdx,
+                             std::move(child));
+        node.childMap |= bit;
+        return nodeSlot(node.children[childIdx], hash, name,
+                        shift + LEVEL_BITS, inserted);
+    }
+
+    if (node.childMap & bit)
+    {
+        return nodeSlot(node.children[indexOf(node.childMap, bit)], hash, name,
+                        shift + LEVEL_BITS, inserted);
+    }
+
+    auto idx = indexOf(node.entryMap, bit);
+    node.entryMap |= bit;
+    inserted = true;
+    return node.entries.emplace(node.entries.begin() + idx, name, nullptr)
+        ->second;
+}
+
+void EmoteMap::nodeErase(std::shared_ptr<Node> &ptr, size_t hash,
+                         const EmoteName &name, size_t shift)
+{
+    auto &node = ownNode(ptr);
+
+    if (shift >= HASH_BITS)
+    {
+        std::erase_if(node.entries, [&](const auto &entry) {
+            return entry.first == name;
+        });
+        return;
+    }
+
+    auto bit = bitAt(hash, shift);
+    if (node.entryMap & bit)
+    {
+        node.entries.erase(node.entries.begin() +
+                           indexOf(node.entryMap, bit));
+        node.entryMap &= ~bit;
+        return;
+    }
+
+    assert(node.childMap & bit);
+    auto childIdx = indexOf(node.childMap, bit);
+    auto &childPtr = node.children[childIdx];
+    nodeErase(childPtr, hash, name, shift + LEVEL_BITS);
+
+    // Pull up a child that's left with at most one entry
+    if (!childPtr->children.empty() || childPtr->entries.size() > 1)
+    {
+        return;
+    }
+    auto remaining = std::move(childPtr->entries);
+    node.children.erase(node.children.begin() + childIdx);
+    node.childMap &= ~bit;
+    if (!remaining.empty())
+    {
+        node.entries.insert(node.entries.begin() + indexOf(node.entryMap, bit),
+                            std::move(remaining.front()));
+        node.entryMap |= bit;
+    }
+}
+
+EmoteMap::const_iterator::reference EmoteMap::const_iterator::operator*()
+    const
+{
+    assert(this->depth_ > 0);
+    return this->path_[this->depth_ - 1].node->entries[this->entry_];
+}
+
+EmoteMap::const_iterator::pointer EmoteMap::const_iterator::operator->() const
+{
+    return &**this;
+}
+
+EmoteMap::const_iterator &EmoteMap::const_iterator::operator++()
+{
+    this->entry_++;
+    this->settle();
+    return *this;
+}
+
+EmoteMap::const_iterator EmoteMap::const_iterator::operator++(int)
+{
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+bool EmoteMap::const_iterator::operator==(const const_iterator &other) const
+{
+    if (this->depth_ != other.depth_)
+    {
+        return false;
+    }
+    if (this->depth_ == 0)
+    {
+        return true;
+    }
+    return this->path_[this->depth_ - 1].node ==
+               other.path_[other.depth_ - 1].node &&
+           this->entry_ == other.entry_;
+}
+
+void EmoteMap::const_iterator::settle()
+{
+    // A node's entries are visited before its children
+    while (this->depth_ > 0)
+    {
+        auto &top = this->path_[this->depth_ - 1];
+        if (this->entry_ < top.node->entries.size())
+        {
+            return;
+        }
+
+        if (top.nextChild < top.node->children.size())
+        {
+            const auto *child = top.node->children[top.nextChild].get();
+            top.nextChild++;
+            this->path_[this->depth_] = {.node = child, .nextChild = 0};
+            this->depth_++;
+            this->entry_ = 0;
+            continue;
+        }
+
+        // all entries of the parent have been visited before its children
+        this->depth_--;
+        this->entry_ = std::numeric_limits<uint32_t>::max();
+    }
+}
+
+EmoteMap::const_iterator EmoteMap::begin() const
+{
+    const_iterator it;
+    if (!this->root_)
+    {
+        return it;
+    }
+    it.path_[0] = {.node = this->root_.get(), .nextChild = 0};
+    it.depth_ = 1;
+    it.entry_ = 0;
+    it.settle();
+    return it;
+}
+
+EmoteMap::const_iterator EmoteMap::end() const
+{
+    return {};
+}
+
+size_t EmoteMap::size() const
+{
+    return this->size_;
+}
+
+bool EmoteMap::empty() const
+{
+    return this->size_ == 0;
+}
+
+EmoteMap::const_iterator EmoteMap::find(const EmoteName &name) const
+{
+    const_iterator it;
+    const auto *node = this->root_.get();
+    auto hash = hashName(name);
+
+    for (size_t shift = 0; node; shift += LEVEL_BITS)
+    {
+        if (shift >= HASH_BITS)
+        {
+            for (uint32_t i = 0; i < node->entries.size(); i++)
+            {
+                if (node->entries[i].first == name)
+                {
+                    it.path_[it.depth_++] = {.node = node, .nextChild = 0};
+                    it.entry_ = i;
+                    return it;
+                }
+            }
+            return {};
+        }
+
+        auto bit = bitAt(hash, shift);
+        if (node->entryMap & bit)
+        {
+            auto idx = indexOf(node->entryMap, bit);
+            if (node->entries[idx].first != name)
+            {
+                return {};
+            }
+            it.path_[it.depth_++] = {.node = node, .nextChild = 0};
+            it.entry_ = idx;
+            return it;
+        }
+        if (!(node->childMap & bit))
+        {
+            return {};
+        }
+
+        auto childIdx = indexOf(node->childMap, bit);
+        it.path_[it.depth_++] = {.node = node, .nextChild = childIdx + 1};
+        node = node->children[childIdx].get();
+    }
+    return {};
+}
+
+bool EmoteMap::contains(const EmoteName &name) const
+{
+    return this->find(name) != this->end();
+}
+
 EmoteMap::const_iterator EmoteMap::findEmote(const QString &emoteNameHint,
                                              const QString &emoteID) const
 {
@@ -103,4 +417,78 @@ EmoteMap::const_iterator EmoteMap::findEmote(const QString &emoteNameHint,
     return it;
 }
 
+EmotePtr &EmoteMap::operator[](const EmoteName &name)
+{
+    bool inserted = false;
+    return this->slot(name, inserted);
+}
+
+std::pair<EmoteMap::const_iterator, bool> EmoteMap::try_emplace(
+    const EmoteName &name, EmotePtr emote)
+{
+    if (this->contains(name))
+    {
+        return {this->find(name), false};
+    }
+
+    bool inserted = false;
+    this->slot(name, inserted) = std::move(emote);
+    return {this->find(name), true};
+}
+
+std::pair<EmoteMap::const_iterator, bool> EmoteMap::emplace(
+    const EmoteName &name, EmotePtr emote)
+{
+    return this->try_emplace(name, std::move(emote));
+}
+
+std::pair<EmoteMap::const_iterator, bool> EmoteMap::emplace(value_type entry)
+{
+    return this->try_emplace(entry.first, std::move(entry.second));
+}
+
+std::pair<EmoteMap::const_iterator, bool> EmoteMap::insert(value_type entry)
+{
+    return this->try_emplace(entry.first, std::move(entry.second));
+}
+
+size_t EmoteMap::erase(const EmoteName &name)
+{
+    if (!this->contains(name))
+    {
+        return 0;
+    }
+
+    nodeErase(this->root_, hashName(name), name, 0);
+    this->size_--;
+    if (this->size_ == 0)
+    {
+        this->root_.reset();
+    }
+    return 1;
+}
+
+void EmoteMap::erase(const_iterator it)
+{
+    // copy the name, the entry is removed
+    auto name = it->first;
+    this->erase(name);
+}
+
+void EmoteMap::clear()
+{
+    this->root_.reset();
+    this->size_ = 0;
+}
+
+EmotePtr &EmoteMap::slot(const EmoteName &name, bool &inserted)
+{
+    auto &emote = nodeSlot(this->root_, hashName(name), name, 0, inserted);
+    if (inserted)
+    {
+        this->size_++;
+    }
+    return emote;
+}
+
 }  // namespace chatterino
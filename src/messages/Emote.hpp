@@ -9,7 +9,10 @@
 
 #include <QStringList>
 
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -47,9 +50,79 @@ bool operator==(const Emote &a, const Emote &b);
 
 using EmotePtr = std::shared_ptr<const Emote>;
 
-class EmoteMap : public std::unordered_map<EmoteName, EmotePtr>
+/// @brief A map from emote names to emotes whose copies share their storage
+///
+/// The map is a hash array mapped trie. Copying it only copies a pointer to
+/// the root. Changing a copy only copies the nodes on the path to the changed
+/// entry, so updating a single emote in a large set (e.g. a live update) takes
+/// O(log n) instead of copying the whole map.
+///
+/// The interface is a subset of std::unordered_map. Iterators are invalidated
+/// by every change to the map.
+class EmoteMap
 {
+    struct Node;
+
 public:
+    using key_type = EmoteName;
+    using mapped_type = EmotePtr;
+    using value_type = std::pair<EmoteName, EmotePtr>;
+    using size_type = size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EmoteMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        const_iterator() = default;
+
+        reference operator*() const;
+        pointer operator->() const;
+
+        const_iterator &operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator &other) const;
+
+    private:
+        struct Frame {
+            const Node *node = nullptr;
+            /// Index of the next child to visit
+            uint32_t nextChild = 0;
+        };
+
+        /// Moves to the next entry if the current one is past the entries of
+        /// its node
+        void settle();
+
+        // 5 bits of the hash per level, plus a level for hash collisions
+        static constexpr size_t MAX_DEPTH = (sizeof(size_t) * 8 + 4) / 5 + 1;
+
+        std::array<Frame, MAX_DEPTH> path_{};
+        /// Number of frames in `path_`. 0 for end().
+        uint8_t depth_ = 0;
+        /// Index of the current entry in the last node of `path_`
+        uint32_t entry_ = 0;
+
+        friend class EmoteMap;
+    };
+    using iterator = const_iterator;
+
+    EmoteMap() = default;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    size_t size() const;
+    bool empty() const;
+
+    const_iterator find(const EmoteName &name) const;
+    bool contains(const EmoteName &name) const;
+
     /**
      * Finds an emote by it's id with a hint to it's name.
      *
@@ -61,8 +134,45 @@ public:
      * @param emoteID The emote id to search for.
      * @return An iterator to the found emote (possibly this->end()).
      */
-    EmoteMap::const_iterator findEmote(const QString &emoteNameHint,
-                                       const QString &emoteID) const;
+    const_iterator findEmote(const QString &emoteNameHint,
+                             const QString &emoteID) const;
+
+    /// Returns the emote for `name`, inserting an empty one if there's none
+    EmotePtr &operator[](const EmoteName &name);
+
+    /// Adds an emote unless the map already has one with the same name.
+    ///
+    /// @returns An iterator to the emote with the name and whether the emote
+    ///          was added.
+    std::pair<const_iterator, bool> try_emplace(const EmoteName &name,
+                                                EmotePtr emote);
+    std::pair<const_iterator, bool> emplace(const EmoteName &name,
+                                            EmotePtr emote);
+    std::pair<const_iterator, bool> emplace(value_type entry);
+    std::pair<const_iterator, bool> insert(value_type entry);
+
+    /// @returns The number of removed emotes (0 or 1)
+    size_t erase(const EmoteName &name);
+    void erase(const_iterator it);
+
+    void clear();
+
+private:
+    /// Returns the slot for `name` in a copy of the nodes on its path that
+    /// isn't shared with other maps. Inserts an empty slot if there's none.
+    EmotePtr &slot(const EmoteName &name, bool &inserted);
+
+    /// Makes sure `node` isn't shared with another map before it's changed
+    static Node &ownNode(std::shared_ptr<Node> &node);
+    static EmotePtr &nodeSlot(std::shared_ptr<Node> &node, size_t hash,
+                              const EmoteName &name, size_t shift,
+                              bool &inserted);
+    /// Removes `name`, which must be in the trie
+    static void nodeErase(std::shared_ptr<Node> &node, size_t hash,
+                          const EmoteName &name, size_t shift);
+
+    std::shared_ptr<Node> root_;
+    size_t size_ = 0;
 };
 
 inline const std::shared_ptr<const EmoteMap> EMPTY_EMOTE_MAP = std::make_shared<
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/EmoteLookupTable.hpp"
+
+#include "messages/Emote.hpp"
+
+#include <QHashFunctions>
+
+#include <algorithm>
+
+namespace {
+
+constexpr qsizetype MAX_LENGTH_BIT = 63;
+
+uint64_t lengthBit(QStringView name)
+{
+    return uint64_t{1} << std::min(name.size(), MAX_LENGTH_BIT);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+EmoteLookupTable::EmoteLookupTable(
+    Sources sources, std::shared_ptr<const EmoteLookupTable> fallback)
+    : sources_(std::move(sources))
+    , fallback_(std::move(fallback))
+{
+    size_t total = 0;
+    for (const auto &source : this->sources_)
+    {
+        if (source)
+        {
+            total += source->size();
+        }
+    }
+    this->emotes_.reserve(total);
+
+    for (const auto &source : this->sources_)
+    {
+        if (!source)
+        {
+            continue;
+        }
+        for (const auto &[name, emote] : *source)
+        {
+            const auto &string = name.string;
+            if (string.isEmpty())
+            {
+                continue;
+            }
+            // try_emplace keeps the emote of an earlier source
+            if (!this->emotes_.try_emplace(string, emote).second)
+            {
+                continue;
+            }
+
+            this->lengths_ |= lengthBit(string);
+            auto first = string.front().unicode() & 0xff;
+            this->firstChars_[first / 64] |= uint64_t{1} << (first % 64);
+        }
+    }
+}
+
+EmotePtr EmoteLookupTable::find(QStringView name) const
+{
+    if (this->mightContain(name))
+    {
+        auto it = this->emotes_.find(name);
+        if (it != this->emotes_.end())
+        {
+            return it->second;
+        }
+    }
+
+    if (this->fallback_)
+    {
+        return this->fallback_->find(name);
+    }
+    return nullptr;
+}
+
+bool EmoteLookupTable::isBuiltFrom(
+    const Sources &sources,
+    const std::shared_ptr<const EmoteLookupTable> &fallback) const
+{
+    return this->sources_ == sources && this->fallback_ == fallback;
+}
+
+size_t EmoteLookupTable::size() const
+{
+    return this->emotes_.size();
+}
+
+size_t EmoteLookupTable::Hash::operator()(QStringView name) const
+{
+    // qHash(QString) hashes the view as well
+    return qHash(name);
+}
+
+bool EmoteLookupTable::mightContain(QStringView name) const
+{
+    if (name.isEmpty() || (this->lengths_ & lengthBit(name)) == 0)
+    {
+        return false;
+    }
+    auto first = name.front().unicode() & 0xff;
+    return (this->firstChars_[first / 64] & (uint64_t{1} << (first % 64))) !=
+           0;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+#include <QStringView>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+struct Emote;
+using EmotePtr = std::shared_ptr<const Emote>;
+class EmoteMap;
+
+/// @brief A single lookup table merging several emote maps.
+///
+/// The maps are given in order of precedence: if two maps contain an emote
+/// with the same name, the one from the earlier map is used. Emotes that
+/// aren't in any of the maps are looked up in the `fallback` table, which
+/// lets many tables share one layer (e.g. the global emotes under the
+/// emotes of each channel). Lookups don't allocate and most words that
+/// aren't emotes are rejected before hashing.
+///
+/// A table is immutable. It remembers the maps it was built from, so the
+/// owner can rebuild it once one of them was replaced (see `isBuiltFrom`).
+class EmoteLookupTable
+{
+public:
+    using Sources = std::vector<std::shared_ptr<const EmoteMap>>;
+
+    /// @param sources The maps in order of precedence. Entries may be null.
+    /// @param fallback The table to look up emotes in that aren't in any of
+    ///                 the maps. May be null.
+    explicit EmoteLookupTable(
+        Sources sources,
+        std::shared_ptr<const EmoteLookupTable> fallback = nullptr);
+
+    /// Returns the emote called `name` or null if there's none
+    EmotePtr find(QStringView name) const;
+
+    /// Returns true if this table was built from exactly these maps and
+    /// fallback
+    bool isBuiltFrom(
+        const Sources &sources,
+        const std::shared_ptr<const EmoteLookupTable> &fallback = nullptr)
+        const;
+
+    /// The number of emotes in this table, excluding the fallback
+    size_t size() const;
+
+private:
+    struct Hash {
+        using is_transparent = void;
+
+        size_t operator()(QStringView name) const;
+    };
+
+    /// Returns false if no emote can be called `name`
+    bool mightContain(QStringView name) const;
+
+    Sources sources_;
+    std::shared_ptr<const EmoteLookupTable> fallback_;
+    std::unordered_map<QString, EmotePtr, Hash, std::equal_to<>> emotes_;
+
+    /// Bit `n` is set if an emote has a length of `n` (the last bit is used
+    /// for all longer names)
+    uint64_t lengths_ = 0;
+    /// Bit `c` is set if an emote starts with a character whose low byte is `c`
+    std::array<uint64_t, 4> firstChars_{};
+};
+
+}  // namespace chatterino
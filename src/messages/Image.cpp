@@ -25,24 +25,264 @@
 #include <QNetworkRequest>
 #include <QTimer>
 
+#include <algorithm>
 #include <atomic>
+#include <vector>
 
 // Duration between each check of every Image instance
 const auto IMAGE_POOL_CLEANUP_INTERVAL = std::chrono::minutes(1);
 // Duration since last usage of Image pixmap before expiration of frames
 const auto IMAGE_POOL_IMAGE_LIFETIME = std::chrono::minutes(10);
+// Maximum amount of memory used by the decoded frames of all images. Once
+// it's exceeded, the least recently used images are freed.
+constexpr int64_t IMAGE_POOL_MAX_BYTES = int64_t{512} * 1024 * 1024;
+// Images used within this duration are never freed to fit into the budget,
+// since they're most likely on screen
+const auto IMAGE_POOL_MIN_LIFETIME = std::chrono::seconds(5);
+
+namespace {
+
+using namespace chatterino;
+
+// Maximum number of frames decoded at once for lazily decoded animations
+constexpr qsizetype LAZY_DECODE_WINDOW = 24;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int64_t> TOTAL_FRAME_BYTES{0};
+
+// Incremented whenever the shown frame of an animated image changes. Only
+// accessed from the GUI thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+uint64_t FRAME_SEQUENCE = 0;
+
+/// Applies the minimum duration browsers use to the delay of a frame
+int frameDuration(int delay)
+{
+    // It seems that browsers have special logic for fast animations.
+    // This implements Chrome and Firefox's behavior which uses
+    // a duration of 100 ms for any frames that specify a duration of <= 10 ms.
+    // See http://webkit.org/b/36082 for more information.
+    // https://github.com/SevenTV/chatterino7/issues/46#issuecomment-1010595231
+    if (delay <= 10)
+    {
+        delay = 100;
+    }
+    return std::max(20, delay);
+}
+
+uint32_t readLE(QByteArrayView data, qsizetype pos, qsizetype bytes)
+{
+    uint32_t value = 0;
+    for (qsizetype i = bytes - 1; i >= 0; i--)
+    {
+        value = (value << 8) | static_cast<uint8_t>(data[pos + i]);
+    }
+    return value;
+}
+
+/// See https://www.w3.org/Graphics/GIF/spec-gif89a.txt
+std::optional<QList<int>> readGifDelays(QByteArrayView data)
+{
+    // header (6) and logical screen descriptor (7)
+    qsizetype pos = 13;
+    if (data.size() < pos)
+    {
+        return std::nullopt;
+    }
+    auto colorTableSize = [](uint8_t flags) -> qsizetype {
+        return (flags & 0x80) != 0 ? 3 * (qsizetype{2} << (flags & 0x07)) : 0;
+    };
+    pos += colorTableSize(static_cast<uint8_t>(data[10]));
+
+    auto skipSubBlocks = [&] {
+        while (pos < data.size())
+        {
+            auto size = static_cast<uint8_t>(data[pos]);
+            pos += 1 + size;
+            if (size == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    QList<int> delays;
+    // like Qt, frames without a graphic control extension use the last delay
+    int delay = 0;
+    while (pos < data.size())
+    {
+        switch (static_cast<uint8_t>(data[pos]))
+        {
+            case 0x21: {  // extension
+                if (pos + 6 <= data.size() &&
+                    static_cast<uint8_t>(data[pos + 1]) == 0xf9)
+                {
+                    // graphic control extension, the delay is in 1/100s
+                    delay = static_cast<int>(readLE(data, pos + 4, 2)) * 10;
+                }
+                pos += 2;
+                if (!skipSubBlocks())
+                {
+                    return std::nullopt;
+                }
+            }
+            break;
+
+            case 0x2c: {  // image descriptor
+                if (pos + 11 > data.size())
+                {
+                    return std::nullopt;
+                }
+                pos += 10 + colorTableSize(static_cast<uint8_t>(data[pos + 9]));
+                // LZW minimum code size
+                pos++;
+                if (!skipSubBlocks())
+                {
+                    return std::nullopt;
+                }
+                delays.append(delay);
+            }
+            break;
+
+            case 0x3b:  // trailer
+                return delays;
+
+            default:
+                return std::nullopt;
+        }
+    }
+
+    // some encoders omit the trailer
+    return delays;
+}
+
+/// See https://developers.google.com/speed/webp/docs/riff_container
+std::optional<QList<int>> readWebpDelays(QByteArrayView data)
+{
+    QList<int> delays;
+    // RIFF header (12)
+    qsizetype pos = 12;
+    while (pos + 8 <= data.size())
+    {
+        auto fourCC = data.sliced(pos, 4);
+        auto size = static_cast<qsizetype>(readLE(data, pos + 4, 4));
+        pos += 8;
+        if (pos + size > data.size())
+        {
+            return std::nullopt;
+        }
+
+        if (fourCC == "ANMF")
+        {
+            if (size < 16)
+            {
+                return std::nullopt;
+            }
+            delays.append(static_cast<int>(readLE(data, pos + 12, 3)));
+        }
+
+        // chunks are padded to an even size
+        pos += size + (size & 1);
+    }
+
+    if (delays.isEmpty())
+    {
+        // not animated
+        return std::nullopt;
+    }
+    return delays;
+}
+
+}  // namespace
 
 namespace chatterino::detail {
 
+FrameDecoder::FrameDecoder(QByteArray data)
+    : data_(std::move(data))
+{
+}
+
+FrameDecoder::~FrameDecoder() = default;
+
+void FrameDecoder::decode(qsizetype start, qsizetype length,
+                          QList<std::pair<qsizetype, QImage>> &out)
+{
+    if (!this->reader_ || start < this->position_)
+    {
+        this->restart();
+    }
+    // Not all formats support random access - for these, we have to decode
+    // (and discard) the frames before `start`.
+    if (start > this->position_ &&
+        this->reader_->jumpToImage(static_cast<int>(start)))
+    {
+        this->position_ = start;
+    }
+
+    while (this->position_ < start + length)
+    {
+        auto image = this->reader_->read();
+        if (image.isNull())
+        {
+            // start over with the next range
+            this->reader_.reset();
+            break;
+        }
+        this->framesRead_++;
+        if (this->position_ >= start)
+        {
+            out.emplace_back(this->position_, std::move(image));
+        }
+        this->position_++;
+    }
+}
+
+qsizetype FrameDecoder::framesRead() const
+{
+    return this->framesRead_;
+}
+
+void FrameDecoder::restart()
+{
+    this->reader_.reset();
+    this->buffer_ = std::make_unique<QBuffer>();
+    this->buffer_->setData(this->data_);
+    this->reader_ = std::make_unique<QImageReader>(this->buffer_.get());
+    this->position_ = 0;
+}
+
+std::optional<QList<int>> readFrameDelays(QByteArrayView data)
+{
+    if (data.startsWith("GIF87a") || data.startsWith("GIF89a"))
+    {
+        return readGifDelays(data);
+    }
+    if (data.size() >= 12 && data.startsWith("RIFF") &&
+        data.sliced(8, 4) == "WEBP")
+    {
+        return readWebpDelays(data);
+    }
+    return std::nullopt;
+}
+
 Frames::Frames()
 {
     DebugCount::increase(DebugObject::Image);
 }
 
-Frames::Frames(QList<Frame> &&frames)
+Frames::Frames(QList<Frame> &&frames,
+               std::shared_ptr<LazyFrameSource> lazySource)
     : items_(std::move(frames))
+    , lazySource_(std::move(lazySource))
+    , lastFrameChange_(++FRAME_SEQUENCE)
 {
     assertInGuiThread();
+    if (this->lazySource_)
+    {
+        this->lazySource_->owner = this;
+    }
+
     auto *app = tryGetApp();
     if (app == nullptr)
     {
@@ -85,13 +325,16 @@ Frames::Frames(QList<Frame> &&frames)
         this->processOffset();
     }
 
-    DebugCount::increase(DebugObject::BytesImageCurrent, this->memoryUsage());
-    DebugCount::increase(DebugObject::BytesImageLoaded, this->memoryUsage());
+    this->trackMemory(0, this->memoryUsage());
 }
 
 Frames::~Frames()
 {
     assertInGuiThread();
+    if (this->lazySource_)
+    {
+        this->lazySource_->owner = nullptr;
+    }
     DebugCount::decrease(DebugObject::Image);
     if (!this->empty())
     {
@@ -102,8 +345,7 @@ Frames::~Frames()
     {
         DebugCount::decrease(DebugObject::AnimatedImage);
     }
-    DebugCount::decrease(DebugObject::BytesImageCurrent, this->memoryUsage());
-    DebugCount::increase(DebugObject::BytesImageUnloaded, this->memoryUsage());
+    this->trackMemory(this->memoryUsage(), 0);
 
     this->gifTimerConnection_.disconnect();
 }
@@ -122,6 +364,26 @@ int64_t Frames::memoryUsage() const
     return usage;
 }
 
+int64_t Frames::totalMemoryUsage()
+{
+    return TOTAL_FRAME_BYTES.load(std::memory_order_relaxed);
+}
+
+void Frames::trackMemory(int64_t before, int64_t after)
+{
+    auto diff = after - before;
+    DebugCount::increase(DebugObject::BytesImageCurrent, diff);
+    if (diff > 0)
+    {
+        DebugCount::increase(DebugObject::BytesImageLoaded, diff);
+    }
+    else
+    {
+        DebugCount::increase(DebugObject::BytesImageUnloaded, -diff);
+    }
+    TOTAL_FRAME_BYTES.fetch_add(diff, std::memory_order_relaxed);
+}
+
 void Frames::advance()
 {
     this->durationOffset_ += GIF_FRAME_LENGTH;
@@ -149,6 +411,130 @@ void Frames::processOffset()
             break;
         }
     }
+
+    this->updateShownIndex();
+
+    if (this->lazySource_)
+    {
+        this->requestWindow();
+    }
+}
+
+void Frames::updateShownIndex()
+{
+    if (this->shownIndex_ == this->index_ ||
+        this->items_[this->index_].image.isNull())
+    {
+        return;
+    }
+
+    this->shownIndex_ = this->index_;
+    this->lastFrameChange_ = ++FRAME_SEQUENCE;
+}
+
+uint64_t Frames::lastFrameChange() const
+{
+    return this->lastFrameChange_;
+}
+
+uint64_t Frames::frameSequence()
+{
+    return FRAME_SEQUENCE;
+}
+
+void Frames::requestWindow()
+{
+    auto &source = *this->lazySource_;
+    if (source.decodeInFlight)
+    {
+        return;
+    }
+
+    auto count = this->items_.size();
+    auto window = std::min(source.window, count);
+    // Request the next window once a third of the current one is left
+    auto lookahead = std::max<qsizetype>(window / 3, 1);
+
+    bool missing = false;
+    for (qsizetype i = 0; i < lookahead; i++)
+    {
+        if (this->items_[(this->index_ + i) % count].image.isNull())
+        {
+            missing = true;
+            break;
+        }
+    }
+    if (!missing)
+    {
+        return;
+    }
+
+    if (!source.decoder)
+    {
+        source.decoder = std::make_shared<FrameDecoder>(source.data);
+    }
+
+    // Only one request is in flight per source, so the decoder is never used
+    // by two threads at once
+    source.decodeInFlight = true;
+    imageDecodePool().start([weak = std::weak_ptr(this->lazySource_),
+                             decoder = source.decoder, from = this->index_,
+                             window, count] {
+        if (isAppAboutToQuit())
+        {
+            return;
+        }
+
+        QList<std::pair<qsizetype, QImage>> decoded;
+        decoded.reserve(window);
+        auto untilEnd = std::min(window, count - from);
+        decoder->decode(from, untilEnd, decoded);
+        if (untilEnd < window)
+        {
+            // wrap around to the start of the animation
+            decoder->decode(0, window - untilEnd, decoded);
+        }
+
+        postToThread([weak, decoded = std::move(decoded)]() mutable {
+            auto source = weak.lock();
+            if (!source)
+            {
+                return;
+            }
+            source->decodeInFlight = false;
+            if (source->owner)
+            {
+                source->owner->assignDecoded(std::move(decoded));
+            }
+        });
+    });
+}
+
+void Frames::assignDecoded(QList<std::pair<qsizetype, QImage>> &&decoded)
+{
+    assertInGuiThread();
+
+    auto before = this->memoryUsage();
+
+    // Only keep the new window and the frame that's currently on screen
+    for (qsizetype i = 0; i < this->items_.size(); i++)
+    {
+        if (i != this->shownIndex_)
+        {
+            this->items_[i].image = QPixmap();
+        }
+    }
+    for (auto &[index, image] : decoded)
+    {
+        if (index < this->items_.size())
+        {
+            this->items_[index].image = QPixmap::fromImage(std::move(image));
+        }
+    }
+
+    this->updateShownIndex();
+
+    this->trackMemory(before, this->memoryUsage());
 }
 
 void Frames::clear()
@@ -158,11 +544,17 @@ void Frames::clear()
     {
         DebugCount::decrease(DebugObject::LoadedImage);
     }
-    DebugCount::decrease(DebugObject::BytesImageCurrent, this->memoryUsage());
-    DebugCount::increase(DebugObject::BytesImageUnloaded, this->memoryUsage());
+    this->trackMemory(this->memoryUsage(), 0);
+
+    if (this->lazySource_)
+    {
+        this->lazySource_->owner = nullptr;
+        this->lazySource_.reset();
+    }
 
     this->items_.clear();
     this->index_ = 0;
+    this->shownIndex_ = 0;
     this->durationOffset_ = 0;
     this->gifTimerConnection_.disconnect();
 }
@@ -184,7 +576,7 @@ std::optional<QPixmap> Frames::current() const
         return std::nullopt;
     }
 
-    return this->items_[this->index_].image;
+    return this->items_[this->shownIndex_].image;
 }
 
 std::optional<QPixmap> Frames::first() const
@@ -194,32 +586,51 @@ std::optional<QPixmap> Frames::first() const
         return std::nullopt;
     }
 
+    if (this->items_.front().image.isNull())
+    {
+        // The first frame of a lazily decoded animation isn't decoded, but
+        // all frames have the same size.
+        return this->current();
+    }
+
     return this->items_.front().image;
 }
 
-QList<Frame> readFrames(QImageReader &reader, const Url &url)
+QList<DecodedFrame> readFrames(QImageReader &reader, const Url &url,
+                               std::optional<qsizetype> keepFrames,
+                               const QList<int> &delays)
 {
-    QList<Frame> frames;
+    QList<DecodedFrame> frames;
     frames.reserve(reader.imageCount());
 
+    bool haveDelays = delays.size() == reader.imageCount();
     for (int index = 0; index < reader.imageCount(); ++index)
     {
-        auto pixmap = QPixmap::fromImageReader(&reader);
-        if (!pixmap.isNull())
+        if (haveDelays && keepFrames && frames.size() >= *keepFrames)
+        {
+            // The frame is decoded once it's about to be shown, we only need
+            // its duration
+            frames.append(DecodedFrame{
+                .image = QImage(),
+                .duration = frameDuration(delays[index]),
+            });
+            continue;
+        }
+
+        auto image = reader.read();
+        if (!image.isNull())
         {
-            // It seems that browsers have special logic for fast animations.
-            // This implements Chrome and Firefox's behavior which uses
-            // a duration of 100 ms for any frames that specify a duration of <= 10 ms.
-            // See http://webkit.org/b/36082 for more information.
-            // https://github.com/SevenTV/chatterino7/issues/46#issuecomment-1010595231
-            int duration = reader.nextImageDelay();
-            if (duration <= 10)
+            int duration = frameDuration(reader.nextImageDelay());
+
+            if (keepFrames && frames.size() >= *keepFrames)
             {
-                duration = 100;
+                // only the duration is needed, this frame is decoded again
+                // once it's about to be shown
+                image = QImage();
             }
-            duration = std::max(20, duration);
-            frames.append(Frame{
-                .image = std::move(pixmap),
+
+            frames.append(DecodedFrame{
+                .image = std::move(image),
                 .duration = duration,
             });
         }
@@ -234,17 +645,33 @@ QList<Frame> readFrames(QImageReader &reader, const Url &url)
     return frames;
 }
 
-void assignFrames(std::weak_ptr<Image> weak, QList<Frame> parsed)
+void assignFrames(std::weak_ptr<Image> weak, QList<DecodedFrame> parsed,
+                  std::shared_ptr<LazyFrameSource> lazySource)
 {
     static bool isPushQueued;
 
-    auto cb = [parsed = std::move(parsed), weak = std::move(weak)]() mutable {
+    auto cb = [parsed = std::move(parsed), weak = std::move(weak),
+               lazySource = std::move(lazySource)]() mutable {
         auto shared = weak.lock();
         if (!shared)
         {
             return;
         }
-        shared->frames_ = std::make_unique<detail::Frames>(std::move(parsed));
+
+        // QPixmaps can only be created in the GUI thread
+        QList<Frame> frames;
+        frames.reserve(parsed.size());
+        for (auto &frame : parsed)
+        {
+            frames.append(Frame{
+                .image = frame.image.isNull()
+                             ? QPixmap()
+                             : QPixmap::fromImage(std::move(frame.image)),
+                .duration = frame.duration,
+            });
+        }
+        shared->frames_ = std::make_unique<detail::Frames>(
+            std::move(frames), std::move(lazySource));
 
         // Avoid too many layouts in one event-loop iteration
         //
@@ -263,8 +690,16 @@ void assignFrames(std::weak_ptr<Image> weak, QList<Frame> parsed)
                     auto *app = tryGetApp();
                     if (app != nullptr)
                     {
-                        app->getWindows()->forceLayoutChannelViews();
+                        // Only layouts that were laid out before their images
+                        // loaded need to be redone
+                        app->getWindows()->notifyImagesLoaded();
                     }
+#ifndef DISABLE_IMAGE_EXPIRATION_POOL
+                    if (Frames::totalMemoryUsage() > IMAGE_POOL_MAX_BYTES)
+                    {
+                        ImageExpirationPool::instance().enforceBudget();
+                    }
+#endif
                 },
                 Qt::QueuedConnection);
         }
@@ -273,6 +708,18 @@ void assignFrames(std::weak_ptr<Image> weak, QList<Frame> parsed)
     postToGuiThread(cb);
 }
 
+QThreadPool &imageDecodePool()
+{
+    static auto *pool = [] {
+        auto *pool = new QThreadPool;
+        pool->setObjectName("ImageDecoder");
+        pool->setMaxThreadCount(
+            std::clamp(QThread::idealThreadCount() / 2, 1, 4));
+        return pool;
+    }();
+    return *pool;
+}
+
 }  // namespace chatterino::detail
 
 namespace chatterino {
@@ -482,6 +929,23 @@ bool Image::animated() const
     return this->frames_->animated();
 }
 
+uint64_t Image::lastFrameChange() const
+{
+    assertInGuiThread();
+
+    if (!this->frames_)
+    {
+        return 0;
+    }
+
+    return this->frames_->lastFrameChange();
+}
+
+uint64_t Image::frameSequence()
+{
+    return detail::Frames::frameSequence();
+}
+
 int Image::width() const
 {
     assertInGuiThread();
@@ -543,57 +1007,21 @@ void Image::actuallyLoad()
         .concurrent()
         .cache()
         .onSuccess([weak](auto result) {
-            auto shared = weak.lock();
-            if (!shared)
+            if (!weak.lock())
             {
                 return;
             }
 
             assert(!isAppAboutToQuit());
 
-            QBuffer buffer;
-            buffer.setData(result.getData());
-            QImageReader reader(&buffer);
-
-            if (!reader.canRead())
-            {
-                qCDebug(chatterinoImage)
-                    << "Error: image cant be read " << shared->url().string;
-                shared->empty_ = true;
-                return;
-            }
-
-            const auto size = reader.size();
-            if (size.isEmpty())
-            {
-                shared->empty_ = true;
-                return;
-            }
-
-            // returns 1 for non-animated formats
-            if (reader.imageCount() <= 0)
-            {
-                qCDebug(chatterinoImage)
-                    << "Error: image has less than 1 frame "
-                    << shared->url().string << ": " << reader.errorString();
-                shared->empty_ = true;
-                return;
-            }
-
-            // use "double" to prevent int overflows
-            if (double(size.width()) * double(size.height()) *
-                    double(reader.imageCount()) * 4.0 >
-                double(Image::maxBytesRam))
-            {
-                qCDebug(chatterinoImage) << "image too large in RAM";
-
-                shared->empty_ = true;
-                return;
-            }
-
-            auto parsed = detail::readFrames(reader, shared->url());
-
-            assignFrames(shared, parsed);
+            detail::imageDecodePool().start([weak, data = result.getData()] {
+                auto shared = weak.lock();
+                if (!shared || isAppAboutToQuit())
+                {
+                    return;
+                }
+                shared->decodeFrames(data);
+            });
         })
         .onError([weak](auto /*result*/) {
             auto shared = weak.lock();
@@ -610,6 +1038,78 @@ void Image::actuallyLoad()
         .execute();
 }
 
+void Image::decodeFrames(const QByteArray &data)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    QImageReader reader(&buffer);
+
+    if (!reader.canRead())
+    {
+        qCDebug(chatterinoImage)
+            << "Error: image cant be read " << this->url().string;
+        this->empty_ = true;
+        return;
+    }
+
+    const auto size = reader.size();
+    if (size.isEmpty())
+    {
+        this->empty_ = true;
+        return;
+    }
+
+    // returns 1 for non-animated formats
+    const auto imageCount = reader.imageCount();
+    if (imageCount <= 0)
+    {
+        qCDebug(chatterinoImage)
+            << "Error: image has less than 1 frame " << this->url().string
+            << ": " << reader.errorString();
+        this->empty_ = true;
+        return;
+    }
+
+    // use "double" to prevent int overflows
+    const double frameBytes = double(size.width()) * double(size.height()) * 4.0;
+    const double totalBytes = frameBytes * double(imageCount);
+
+    std::shared_ptr<detail::LazyFrameSource> lazySource;
+    std::optional<qsizetype> keepFrames;
+    if (totalBytes > double(Image::maxBytesRam))
+    {
+        auto window = std::clamp<qsizetype>(
+            static_cast<qsizetype>(double(Image::maxBytesRam) / frameBytes), 2,
+            LAZY_DECODE_WINDOW);
+        if (totalBytes > double(Image::maxBytesRamLazy) ||
+            imageCount <= window * 2)
+        {
+            qCDebug(chatterinoImage) << "image too large in RAM";
+
+            this->empty_ = true;
+            return;
+        }
+
+        // Too large to keep every frame decoded - only decode the frames
+        // around the current position
+        lazySource = std::make_shared<detail::LazyFrameSource>();
+        lazySource->data = data;
+        lazySource->url = this->url();
+        lazySource->window = window;
+        keepFrames = window;
+    }
+
+    QList<int> delays;
+    if (lazySource)
+    {
+        delays = detail::readFrameDelays(data).value_or(QList<int>{});
+    }
+    auto parsed = detail::readFrames(reader, this->url(), keepFrames, delays);
+
+    detail::assignFrames(this->weak_from_this(), std::move(parsed),
+                         std::move(lazySource));
+}
+
 void Image::expireFrames()
 {
     assertInGuiThread();
@@ -728,6 +1228,59 @@ void ImageExpirationPool::freeOld()
     DebugCount::set(DebugObject::LastImageGcLeft, this->allImages_.size());
 }
 
+void ImageExpirationPool::enforceBudget()
+{
+    // Declared before the lock, so the last references are dropped after
+    // unlocking (~Image removes itself from the pool)
+    std::vector<std::pair<std::chrono::steady_clock::time_point, ImagePtr>>
+        candidates;
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto total = detail::Frames::totalMemoryUsage();
+    if (total <= IMAGE_POOL_MAX_BYTES)
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (const auto &[rawPtr, weak] : this->allImages_)
+    {
+        auto img = weak.lock();
+        if (!img || img->frames_->empty())
+        {
+            continue;
+        }
+        if (now - img->lastUsed_ < IMAGE_POOL_MIN_LIFETIME)
+        {
+            continue;
+        }
+        candidates.emplace_back(img->lastUsed_, std::move(img));
+    }
+
+    std::ranges::sort(candidates, {}, [](const auto &candidate) {
+        return candidate.first;
+    });
+
+    // Free a bit more than needed so we don't run this for every image load
+    const auto target = IMAGE_POOL_MAX_BYTES / 10 * 9;
+    size_t numFreed = 0;
+    for (const auto &[lastUsed, img] : candidates)
+    {
+        if (total <= target)
+        {
+            break;
+        }
+        total -= img->frames_->memoryUsage();
+        img->expireFrames();
+        this->allImages_.erase(img.get());
+        ++numFreed;
+    }
+
+    qCDebug(chatterinoImage) << "freed frame data for" << numFreed
+                             << "images to fit into the memory budget";
+}
+
 #endif
 
 }  // namespace chatterino
@@ -8,10 +8,12 @@
 #include "util/DebugCount.hpp"
 
 #include <pajlada/signals/signal.hpp>
+#include <QImage>
 #include <QList>
 #include <QPixmap>
 #include <QString>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 
 #include <atomic>
@@ -21,6 +23,9 @@
 #include <mutex>
 #include <optional>
 
+class QBuffer;
+class QImageReader;
+
 namespace chatterino {
 
 class Image;
@@ -29,16 +34,81 @@ class Image;
 
 namespace chatterino::detail {
 
+class Frames;
+
 struct Frame {
     QPixmap image;
     int duration;
 };
 
+/// A frame decoded off the GUI thread. It's converted to a Frame (QPixmap)
+/// once it reaches the GUI thread.
+struct DecodedFrame {
+    QImage image;
+    int duration;
+};
+
+/// Decodes the frames of an animation in order.
+///
+/// The decoder keeps its position between calls, so decoding consecutive
+/// ranges doesn't decode any frame twice, even for formats that can't jump to
+/// a frame. It only starts over when a range before its position is
+/// requested (i.e. once per loop of the animation).
+///
+/// A decoder must only be used by one thread at a time.
+class FrameDecoder
+{
+public:
+    explicit FrameDecoder(QByteArray data);
+    ~FrameDecoder();
+
+    FrameDecoder(const FrameDecoder &) = delete;
+    FrameDecoder &operator=(const FrameDecoder &) = delete;
+    FrameDecoder(FrameDecoder &&) = delete;
+    FrameDecoder &operator=(FrameDecoder &&) = delete;
+
+    /// Decodes the frames [start, start + length) and appends them to `out`
+    void decode(qsizetype start, qsizetype length,
+                QList<std::pair<qsizetype, QImage>> &out);
+
+    /// Number of frames read so far, including the ones that were only read
+    /// to get to a later frame
+    qsizetype framesRead() const;
+
+private:
+    void restart();
+
+    const QByteArray data_;
+    std::unique_ptr<QBuffer> buffer_;
+    std::unique_ptr<QImageReader> reader_;
+    /// Index of the frame the next read() returns
+    qsizetype position_ = 0;
+    qsizetype framesRead_ = 0;
+};
+
+/// Encoded data of an animation that's decoded on demand.
+///
+/// Only frames close to the current position are kept decoded. Everything
+/// except `data`, `url` and `decoder` must only be accessed in the GUI
+/// thread. The decoder is only used by the decode task in flight.
+struct LazyFrameSource {
+    QByteArray data;
+    Url url;
+    /// Number of frames decoded at once
+    qsizetype window = 0;
+    std::shared_ptr<FrameDecoder> decoder;
+
+    /// The frames currently using this source, cleared when they're destroyed
+    Frames *owner = nullptr;
+    bool decodeInFlight = false;
+};
+
 class Frames
 {
 public:
     Frames();
-    Frames(QList<Frame> &&frames);
+    Frames(QList<Frame> &&frames,
+           std::shared_ptr<LazyFrameSource> lazySource = nullptr);
     ~Frames();
 
     Frames(const Frames &) = delete;
@@ -54,17 +124,61 @@ public:
     std::optional<QPixmap> current() const;
     std::optional<QPixmap> first() const;
 
-private:
+    /// Bytes used by the decoded frames
     int64_t memoryUsage() const;
+
+    /// Bytes used by the decoded frames of all Frames instances
+    static int64_t totalMemoryUsage();
+
+    /// Stores frames decoded by a request from requestWindow()
+    void assignDecoded(QList<std::pair<qsizetype, QImage>> &&decoded);
+
+    /// Value of frameSequence() when the shown frame last changed
+    uint64_t lastFrameChange() const;
+
+    /// Incremented every time the shown frame of any Frames instance changes
+    static uint64_t frameSequence();
+
+private:
     void processOffset();
+    /// Shows the frame at `index_` if it's decoded
+    void updateShownIndex();
+    /// Decodes the frames after the current one if they aren't decoded yet
+    /// (only for lazily decoded animations)
+    void requestWindow();
+    void trackMemory(int64_t before, int64_t after);
+
     QList<Frame> items_;
     QList<Frame>::size_type index_{0};
+    /// Index of the frame returned by current(). This lags behind `index_`
+    /// while a lazily decoded frame isn't ready yet.
+    QList<Frame>::size_type shownIndex_{0};
     int durationOffset_{0};
+    std::shared_ptr<LazyFrameSource> lazySource_;
+    uint64_t lastFrameChange_ = 0;
     pajlada::Signals::Connection gifTimerConnection_;
 };
 
-QList<Frame> readFrames(QImageReader &reader, const Url &url);
-void assignFrames(std::weak_ptr<Image> weak, QList<Frame> parsed);
+/// Reads the delay (in milliseconds) of every frame of a GIF or animated
+/// WebP without decoding any pixels. Returns std::nullopt for other formats
+/// and malformed data.
+std::optional<QList<int>> readFrameDelays(QByteArrayView data);
+
+/// Decodes all frames of the image in `reader`. If `keepFrames` is set, only
+/// the first `keepFrames` images are kept, the rest only contributes its
+/// duration. The remaining frames aren't decoded at all if their `delays`
+/// are given (see readFrameDelays).
+QList<DecodedFrame> readFrames(QImageReader &reader, const Url &url,
+                               std::optional<qsizetype> keepFrames = {},
+                               const QList<int> &delays = {});
+void assignFrames(std::weak_ptr<Image> weak, QList<DecodedFrame> parsed,
+                  std::shared_ptr<LazyFrameSource> lazySource = nullptr);
+
+/// Thread pool used to decode images.
+///
+/// It's bounded so a burst of image loads (e.g. when joining many channels)
+/// doesn't starve the global thread pool.
+QThreadPool &imageDecodePool();
 
 }  // namespace chatterino::detail
 
@@ -79,6 +193,9 @@ class Image : public std::enable_shared_from_this<Image>
 public:
     // Maximum amount of RAM used by the image in bytes.
     static constexpr int maxBytesRam = 20 * 1024 * 1024;
+    // Maximum amount of RAM the image would use if fully decoded. Animations
+    // between maxBytesRam and this are decoded on demand.
+    static constexpr int64_t maxBytesRamLazy = 256 * 1024 * 1024;
 
     ~Image();
 
@@ -105,6 +222,13 @@ public:
     QSizeF size() const;
     bool animated() const;
 
+    /// Value of frameSequence() when the shown frame of this image last
+    /// changed. Used to skip repaints of animations that didn't advance.
+    uint64_t lastFrameChange() const;
+
+    /// Incremented every time the shown frame of any image changes
+    static uint64_t frameSequence();
+
     bool operator==(const Image &image) = delete;
 
 private:
@@ -114,6 +238,8 @@ private:
 
     void setPixmap(const QPixmap &pixmap);
     void actuallyLoad();
+    /// Decodes the downloaded `data`. Runs in the image decode pool.
+    void decodeFrames(const QByteArray &data);
     void expireFrames();
 
     const Url url_{};
@@ -134,8 +260,9 @@ private:
     std::unique_ptr<detail::Frames> frames_;
 
     friend class ImageExpirationPool;
-    friend void detail::assignFrames(std::weak_ptr<Image>,
-                                     QList<detail::Frame>);
+    friend void detail::assignFrames(
+        std::weak_ptr<Image>, QList<detail::DecodedFrame>,
+        std::shared_ptr<detail::LazyFrameSource>);
 };
 
 // forward-declarable function that calls Image::getEmpty() under the hood.
@@ -160,6 +287,14 @@ public:
      */
     void freeOld();
 
+    /**
+     * @brief Frees frame data of the least recently used images until the
+     * decoded frames of all images fit into the memory budget.
+     *
+     * Must be ran in the GUI thread.
+     */
+    void enforceBudget();
+
     /*
      * Debug function that unloads all images in the pool. This is intended to
      * test for possible memory leaks from tracked images.
@@ -6,6 +6,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <optional>
@@ -64,6 +65,18 @@ public:
         return this->buffer_.size();
     }
 
+    /**
+     * @brief Return a number that changes whenever the contents change
+     *
+     * This can be used to reuse a snapshot while the queue is unchanged.
+     */
+    [[nodiscard]] size_t generation() const
+    {
+        std::shared_lock lock(this->mutex_);
+
+        return this->generation_;
+    }
+
     /// Value Accessors
     // Copies of values are returned so that references aren't invalidated
 
@@ -127,6 +140,7 @@ public:
         std::unique_lock lock(this->mutex_);
 
         this->buffer_.clear();
+        this->generation_++;
     }
 
     /**
@@ -146,6 +160,7 @@ public:
             deleted = this->buffer_.front();
         }
         this->buffer_.push_back(item);
+        this->generation_++;
         return full;
     }
 
@@ -161,6 +176,7 @@ public:
 
         bool full = this->buffer_.full();
         this->buffer_.push_back(item);
+        this->generation_++;
         return full;
     }
 
@@ -189,6 +205,7 @@ public:
             this->buffer_.push_front(items[b]);
             pushed.push_back(items[f]);
         }
+        this->generation_++;
 
         return pushed;
     }
@@ -212,6 +229,7 @@ public:
             if (eq(this->buffer_[i], needle))
             {
                 this->buffer_[i] = replacement;
+                this->generation_++;
                 return static_cast<int>(i);
             }
         }
@@ -243,6 +261,7 @@ public:
         {
             this->buffer_[index] = replacement;
         }
+        this->generation_++;
         return true;
     }
 
@@ -261,6 +280,7 @@ public:
         if (hint < this->buffer_.size() && this->buffer_[hint] == needle)
         {
             this->buffer_[hint] = replacement;
+            this->generation_++;
             return static_cast<int>(hint);
         }
 
@@ -269,6 +289,7 @@ public:
             if (this->buffer_[i] == needle)
             {
                 this->buffer_[i] = replacement;
+                this->generation_++;
                 return static_cast<int>(i);
             }
         }
@@ -294,6 +315,7 @@ public:
             if (eq(*it, needle))
             {
                 this->buffer_.insert(it, item);
+                this->generation_++;
                 return true;
             }
         }
@@ -321,6 +343,7 @@ public:
             {
                 ++it;  // advance to insert after it
                 this->buffer_.insert(it, item);
+                this->generation_++;
                 return true;
             }
         }
@@ -328,6 +351,67 @@ public:
         return false;
     }
 
+    /**
+     * @brief Merges items into the queue
+     *
+     * Each item is inserted before the first item of the queue that
+     * `goesBefore(item, queued)` holds for, or at the end if there's none.
+     * Both the items and the queue are expected to be sorted, so this is a
+     * single merge. If the queue overflows, the items at the front are
+     * removed.
+     *
+     * @param[in] items the items to insert in order
+     * @param[in] goesBefore whether an item goes before an item of the queue
+     * @return the indices of the inserted items that are still in the queue
+     *         (in ascending order). These are always the last of `items`.
+     */
+    template <typename GoesBefore>
+    std::vector<size_t> merge(const std::vector<T> &items,
+                              GoesBefore goesBefore)
+    {
+        std::unique_lock lock(this->mutex_);
+
+        if (items.empty())
+        {
+            return {};
+        }
+
+        std::vector<T> merged;
+        merged.reserve(this->buffer_.size() + items.size());
+        std::vector<size_t> indices;
+        indices.reserve(items.size());
+
+        auto item = items.begin();
+        for (const auto &queued : this->buffer_)
+        {
+            while (item != items.end() && goesBefore(*item, queued))
+            {
+                indices.push_back(merged.size());
+                merged.push_back(*item);
+                ++item;
+            }
+            merged.push_back(queued);
+        }
+        for (; item != items.end(); ++item)
+        {
+            indices.push_back(merged.size());
+            merged.push_back(*item);
+        }
+
+        size_t overflow = merged.size() - std::min(merged.size(), this->limit_);
+        this->buffer_.assign(this->limit_, merged.begin() + overflow,
+                             merged.end());
+        this->generation_++;
+
+        auto firstKept = std::ranges::lower_bound(indices, overflow);
+        indices.erase(indices.begin(), firstKept);
+        for (auto &index : indices)
+        {
+            index -= overflow;
+        }
+        return indices;
+    }
+
     [[nodiscard]] std::vector<T> getSnapshot() const
     {
         std::shared_lock lock(this->mutex_);
@@ -451,6 +535,7 @@ private:
 
     const size_t limit_;
     boost::circular_buffer<T> buffer_;
+    size_t generation_ = 0;
 };
 
 }  // namespace chatterino
@@ -141,6 +141,14 @@ std::shared_ptr<Message> Message::clone() const
     return cloned;
 }
 
+const SimilaritySketch &Message::similaritySketch() const
+{
+    std::call_once(this->similaritySketchOnce_, [this] {
+        this->similaritySketch_ = SimilaritySketch(this->messageText);
+    });
+    return this->similaritySketch_;
+}
+
 QJsonObject Message::toJson() const
 {
     QJsonObject msg{
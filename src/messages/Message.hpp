@@ -5,6 +5,7 @@
 #pragma once
 
 #include "messages/MessageFlag.hpp"
+#include "messages/SimilaritySketch.hpp"
 #include "providers/twitch/api/HelixEnums.hpp"
 #include "providers/twitch/ChannelPointReward.hpp"
 #include "util/DebugCount.hpp"
@@ -15,6 +16,7 @@
 
 #include <cinttypes>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -127,12 +129,20 @@ struct Message {
     /// Returns an identical, non-frozen message, independent from this one.
     std::shared_ptr<Message> clone() const;
 
+    /// Sketch of #messageText used to speed up similarity checks.
+    /// It's computed on first use, so #messageText must not change afterwards.
+    const SimilaritySketch &similaritySketch() const;
+
     QJsonObject toJson() const;
 
     void freeze() const
     {
         this->frozen = true;
     }
+
+private:
+    mutable std::once_flag similaritySketchOnce_;
+    mutable SimilaritySketch similaritySketch_;
 };
 
 }  // namespace chatterino
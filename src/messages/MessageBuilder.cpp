@@ -16,6 +16,7 @@
 #include "controllers/ignores/IgnorePhrase.hpp"
 #include "controllers/userdata/UserDataController.hpp"
 #include "messages/Emote.hpp"
+#include "messages/EmoteLookupTable.hpp"
 #include "messages/Image.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageColor.hpp"
@@ -1777,7 +1778,10 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
 
     builder.appendUsername(tags, args);
 
-    TextState textState{.twitchChannel = twitchChannel};
+    TextState textState{
+        .twitchChannel = twitchChannel,
+        .emoteTable = twitchChannel ? twitchChannel->emoteTable() : nullptr,
+    };
 
     if (auto optBits = tags.get("bits"))
     {
@@ -1874,7 +1878,7 @@ void MessageBuilder::addTextOrEmote(TextState &state, QString string)
     // Emote name: "forsenPuke" - if string in ignoredEmotes
     // Will match emote regardless of source (i.e. bttv, ffz)
     // Emote source + name: "bttv:nyanPls"
-    if (this->tryAppendEmote(state.twitchChannel, {string}))
+    if (this->tryAppendEmote(state, string))
     {
         // Successfully appended an emote
         return;
@@ -2393,10 +2397,14 @@ void MessageBuilder::appendUsername(Communi::TagsRef tags,
     }
 }
 
-Outcome MessageBuilder::tryAppendEmote(TwitchChannel *twitchChannel,
-                                       const EmoteName &name)
+Outcome MessageBuilder::tryAppendEmote(const TextState &state,
+                                       QStringView name)
 {
-    auto emote = parseEmote(twitchChannel, name);
+    // The table resolves all sources with a single lookup. Without a channel,
+    // only the global emotes are checked.
+    auto emote = state.emoteTable
+                     ? state.emoteTable->find(name)
+                     : parseEmote(state.twitchChannel, {name.toString()});
 
     if (!emote)
     {
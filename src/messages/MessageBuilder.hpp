@@ -30,6 +30,7 @@ using MessagePtrMut = std::shared_ptr<Message>;
 class MessageElement;
 class TextElement;
 struct Emote;
+class EmoteLookupTable;
 using EmotePtr = std::shared_ptr<const Emote>;
 
 class Channel;
@@ -263,6 +264,8 @@ public:
 private:
     struct TextState {
         TwitchChannel *twitchChannel = nullptr;
+        /// Third-party emotes of `twitchChannel`, null if there's no channel
+        std::shared_ptr<const EmoteLookupTable> emoteTable;
         bool hasBits = false;
         bool bitsStacked = false;
         int bitsLeft = 0;
@@ -271,7 +274,7 @@ private:
     void addTextOrEmote(TextState &state, QString string);
 
     Outcome tryAppendCheermote(TextState &state, const QString &string);
-    Outcome tryAppendEmote(TwitchChannel *twitchChannel, const EmoteName &name);
+    Outcome tryAppendEmote(const TextState &state, QStringView name);
 
     bool isEmpty() const;
     MessageElement &back();
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageCommitQueue.hpp"
+
+#include "Application.hpp"
+#include "debug/AssertInGuiThread.hpp"
+#include "util/PostToThread.hpp"
+
+#include <cassert>
+#include <deque>
+
+namespace chatterino {
+
+struct MessageCommitQueue::State {
+    /// Commits in the order they were enqueued
+    std::deque<Commit> pending;
+    /// True if a drain is posted to the event loop
+    bool scheduled = false;
+};
+
+MessageCommitQueue::MessageCommitQueue()
+    : state_(std::make_shared<State>())
+{
+}
+
+// Pending commits are dropped. A posted drain only holds a weak reference.
+MessageCommitQueue::~MessageCommitQueue() = default;
+
+void MessageCommitQueue::enqueue(Commit commit)
+{
+    assertInGuiThread();
+    assert(commit);
+
+    auto &state = *this->state_;
+    state.pending.push_back(std::move(commit));
+    if (state.scheduled)
+    {
+        return;
+    }
+
+    state.scheduled = true;
+    postToThread([weak = std::weak_ptr(this->state_)] {
+        if (isAppAboutToQuit())
+        {
+            return;
+        }
+        if (auto state = weak.lock())
+        {
+            drain(*state);
+        }
+    });
+}
+
+void MessageCommitQueue::flush()
+{
+    assertInGuiThread();
+
+    drain(*this->state_);
+}
+
+bool MessageCommitQueue::empty() const
+{
+    return this->state_->pending.empty();
+}
+
+void MessageCommitQueue::drain(State &state)
+{
+    state.scheduled = false;
+
+    // A commit might enqueue or flush itself, so each one is removed before
+    // it's run
+    while (!state.pending.empty())
+    {
+        auto commit = std::move(state.pending.front());
+        state.pending.pop_front();
+        commit();
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace chatterino {
+
+/// @brief Adds built messages to their channel in batches.
+///
+/// Messages are built on the GUI thread as they arrive. Adding them to their
+/// channel (similarity filters, highlights, mentions and the signals the views
+/// react to) is deferred: all commits enqueued while a burst of messages is
+/// handled run together once control returns to the event loop, in the order
+/// they were enqueued.
+///
+/// All functions must be called from the GUI thread.
+class MessageCommitQueue
+{
+public:
+    using Commit = std::function<void()>;
+
+    MessageCommitQueue();
+    ~MessageCommitQueue();
+
+    MessageCommitQueue(const MessageCommitQueue &) = delete;
+    MessageCommitQueue(MessageCommitQueue &&) = delete;
+    MessageCommitQueue &operator=(const MessageCommitQueue &) = delete;
+    MessageCommitQueue &operator=(MessageCommitQueue &&) = delete;
+
+    /// Runs `commit` after all earlier commits, from a queued event
+    void enqueue(Commit commit);
+
+    /// Runs all pending commits now.
+    ///
+    /// Handlers that depend on the messages of a channel (e.g. timeouts or
+    /// replies) call this first, so they see every message that arrived
+    /// before. This never waits: every pending message is already built.
+    void flush();
+
+    /// Returns true if no commit is pending
+    bool empty() const;
+
+private:
+    struct State;
+
+    /// Runs the pending commits in order
+    static void drain(State &state);
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace chatterino
@@ -753,7 +753,8 @@ void TextElement::addToContainer(MessageLayoutContainer &container,
                 return e;
             };
 
-            auto width = metrics.horizontalAdvance(word);
+            auto width = app->getFonts()->getTextWidth(
+                this->style_, container.getScale(), word);
 
             // see if the text fits in the current line
             if (container.fitsInLine(width))
@@ -868,9 +869,9 @@ void TextElement::addToContainer(MessageLayoutContainer &container,
                 auto isSurrogate = word.size() > i + 1 &&
                                    QChar::isHighSurrogate(word[i].unicode());
 
-                auto charWidth = isSurrogate
-                                     ? metrics.horizontalAdvance(word.mid(i, 2))
-                                     : metrics.horizontalAdvance(word[i]);
+                auto charWidth = app->getFonts()->getTextWidth(
+                    this->style_, container.getScale(),
+                    word.mid(i, isSurrogate ? 2 : 1));
 
                 if (!container.fitsInLine(width + charWidth))
                 {
@@ -1008,10 +1009,18 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
         };
 
         static const auto ellipsis = QStringLiteral("…");
+        static const auto space = QStringLiteral(" ");
+
+        auto *fonts = app->getFonts();
+        const auto scale = container.getScale();
 
         // String to continuously append words onto until we place it in the container
         // once we encounter an emote or reach the end of the message text. */
         QString currentText;
+        // Width of `currentText`. It's the sum of the widths of its words and
+        // spaces, so every word is measured (and cached) once instead of every
+        // prefix of the text.
+        qreal currentWidth = 0;
 
         bool firstIteration = true;
         for (const auto &word : this->words_)
@@ -1023,6 +1032,7 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
             else
             {
                 currentText += ' ';
+                currentWidth += fonts->getTextWidth(this->style_, scale, space);
             }
 
             bool done = false;
@@ -1031,7 +1041,15 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
             {
                 if (std::holds_alternative<QStringView>(parsedWord))
                 {
-                    currentText += std::get<QStringView>(parsedWord);
+                    auto text = std::get<QStringView>(parsedWord);
+                    currentText += text;
+                    currentWidth += fonts->getTextWidth(this->style_, scale,
+                                                        text.toString());
+                    // only elide (which shapes the text) once it's too long
+                    if (container.fitsInLine(currentWidth))
+                    {
+                        continue;
+                    }
                     QString prev =
                         currentText;  // only increments the ref-count
                     currentText =
@@ -1039,6 +1057,9 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
                                            container.remainingWidth());
                     if (currentText != prev)
                     {
+                        // the elided text is only measured once, it's not
+                        // worth caching
+                        currentWidth = metrics.horizontalAdvance(currentText);
                         done = true;
                         break;
                     }
@@ -1052,15 +1073,14 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
                     {
                         auto emoteScale = getSettings()->emoteScale.getValue();
 
-                        auto currentWidth =
-                            metrics.horizontalAdvance(currentText);
-                        auto emoteSize =
-                            image->size() * emoteScale * container.getScale();
+                        auto emoteSize = image->size() * emoteScale * scale;
 
                         if (!container.fitsInLine(currentWidth +
                                                   emoteSize.width()))
                         {
                             currentText += ellipsis;
+                            currentWidth += fonts->getTextWidth(
+                                this->style_, scale, ellipsis);
                             done = true;
                             break;
                         }
@@ -1069,6 +1089,7 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
                         container.addElementNoLineBreak(getTextLayoutElement(
                             currentText, currentWidth, false));
                         currentText.clear();
+                        currentWidth = 0;
 
                         container.addElementNoLineBreak(
                             (new ImageLayoutElement(*this, image, emoteSize))
@@ -1087,9 +1108,8 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
         // Add the last of the pending message text to the container.
         if (!currentText.isEmpty())
         {
-            auto width = metrics.horizontalAdvance(currentText);
             container.addElementNoLineBreak(
-                getTextLayoutElement(currentText, width, false));
+                getTextLayoutElement(currentText, currentWidth, false));
         }
 
         container.breakLine();
@@ -16,74 +16,50 @@ namespace {
 
 using namespace chatterino;
 
-float relativeSimilarity(QStringView str1, QStringView str2)
-{
-    using SizeType = QStringView::size_type;
-
-    // Longest Common Substring Problem
-    std::vector<std::vector<int>> tree(str1.size(),
-                                       std::vector<int>(str2.size(), 0));
-    int z = 0;
-
-    for (SizeType i = 0; i < str1.size(); ++i)
-    {
-        for (SizeType j = 0; j < str2.size(); ++j)
-        {
-            if (str1[i] == str2[j])
-            {
-                if (i == 0 || j == 0)
-                {
-                    tree[i][j] = 1;
-                }
-                else
-                {
-                    tree[i][j] = tree[i - 1][j - 1] + 1;
-                }
-                z = std::max(tree[i][j], z);
-            }
-            else
-            {
-                tree[i][j] = 0;
-            }
-        }
-    }
-
-    // ensure that no div by 0
-    if (z == 0)
-    {
-        return 0.F;
-    }
-
-    auto div = std::max<>({static_cast<SizeType>(1), str1.size(), str2.size()});
-
-    return float(z) / float(div);
-}
-
+/// Returns true if any of the recent `messages` is more than `threshold`
+/// similar to `msg`
 template <std::ranges::bidirectional_range T>
-float inMessages(const MessagePtr &msg, const T &messages)
+bool hasSimilarMessage(const MessagePtr &msg, const T &messages,
+                       float threshold)
 {
-    float similarityPercent = 0.0F;
+    const int maxDelay = getSettings()->hideSimilarMaxDelay;
+    const bool bySameUser = getSettings()->hideSimilarBySameUser;
+    const auto now = QTime::currentTime();
+    const auto &sketch = msg->similaritySketch();
 
     for (const auto &prevMsg :
          messages | std::views::reverse |
              std::views::take(getSettings()->hideSimilarMaxMessagesToCheck))
     {
-        if (prevMsg->parseTime.secsTo(QTime::currentTime()) >=
-            getSettings()->hideSimilarMaxDelay)
+        if (prevMsg->parseTime.secsTo(now) >= maxDelay)
         {
             break;
         }
-        if (getSettings()->hideSimilarBySameUser &&
-            msg->loginName != prevMsg->loginName)
+        if (bySameUser && msg->loginName != prevMsg->loginName)
+        {
+            continue;
+        }
+
+        // Cheap upper bounds first: the common substring can't be longer
+        // than the shorter message or the number of shared bigrams (+1).
+        const auto &prevSketch = prevMsg->similaritySketch();
+        auto longest = static_cast<float>(std::max<qsizetype>(
+            {1, sketch.length(), prevSketch.length()}));
+        if (static_cast<float>(sketch.maxCommonSubstring(prevSketch)) /
+                longest <=
+            threshold)
         {
             continue;
         }
-        similarityPercent = std::max(
-            similarityPercent,
-            relativeSimilarity(msg->messageText, prevMsg->messageText));
+
+        if (detail::relativeSimilarity(msg->messageText,
+                                       prevMsg->messageText) > threshold)
+        {
+            return true;
+        }
     }
 
-    return similarityPercent;
+    return false;
 }
 
 }  // namespace
@@ -105,7 +81,8 @@ void setSimilarityFlags(const MessagePtr &message, const T &messages)
             return;
         }
 
-        if (inMessages(message, messages) > getSettings()->similarityPercentage)
+        if (hasSimilarMessage(message, messages,
+                              getSettings()->similarityPercentage))
         {
             message->flags.set(MessageFlag::Similar);
             if (getSettings()->colorSimilarDisabled)
@@ -120,3 +97,45 @@ template void setSimilarityFlags<std::vector<MessagePtr>>(
     const MessagePtr &msg, const std::vector<MessagePtr> &messages);
 
 }  // namespace chatterino
+
+namespace chatterino::detail {
+
+float relativeSimilarity(QStringView str1, QStringView str2)
+{
+    using SizeType = QStringView::size_type;
+
+    auto div = std::max<>({static_cast<SizeType>(1), str1.size(), str2.size()});
+
+    // Longest Common Substring Problem
+    //
+    // Only one row of the table is kept: row[j] is the length of the common
+    // suffix of str1[..i] and str2[..j - 1]. Iterating j backwards means
+    // row[j - 1] still holds the value of the previous row.
+    if (str2.size() > str1.size())
+    {
+        std::swap(str1, str2);
+    }
+    thread_local std::vector<int> row;
+    row.assign(str2.size() + 1, 0);
+
+    int z = 0;
+    for (SizeType i = 0; i < str1.size(); ++i)
+    {
+        for (SizeType j = str2.size(); j > 0; --j)
+        {
+            if (str1[i] == str2[j - 1])
+            {
+                row[j] = row[j - 1] + 1;
+                z = std::max(row[j], z);
+            }
+            else
+            {
+                row[j] = 0;
+            }
+        }
+    }
+
+    return float(z) / float(div);
+}
+
+}  // namespace chatterino::detail
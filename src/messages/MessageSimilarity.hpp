@@ -6,6 +6,8 @@
 
 #include "messages/Message.hpp"
 
+#include <QStringView>
+
 #include <ranges>
 namespace chatterino {
 
@@ -13,3 +15,13 @@ template <std::ranges::bidirectional_range T>
 void setSimilarityFlags(const MessagePtr &message, const T &messages);
 
 }  // namespace chatterino
+
+namespace chatterino::detail {
+
+/// Returns the length of the longest common substring of `str1` and `str2`
+/// relative to the length of the longer string.
+///
+/// This doesn't allocate once its internal buffer is large enough.
+float relativeSimilarity(QStringView str1, QStringView str2);
+
+}  // namespace chatterino::detail
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/SimilaritySketch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace {
+
+using namespace chatterino;
+
+static_assert(std::has_single_bit(SimilaritySketch::BUCKET_COUNT));
+
+size_t bucketOf(QChar first, QChar second)
+{
+    // Fibonacci hashing - take the top bits of the product
+    auto bigram = (static_cast<uint32_t>(first.unicode()) << 16) |
+                  static_cast<uint32_t>(second.unicode());
+    constexpr auto BUCKET_BITS =
+        std::countr_zero(SimilaritySketch::BUCKET_COUNT);
+    return static_cast<size_t>((bigram * 0x9E3779B1U) >> (32 - BUCKET_BITS));
+}
+
+}  // namespace
+
+namespace chatterino {
+
+SimilaritySketch::SimilaritySketch(QStringView text)
+    : length_(text.size())
+{
+    for (qsizetype i = 1; i < text.size(); i++)
+    {
+        auto &bucket = this->buckets_[bucketOf(text[i - 1], text[i])];
+        if (bucket == std::numeric_limits<uint16_t>::max())
+        {
+            this->exact_ = false;
+            return;
+        }
+        bucket++;
+    }
+}
+
+qsizetype SimilaritySketch::maxCommonSubstring(
+    const SimilaritySketch &other) const
+{
+    auto shorter = std::min(this->length_, other.length_);
+    if (!this->exact_ || !other.exact_)
+    {
+        return shorter;
+    }
+
+    qsizetype commonBigrams = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        commonBigrams += std::min(this->buckets_[i], other.buckets_[i]);
+    }
+
+    return std::min(shorter, commonBigrams + 1);
+}
+
+qsizetype SimilaritySketch::length() const
+{
+    return this->length_;
+}
+
+}  // namespace chatterino
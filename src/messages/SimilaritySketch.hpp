@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QStringView>
+
+#include <array>
+#include <cstdint>
+
+namespace chatterino {
+
+/// Histogram of the character bigrams of a text, hashed into buckets.
+///
+/// Two texts with a common substring of length `z` share at least `z - 1`
+/// bigrams. Merging bigrams into buckets can only increase the overlap of
+/// two histograms, so the overlap plus one is an upper bound for the length
+/// of the longest common substring of both texts. This is used to skip the
+/// exact (quadratic) comparison for messages that can't be similar.
+class SimilaritySketch
+{
+public:
+    static constexpr size_t BUCKET_COUNT = 64;
+
+    SimilaritySketch() = default;
+    explicit SimilaritySketch(QStringView text);
+
+    /// Upper bound for the length of the longest common substring of the
+    /// texts of both sketches
+    qsizetype maxCommonSubstring(const SimilaritySketch &other) const;
+
+    qsizetype length() const;
+
+private:
+    std::array<uint16_t, BUCKET_COUNT> buckets_{};
+    qsizetype length_ = 0;
+    /// False if a bucket overflowed. In that case, only the length is used.
+    bool exact_ = true;
+};
+
+}  // namespace chatterino
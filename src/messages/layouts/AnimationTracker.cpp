@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/layouts/AnimationTracker.hpp"
+
+#include "messages/Image.hpp"
+
+namespace chatterino {
+
+void AnimationTracker::reset()
+{
+    this->entries_.clear();
+}
+
+void AnimationTracker::add(const ImagePtr &image, const QRect &rect)
+{
+    this->entries_.push_back({
+        .image = image,
+        .rect = rect,
+        .paintedAt = Image::frameSequence(),
+    });
+}
+
+void AnimationTracker::markPainted(const QRect &area)
+{
+    auto sequence = Image::frameSequence();
+    for (auto &entry : this->entries_)
+    {
+        if (area.contains(entry.rect))
+        {
+            entry.paintedAt = sequence;
+        }
+    }
+}
+
+QRegion AnimationTracker::dirtyRegion() const
+{
+    QRegion region;
+    for (const auto &entry : this->entries_)
+    {
+        if (entry.image->lastFrameChange() > entry.paintedAt)
+        {
+            region += entry.rect;
+        }
+    }
+    return region;
+}
+
+bool AnimationTracker::empty() const
+{
+    return this->entries_.empty();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QRect>
+#include <QRegion>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace chatterino {
+
+class Image;
+using ImagePtr = std::shared_ptr<Image>;
+
+/// Tracks the animated images shown in a view.
+///
+/// Views record every animated image they paint. On each GIF timer tick,
+/// dirtyRegion() returns the area of the images whose shown frame changed
+/// since they were painted, so a view only repaints what actually changed -
+/// and nothing at all if none of its animations advanced (e.g. because
+/// their frames are longer than the timer interval).
+class AnimationTracker
+{
+public:
+    /// Forgets all images. Called before a full repaint.
+    void reset();
+
+    /// Records that `image` was painted at `rect`
+    void add(const ImagePtr &image, const QRect &rect);
+
+    /// Marks the images inside `area` as painted (for partial repaints)
+    void markPainted(const QRect &area);
+
+    /// The area of all images whose frame changed since they were painted
+    QRegion dirtyRegion() const;
+
+    bool empty() const;
+
+private:
+    struct Entry {
+        ImagePtr image;
+        QRect rect;
+        /// Image::frameSequence() at the time the image was painted
+        uint64_t paintedAt;
+    };
+
+    std::vector<Entry> entries_;
+};
+
+}  // namespace chatterino
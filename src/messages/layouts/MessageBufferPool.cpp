@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/layouts/MessageBufferPool.hpp"
+
+#include "util/DebugCount.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace {
+
+/// Number of released pixmaps that are kept for reuse
+constexpr size_t MAX_RELEASED = 64;
+
+/// Heights of pixmaps are rounded up to a multiple of this (in device pixels)
+constexpr int HEIGHT_GRANULARITY = 16;
+
+}  // namespace
+
+namespace chatterino {
+
+MessageBuffer::~MessageBuffer()
+{
+    this->release();
+}
+
+QPixmap *MessageBuffer::pixmap() const
+{
+    return this->pixmap_.get();
+}
+
+QSize MessageBuffer::size() const
+{
+    return this->size_;
+}
+
+QPixmap *MessageBuffer::acquire(QSize size, qreal devicePixelRatio)
+{
+    auto &pool = MessageBufferPool::instance();
+
+    this->release();
+    this->pixmap_ = pool.take(size);
+    this->pixmap_->setDevicePixelRatio(devicePixelRatio);
+    this->size_ = size;
+    pool.add(this);
+
+    return this->pixmap_.get();
+}
+
+void MessageBuffer::touch()
+{
+    if (this->pixmap_)
+    {
+        MessageBufferPool::instance().touch(this);
+    }
+}
+
+void MessageBuffer::release()
+{
+    if (this->pixmap_)
+    {
+        MessageBufferPool::instance().remove(this);
+    }
+}
+
+MessageBufferPool &MessageBufferPool::instance()
+{
+    // Leaked on purpose: pixmaps must not be destroyed after the application
+    static auto *pool = new MessageBufferPool;
+    return *pool;
+}
+
+void MessageBufferPool::setBudget(int64_t bytes)
+{
+    this->budget_ = std::max<int64_t>(bytes, 0);
+    this->makeRoom(0);
+}
+
+int64_t MessageBufferPool::usedBytes() const
+{
+    return this->usedBytes_;
+}
+
+void MessageBufferPool::clearReleased()
+{
+    for (auto &[key, pixmaps] : this->released_)
+    {
+        for (auto &pixmap : pixmaps)
+        {
+            this->drop(std::move(pixmap));
+        }
+    }
+    this->released_.clear();
+    this->nReleased_ = 0;
+}
+
+std::unique_ptr<QPixmap> MessageBufferPool::take(QSize size)
+{
+    auto cls = sizeClass(size);
+
+    auto it = this->released_.find(keyOf(cls));
+    if (it != this->released_.end() && !it->second.empty())
+    {
+        auto pixmap = std::move(it->second.back());
+        it->second.pop_back();
+        this->nReleased_--;
+        DebugCount::increase(DebugObject::MessageDrawingBuffersReused);
+        return pixmap;
+    }
+
+    this->makeRoom(bytesOf(cls));
+
+    auto pixmap = std::make_unique<QPixmap>(cls);
+    this->setUsedBytes(this->usedBytes_ + bytesOf(pixmap->size()));
+    return pixmap;
+}
+
+void MessageBufferPool::add(MessageBuffer *buffer)
+{
+    this->lru_.push_front(buffer);
+    buffer->lruPos_ = this->lru_.begin();
+    DebugCount::increase(DebugObject::MessageDrawingBuffer);
+}
+
+void MessageBufferPool::remove(MessageBuffer *buffer)
+{
+    this->lru_.erase(buffer->lruPos_);
+    DebugCount::decrease(DebugObject::MessageDrawingBuffer);
+
+    auto pixmap = std::move(buffer->pixmap_);
+    buffer->size_ = {};
+
+    if (this->nReleased_ >= MAX_RELEASED || pixmap->isNull())
+    {
+        this->drop(std::move(pixmap));
+        return;
+    }
+
+    this->released_[keyOf(pixmap->size())].push_back(std::move(pixmap));
+    this->nReleased_++;
+}
+
+void MessageBufferPool::touch(MessageBuffer *buffer)
+{
+    this->lru_.splice(this->lru_.begin(), this->lru_, buffer->lruPos_);
+}
+
+void MessageBufferPool::makeRoom(int64_t bytes)
+{
+    // released pixmaps go first
+    for (auto it = this->released_.begin();
+         it != this->released_.end() && this->usedBytes_ + bytes > this->budget_;)
+    {
+        auto &pixmaps = it->second;
+        while (!pixmaps.empty() && this->usedBytes_ + bytes > this->budget_)
+        {
+            this->drop(std::move(pixmaps.back()));
+            pixmaps.pop_back();
+            this->nReleased_--;
+        }
+
+        if (pixmaps.empty())
+        {
+            it = this->released_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // then the buffers that weren't painted for the longest time
+    while (!this->lru_.empty() && this->usedBytes_ + bytes > this->budget_)
+    {
+        auto *buffer = this->lru_.back();
+        this->lru_.pop_back();
+        DebugCount::decrease(DebugObject::MessageDrawingBuffer);
+        DebugCount::increase(DebugObject::MessageDrawingBuffersEvicted);
+
+        buffer->size_ = {};
+        this->drop(std::move(buffer->pixmap_));
+    }
+}
+
+void MessageBufferPool::drop(std::unique_ptr<QPixmap> pixmap)
+{
+    assert(pixmap);
+    this->setUsedBytes(this->usedBytes_ - bytesOf(pixmap->size()));
+}
+
+void MessageBufferPool::setUsedBytes(int64_t bytes)
+{
+    this->usedBytes_ = bytes;
+    DebugCount::set(DebugObject::BytesMessageDrawingBuffers, bytes);
+}
+
+QSize MessageBufferPool::sizeClass(QSize size)
+{
+    auto height = (size.height() + HEIGHT_GRANULARITY - 1) /
+                  HEIGHT_GRANULARITY * HEIGHT_GRANULARITY;
+    return {size.width(), height};
+}
+
+int64_t MessageBufferPool::bytesOf(QSize size)
+{
+    // pixmaps are 32 bits per pixel
+    return int64_t{size.width()} * size.height() * 4;
+}
+
+uint64_t MessageBufferPool::keyOf(QSize size)
+{
+    return (uint64_t{static_cast<uint32_t>(size.width())} << 32) |
+           static_cast<uint32_t>(size.height());
+}
+
+}  // namespace chatterino
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QPixmap>
+#include <QSize>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+class MessageBufferPool;
+
+/// @brief The pixmap a MessageLayout is painted into.
+///
+/// The pixmap is borrowed from the MessageBufferPool, which can take it back
+/// whenever the buffers exceed their budget. Check #pixmap() before using it.
+class MessageBuffer
+{
+public:
+    MessageBuffer() = default;
+    ~MessageBuffer();
+
+    MessageBuffer(const MessageBuffer &) = delete;
+    MessageBuffer &operator=(const MessageBuffer &) = delete;
+    MessageBuffer(MessageBuffer &&) = delete;
+    MessageBuffer &operator=(MessageBuffer &&) = delete;
+
+    /// Returns the pixmap or null if there's none
+    QPixmap *pixmap() const;
+
+    /// Returns the size of the message in device pixels. The pixmap can be
+    /// larger than that.
+    QSize size() const;
+
+    /// Borrows a pixmap for a message of `size` device pixels. Any previous
+    /// pixmap is released. The contents of the pixmap are undefined.
+    QPixmap *acquire(QSize size, qreal devicePixelRatio);
+
+    /// Marks the buffer as the most recently used one
+    void touch();
+
+    /// Gives the pixmap back to the pool
+    void release();
+
+private:
+    std::unique_ptr<QPixmap> pixmap_;
+    QSize size_;
+    std::list<MessageBuffer *>::iterator lruPos_;
+
+    friend MessageBufferPool;
+};
+
+/// @brief Keeps the buffers of all message layouts within a memory budget.
+///
+/// When the buffers grow larger than the budget, the ones that weren't painted
+/// for the longest time are released. Released pixmaps are kept for a while
+/// and handed out again for messages of a similar size, which is common since
+/// most messages are a single line and views have the same width.
+///
+/// Must only be used on the GUI thread.
+class MessageBufferPool
+{
+public:
+    static MessageBufferPool &instance();
+
+    /// Sets the maximum number of bytes used by buffers. Buffers are released
+    /// once they exceed it.
+    void setBudget(int64_t bytes);
+
+    /// Number of bytes used by buffers, including released ones that are kept
+    /// for reuse
+    int64_t usedBytes() const;
+
+    /// Drops all released pixmaps
+    void clearReleased();
+
+private:
+    MessageBufferPool() = default;
+
+    std::unique_ptr<QPixmap> take(QSize size);
+    void add(MessageBuffer *buffer);
+    void remove(MessageBuffer *buffer);
+    void touch(MessageBuffer *buffer);
+
+    /// Drops released pixmaps and then releases the least recently used
+    /// buffers until `bytes` more fit into the budget
+    void makeRoom(int64_t bytes);
+    void drop(std::unique_ptr<QPixmap> pixmap);
+    void setUsedBytes(int64_t bytes);
+
+    /// Messages with the same size class share pixmaps
+    static QSize sizeClass(QSize size);
+    static int64_t bytesOf(QSize size);
+    static uint64_t keyOf(QSize size);
+
+    int64_t budget_ = 256LL * 1024 * 1024;
+    int64_t usedBytes_ = 0;
+
+    /// Buffers with a pixmap, most recently used first
+    std::list<MessageBuffer *> lru_;
+    /// Released pixmaps by size class
+    std::unordered_map<uint64_t, std::vector<std::unique_ptr<QPixmap>>>
+        released_;
+    size_t nReleased_ = 0;
+
+    friend MessageBuffer;
+};
+
+}  // namespace chatterino
@@ -93,6 +93,14 @@ bool MessageLayout::layout(const MessageLayoutContext &ctx,
         this->layoutState_ = layoutGeneration;
     }
 
+    // check if images shown by this message finished loading
+    const auto imageGeneration = getApp()->getWindows()->getImageGeneration();
+    if (this->hasUnloadedImages_ && this->imageGeneration_ != imageGeneration)
+    {
+        layoutRequired = true;
+    }
+    this->imageGeneration_ = imageGeneration;
+
     // check if work mask changed
     layoutRequired |= this->currentWordFlags_ != ctx.flags;
     this->currentWordFlags_ = ctx.flags;  // getSettings()->getWordTypeMask();
@@ -101,6 +109,13 @@ bool MessageLayout::layout(const MessageLayoutContext &ctx,
     layoutRequired |= this->flags.has(MessageLayoutFlag::RequiresLayout);
     this->flags.unset(MessageLayoutFlag::RequiresLayout);
 
+    // check if the message was changed (e.g. disabled by a timeout)
+    if (this->layoutMessageFlags_ != this->message_->flags)
+    {
+        layoutRequired = true;
+        this->flags.set(MessageLayoutFlag::RequiresBufferUpdate);
+    }
+
     // check if dpi changed
     layoutRequired |= this->scale_ != ctx.scale;
     this->scale_ = ctx.scale;
@@ -134,7 +149,10 @@ void MessageLayout::actuallyLayout(const MessageLayoutContext &ctx)
     this->layoutCount_++;
 #endif
 
+    DebugCount::increase(DebugObject::MessageRelayouts);
+
     auto messageFlags = this->message_->flags;
+    this->layoutMessageFlags_ = messageFlags;
 
     if (this->flags.has(MessageLayoutFlag::Expanded) ||
         (ctx.flags.has(MessageElementFlag::ModeratorTools) &&
@@ -213,6 +231,7 @@ void MessageLayout::actuallyLayout(const MessageLayoutContext &ctx)
 
     this->container_.endLayout();
     this->height_ = this->container_.getHeight();
+    this->hasUnloadedImages_ = this->container_.hasUnloadedImages();
 
     // collapsed state
     this->flags.unset(MessageLayoutFlag::Collapsed);
@@ -227,49 +246,59 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
 {
     MessagePaintResult result;
 
-    QPixmap *pixmap = this->ensureBuffer(ctx.painter, ctx.canvasWidth,
-                                         ctx.messageColors.hasTransparency);
+    const QRect rect{0, ctx.y, ctx.canvasWidth, this->getHeight()};
 
-    if (!this->bufferValid_)
+    if (rect.height() <= ctx.preferences.directPaintMaxHeight)
     {
-        if (ctx.messageColors.hasTransparency)
+        // small messages are cheap enough to be painted every time
+        this->deleteBuffer();
+
+        ctx.painter.save();
+        ctx.painter.translate(0, ctx.y);
+        ctx.painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        this->paintContents(ctx.painter, rect.translated(0, -ctx.y), ctx);
+        ctx.painter.restore();
+    }
+    else
+    {
+        QPixmap *pixmap = this->ensureBuffer(
+            ctx.painter, ctx.canvasWidth, ctx.messageColors.hasTransparency);
+
+        if (!this->bufferValid_)
         {
-            pixmap->fill(Qt::transparent);
+            if (ctx.messageColors.hasTransparency)
+            {
+                pixmap->fill(Qt::transparent);
+            }
+            if (!pixmap->isNull())
+            {
+                QPainter painter(pixmap);
+                painter.setRenderHint(QPainter::SmoothPixmapTransform);
+                this->paintContents(painter, rect.translated(0, -ctx.y), ctx);
+            }
         }
-        this->updateBuffer(pixmap, ctx);
-    }
 
-    // draw on buffer
-    ctx.painter.drawPixmap(QPoint{0, ctx.y}, *pixmap);
+        // draw on buffer (pooled pixmaps can be larger than the message)
+        this->buffer_.touch();
+        ctx.painter.drawPixmap(QPointF{0, static_cast<qreal>(ctx.y)}, *pixmap,
+                               QRectF{QPointF{0, 0}, this->buffer_.size()});
+    }
 
     // draw gif emotes
     result.hasAnimatedElements =
-        this->container_.paintAnimatedElements(ctx.painter, ctx.y);
+        this->container_.paintAnimatedElements(ctx.painter, ctx.y,
+                                               ctx.animations);
 
     // draw disabled
     if (this->message_->flags.has(MessageFlag::Disabled))
     {
-        ctx.painter.fillRect(
-            QRect{
-                0,
-                ctx.y,
-                pixmap->width(),
-                pixmap->height(),
-            },
-            ctx.messageColors.disabled);
+        ctx.painter.fillRect(rect, ctx.messageColors.disabled);
     }
 
     if (this->message_->flags.has(MessageFlag::RecentMessage) &&
         ctx.preferences.fadeMessageHistory)
     {
-        ctx.painter.fillRect(
-            QRect{
-                0,
-                ctx.y,
-                pixmap->width(),
-                pixmap->height(),
-            },
-            ctx.messageColors.disabled);
+        ctx.painter.fillRect(rect, ctx.messageColors.disabled);
     }
 
     if (!ctx.isMentions &&
@@ -282,7 +311,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
                 0,
                 ctx.y,
                 static_cast<int>(this->scale_ * 4),
-                pixmap->height(),
+                rect.height(),
             },
             *ColorProvider::instance().color(ColorType::RedeemedHighlight));
     }
@@ -328,7 +357,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
             QRectF{
                 0,
                 ctx.y + this->container_.getHeight() - 1,
-                static_cast<qreal>(pixmap->width()),
+                static_cast<qreal>(rect.width()),
                 1,
             },
             brush);
@@ -339,41 +368,37 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
     return result;
 }
 
-QPixmap *MessageLayout::ensureBuffer(QPainter &painter, qreal width, bool clear)
+QPixmap *MessageLayout::ensureBuffer(QPainter &painter, int width, bool clear)
 {
-    if (this->buffer_ != nullptr)
+    auto dpr = painter.device()->devicePixelRatioF();
+    QSize size{
+        static_cast<int>(width * dpr),
+        static_cast<int>(this->container_.getHeight() * dpr),
+    };
+
+    // The pool might have taken the pixmap back in the meantime, or the
+    // window moved to a screen with a different scale
+    auto *pixmap = this->buffer_.pixmap();
+    if (pixmap != nullptr && this->buffer_.size() == size)
     {
-        return this->buffer_.get();
+        return pixmap;
     }
 
     // Create new buffer
-    this->buffer_ = std::make_unique<QPixmap>(
-        static_cast<int>(width * painter.device()->devicePixelRatioF()),
-        static_cast<int>(this->container_.getHeight() *
-                         painter.device()->devicePixelRatioF()));
-    this->buffer_->setDevicePixelRatio(painter.device()->devicePixelRatioF());
+    pixmap = this->buffer_.acquire(size, dpr);
 
     if (clear)
     {
-        this->buffer_->fill(Qt::transparent);
+        pixmap->fill(Qt::transparent);
     }
 
     this->bufferValid_ = false;
-    DebugCount::increase(DebugObject::MessageDrawingBuffer);
-    return this->buffer_.get();
+    return pixmap;
 }
 
-void MessageLayout::updateBuffer(QPixmap *buffer,
-                                 const MessagePaintContext &ctx)
+void MessageLayout::paintContents(QPainter &painter, QRect rect,
+                                  const MessagePaintContext &ctx)
 {
-    if (buffer->isNull())
-    {
-        return;
-    }
-
-    QPainter painter(buffer);
-    painter.setRenderHint(QPainter::SmoothPixmapTransform);
-
     // draw background
     QColor backgroundColor = [&] {
         if (ctx.preferences.alternateMessages &&
@@ -464,7 +489,7 @@ void MessageLayout::updateBuffer(QPixmap *buffer,
             backgroundColor, *ctx.colorProvider.color(ColorType::Subscription));
     }
 
-    painter.fillRect(buffer->rect(), backgroundColor);
+    painter.fillRect(rect, backgroundColor);
 
     // draw message
     this->container_.paintElements(painter, ctx);
@@ -472,8 +497,7 @@ void MessageLayout::updateBuffer(QPixmap *buffer,
 #ifdef FOURTF
     // debug
     painter.setPen(QColor(255, 0, 0));
-    painter.drawRect(buffer->rect().x(), buffer->rect().y(),
-                     buffer->rect().width() - 1, buffer->rect().height() - 1);
+    painter.drawRect(rect.x(), rect.y(), rect.width() - 1, rect.height() - 1);
 
     QTextOption option;
     option.setAlignment(Qt::AlignRight | Qt::AlignTop);
@@ -492,12 +516,7 @@ void MessageLayout::invalidateBuffer()
 
 void MessageLayout::deleteBuffer()
 {
-    if (this->buffer_ != nullptr)
-    {
-        DebugCount::decrease(DebugObject::MessageDrawingBuffer);
-
-        this->buffer_ = nullptr;
-    }
+    this->buffer_.release();
 }
 
 void MessageLayout::deleteCache()
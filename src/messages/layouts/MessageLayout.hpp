@@ -6,6 +6,8 @@
 
 #include "common/Common.hpp"
 #include "common/FlagsEnum.hpp"
+#include "messages/MessageFlag.hpp"
+#include "messages/layouts/MessageBufferPool.hpp"
 #include "messages/layouts/MessageLayoutContainer.hpp"
 
 #include <QPixmap>
@@ -118,23 +120,34 @@ public:
 private:
     // methods
     void actuallyLayout(const MessageLayoutContext &ctx);
-    void updateBuffer(QPixmap *buffer, const MessagePaintContext &ctx);
+    /// Paints the background and the elements of the message into `rect`
+    /// (relative to the painter)
+    void paintContents(QPainter &painter, QRect rect,
+                       const MessagePaintContext &ctx);
 
     // Create new buffer if required, returning the buffer
-    QPixmap *ensureBuffer(QPainter &painter, qreal width, bool clear);
+    QPixmap *ensureBuffer(QPainter &painter, int width, bool clear);
 
     // variables
     const MessagePtr message_;
     MessageLayoutContainer container_;
-    std::unique_ptr<QPixmap> buffer_;
+    MessageBuffer buffer_;
     bool bufferValid_ = false;
 
     qreal height_ = 0;
     int currentLayoutWidth_ = -1;
     int layoutState_ = -1;
+    /// The image generation at the time of the last layout. Only checked if
+    /// the layout contained images that were still loading.
+    size_t imageGeneration_ = 0;
+    bool hasUnloadedImages_ = false;
     float scale_ = -1;
     float imageScale_ = -1.F;
     MessageElementFlags currentWordFlags_;
+    /// The flags of the message at the time of the last layout. Messages are
+    /// changed in place (e.g. when they're disabled), so only the layouts of
+    /// changed messages have to be redone.
+    MessageFlags layoutMessageFlags_;
 
 #ifdef FOURTF
     // Debug counters
@@ -20,6 +20,7 @@
 #include <QPainter>
 #include <QVarLengthArray>
 
+#include <algorithm>
 #include <optional>
 
 namespace {
@@ -56,11 +57,13 @@ void MessageLayoutContainer::beginLayout(qreal width, float scale,
     this->scale_ = scale;
     this->imageScale_ = imageScale;
     this->flags_ = flags;
-    auto mediumFontMetrics =
-        getApp()->getFonts()->getFontMetrics(FontStyle::ChatMedium, scale);
-    this->textLineHeight_ = mediumFontMetrics.height();
-    this->spaceWidth_ = mediumFontMetrics.horizontalAdvance(' ');
-    this->dotdotdotWidth_ = mediumFontMetrics.horizontalAdvance("...");
+    auto *fonts = getApp()->getFonts();
+    this->textLineHeight_ =
+        fonts->getFontMetrics(FontStyle::ChatMedium, scale).height();
+    this->spaceWidth_ = fonts->getTextWidth(FontStyle::ChatMedium, scale,
+                                            QStringLiteral(" "));
+    this->dotdotdotWidth_ = fonts->getTextWidth(FontStyle::ChatMedium, scale,
+                                                QStringLiteral("..."));
     this->currentWordId_ = 0;
     this->canAddMessages_ = true;
     this->isCollapsed_ = false;
@@ -265,17 +268,33 @@ void MessageLayoutContainer::paintElements(QPainter &painter,
     }
 }
 
-bool MessageLayoutContainer::paintAnimatedElements(QPainter &painter,
-                                                   qreal yOffset) const
+bool MessageLayoutContainer::paintAnimatedElements(
+    QPainter &painter, qreal yOffset, AnimationTracker *tracker) const
 {
     bool anyAnimatedElement = false;
     for (const auto &element : this->elements_)
     {
-        anyAnimatedElement |= element->paintAnimated(painter, yOffset);
+        if (!element->paintAnimated(painter, yOffset))
+        {
+            continue;
+        }
+
+        anyAnimatedElement = true;
+        if (tracker != nullptr)
+        {
+            element->collectAnimatedImages(*tracker, yOffset);
+        }
     }
     return anyAnimatedElement;
 }
 
+bool MessageLayoutContainer::hasUnloadedImages() const
+{
+    return std::ranges::any_of(this->elements_, [](const auto &element) {
+        return element->hasUnloadedImage();
+    });
+}
+
 void MessageLayoutContainer::paintSelection(QPainter &painter,
                                             const size_t messageIndex,
                                             const Selection &selection,
@@ -29,6 +29,7 @@ enum class TextDirection : uint8_t {
     LTR,
 };
 
+class AnimationTracker;
 class MessageLayoutElement;
 struct Selection;
 struct MessagePaintContext;
@@ -75,9 +76,17 @@ struct MessageLayoutContainer {
 
     /**
      * Paint the animated elements in this message
+     * @param tracker If set, the painted animated images are added to it
      * @returns true if this container contains at least one animated element
      */
-    bool paintAnimatedElements(QPainter &painter, qreal yOffset) const;
+    bool paintAnimatedElements(QPainter &painter, qreal yOffset,
+                               AnimationTracker *tracker = nullptr) const;
+
+    /**
+     * @returns true if any element in this container shows an image that
+     *          hasn't finished loading
+     */
+    bool hasUnloadedImages() const;
 
     /**
      * Paint the selection for this container
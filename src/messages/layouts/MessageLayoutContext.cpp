@@ -103,6 +103,12 @@ void MessagePreferences::connectSettings(Settings *settings,
         },
         holder);
 
+    settings->messageBufferDirectPaintMaxHeight.connect(
+        [this](const auto &newValue) {
+            this->directPaintMaxHeight = newValue;
+        },
+        holder);
+
     settings->lastMessageColor.connect(
         [this](const auto &newValue) {
             if (newValue.isEmpty())
@@ -15,6 +15,7 @@ class SignalHolder;
 
 namespace chatterino {
 
+class AnimationTracker;
 class ColorProvider;
 class Theme;
 class Settings;
@@ -63,6 +64,9 @@ struct MessagePreferences {
 
     bool fadeMessageHistory{};
 
+    /// Messages up to this height are painted without a buffer
+    int directPaintMaxHeight{};
+
     void connectSettings(Settings *settings,
                          pajlada::Signals::SignalHolder &holder);
 };
@@ -89,6 +93,9 @@ struct MessagePaintContext {
     size_t messageIndex{};
 
     bool isLastReadMessage{};
+
+    // if set, the animated images that are painted are recorded here
+    AnimationTracker *animations{};
 };
 
 struct MessageLayoutContext {
@@ -7,6 +7,7 @@
 #include "Application.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
+#include "messages/layouts/AnimationTracker.hpp"
 #include "messages/layouts/MessageLayoutContext.hpp"
 #include "messages/MessageElement.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
@@ -16,6 +17,8 @@
 #include <QPainter>
 #include <QPainterPath>
 
+#include <algorithm>
+
 namespace {
 
 const QChar RTL_EMBED(0x202B);
@@ -106,6 +109,16 @@ const QString &MessageLayoutElement::getText() const
     return this->text_;
 }
 
+bool MessageLayoutElement::hasUnloadedImage() const
+{
+    return false;
+}
+
+void MessageLayoutElement::collectAnimatedImages(
+    AnimationTracker & /*tracker*/, qreal /*yOffset*/) const
+{
+}
+
 FlagsEnum<MessageElementFlag> MessageLayoutElement::getFlags() const
 {
     return this->creator_.getFlags();
@@ -212,6 +225,25 @@ qreal ImageLayoutElement::getXFromIndex(size_t index)
     }
 }
 
+bool ImageLayoutElement::hasUnloadedImage() const
+{
+    return this->image_ != nullptr && !this->image_->isEmpty() &&
+           !this->image_->loaded();
+}
+
+void ImageLayoutElement::collectAnimatedImages(AnimationTracker &tracker,
+                                               qreal yOffset) const
+{
+    if (this->image_ == nullptr || !this->image_->animated())
+    {
+        return;
+    }
+
+    auto rect = this->getRect();
+    rect.moveTop(rect.y() + yOffset);
+    tracker.add(this->image_, rect.toAlignedRect());
+}
+
 //
 // LAYERED IMAGE
 //
@@ -341,6 +373,28 @@ qreal LayeredImageLayoutElement::getXFromIndex(size_t index)
     }
 }
 
+bool LayeredImageLayoutElement::hasUnloadedImage() const
+{
+    return std::ranges::any_of(this->images_, [](const auto &image) {
+        return image != nullptr && !image->isEmpty() && !image->loaded();
+    });
+}
+
+void LayeredImageLayoutElement::collectAnimatedImages(
+    AnimationTracker &tracker, qreal yOffset) const
+{
+    // Animated layers repaint the whole element (see paintAnimated)
+    auto fullRect = this->getRect();
+    fullRect.moveTop(fullRect.y() + yOffset);
+    for (const auto &image : this->images_)
+    {
+        if (image != nullptr && image->animated())
+        {
+            tracker.add(image, fullRect.toAlignedRect());
+        }
+    }
+}
+
 //
 // IMAGE WITH BACKGROUND
 //
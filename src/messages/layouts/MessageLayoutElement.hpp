@@ -19,6 +19,7 @@
 class QPainter;
 
 namespace chatterino {
+class AnimationTracker;
 class MessageElement;
 class Image;
 using ImagePtr = std::shared_ptr<Image>;
@@ -63,9 +64,16 @@ public:
                        const MessageColors &messageColors) = 0;
     /// @returns true if anything was painted
     virtual bool paintAnimated(QPainter &painter, qreal yOffset) = 0;
+    /// Adds the animated images painted by paintAnimated() to `tracker`
+    virtual void collectAnimatedImages(AnimationTracker &tracker,
+                                       qreal yOffset) const;
     virtual int getMouseOverIndex(QPointF abs) const = 0;
     virtual qreal getXFromIndex(size_t index) = 0;
 
+    /// @returns true if this element shows an image that hasn't been
+    ///          decoded yet (the layout needs to be redone once it is)
+    virtual bool hasUnloadedImage() const;
+
     /// @brief Returns the link this layout element has
     ///
     /// If there isn't any, an empty link is returned (type: None).
@@ -113,6 +121,9 @@ protected:
     bool paintAnimated(QPainter &painter, qreal yOffset) override;
     int getMouseOverIndex(QPointF abs) const override;
     qreal getXFromIndex(size_t index) override;
+    bool hasUnloadedImage() const override;
+    void collectAnimatedImages(AnimationTracker &tracker,
+                               qreal yOffset) const override;
 
     ImagePtr image_;
 };
@@ -132,6 +143,9 @@ protected:
     bool paintAnimated(QPainter &painter, qreal yOffset) override;
     int getMouseOverIndex(QPointF abs) const override;
     qreal getXFromIndex(size_t index) override;
+    bool hasUnloadedImage() const override;
+    void collectAnimatedImages(AnimationTracker &tracker,
+                               qreal yOffset) const override;
 
     std::vector<ImagePtr> images_;
     std::vector<QSizeF> sizes_;
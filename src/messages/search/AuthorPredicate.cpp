@@ -25,4 +25,15 @@ bool AuthorPredicate::appliesToImpl(const Message &message)
            this->authors_.contains(message.loginName, Qt::CaseInsensitive);
 }
 
+std::optional<MessageIndex::Postings> AuthorPredicate::lookupImpl(
+    const MessageIndex &index) const
+{
+    MessageIndex::Postings result;
+    for (const auto &author : this->authors_)
+    {
+        result = MessageIndex::unite(result, index.author(author));
+    }
+    return result;
+}
+
 }  // namespace chatterino
@@ -39,6 +39,12 @@ protected:
      */
     bool appliesToImpl(const Message &message) override;
 
+    /**
+     * @brief Looks up the messages authored by any of the users.
+     */
+    std::optional<MessageIndex::Postings> lookupImpl(
+        const MessageIndex &index) const override;
+
 private:
     /// Holds the user names that will be searched for
     QStringList authors_;
@@ -48,4 +48,15 @@ bool BadgePredicate::appliesToImpl(const Message &message)
     return false;
 }
 
+std::optional<MessageIndex::Postings> BadgePredicate::lookupImpl(
+    const MessageIndex &index) const
+{
+    MessageIndex::Postings result;
+    for (const auto &badge : this->badges_)
+    {
+        result = MessageIndex::unite(result, index.badge(badge));
+    }
+    return result;
+}
+
 }  // namespace chatterino
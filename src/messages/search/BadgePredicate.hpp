@@ -39,6 +39,12 @@ protected:
      */
     bool appliesToImpl(const Message &message) override;
 
+    /**
+     * @brief Looks up the messages containing any of the badges.
+     */
+    std::optional<MessageIndex::Postings> lookupImpl(
+        const MessageIndex &index) const override;
+
 private:
     /// Holds the badges that will be searched for
     QStringList badges_;
@@ -15,6 +15,17 @@ LinkPredicate::LinkPredicate(bool negate)
 }
 
 bool LinkPredicate::appliesToImpl(const Message &message)
+{
+    return containsLink(message);
+}
+
+std::optional<MessageIndex::Postings> LinkPredicate::lookupImpl(
+    const MessageIndex &index) const
+{
+    return index.links();
+}
+
+bool LinkPredicate::containsLink(const Message &message)
 {
     for (const auto &word : message.messageText.split(' ', Qt::SkipEmptyParts))
     {
@@ -25,6 +25,14 @@ public:
     */
     LinkPredicate(bool negate);
 
+    /**
+     * @brief Checks whether the message contains a link.
+     *
+     * @param message the message to check
+     * @return true if the message contains a link, false otherwise
+     */
+    static bool containsLink(const Message &message);
+
 protected:
     /**
      * @brief Checks whether the message contains a link.
@@ -33,6 +41,12 @@ protected:
      * @return true if the message contains a link, false otherwise
      */
     bool appliesToImpl(const Message &message) override;
+
+    /**
+     * @brief Looks up the messages containing a link.
+     */
+    std::optional<MessageIndex::Postings> lookupImpl(
+        const MessageIndex &index) const override;
 };
 
 }  // namespace chatterino
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/search/MessageIndex.hpp"
+
+#include "messages/Message.hpp"
+#include "messages/search/LinkPredicate.hpp"
+#include "providers/twitch/TwitchBadge.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <numeric>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr qsizetype TRIGRAM_LENGTH = 3;
+
+/// Once this many more messages were removed than there are left, the
+/// removed positions are dropped from all lists.
+constexpr size_t COMPACT_SLACK = 1024;
+
+uint64_t trigramAt(QStringView text, qsizetype i)
+{
+    return (static_cast<uint64_t>(text[i].unicode()) << 32) |
+           (static_cast<uint64_t>(text[i + 1].unicode()) << 16) |
+           static_cast<uint64_t>(text[i + 2].unicode());
+}
+
+template <typename Map>
+void compactMap(Map &map, uint32_t first)
+{
+    for (auto it = map.begin(); it != map.end();)
+    {
+        auto &list = it.value();
+        list.erase(list.begin(), std::ranges::lower_bound(list, first));
+        if (list.empty())
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void MessageIndex::append(MessagePtr message)
+{
+    auto position =
+        this->first_ + static_cast<uint32_t>(this->messages_.size());
+
+    auto folded = message->searchText.toCaseFolded();
+    for (qsizetype i = 0; i + TRIGRAM_LENGTH <= folded.size(); i++)
+    {
+        this->add(this->trigrams_[trigramAt(folded, i)], position);
+    }
+
+    for (const auto *name : {&message->displayName, &message->loginName})
+    {
+        if (!name->isEmpty())
+        {
+            this->add(this->authors_[name->toCaseFolded()], position);
+        }
+    }
+
+    for (const auto &badge : message->twitchBadges)
+    {
+        this->add(this->badges_[badge.key_.toCaseFolded()], position);
+    }
+
+    if (LinkPredicate::containsLink(*message))
+    {
+        this->links_.push_back(position);
+    }
+
+    this->messages_.push_back(std::move(message));
+}
+
+void MessageIndex::removeFront(size_t n)
+{
+    n = std::min(n, this->messages_.size());
+    this->messages_.erase(this->messages_.begin(),
+                          this->messages_.begin() + static_cast<ptrdiff_t>(n));
+    this->first_ += static_cast<uint32_t>(n);
+    this->removed_ += n;
+
+    if (this->removed_ > this->messages_.size() + COMPACT_SLACK)
+    {
+        this->compact();
+    }
+}
+
+size_t MessageIndex::size() const
+{
+    return this->messages_.size();
+}
+
+std::optional<MessageIndex::Postings> MessageIndex::substring(
+    QStringView text) const
+{
+    auto folded = text.toString().toCaseFolded();
+    if (folded.size() < TRIGRAM_LENGTH)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<const Postings *> lists;
+    for (qsizetype i = 0; i + TRIGRAM_LENGTH <= folded.size(); i++)
+    {
+        auto it = this->trigrams_.constFind(trigramAt(folded, i));
+        if (it == this->trigrams_.cend())
+        {
+            return Postings{};
+        }
+        lists.push_back(&it.value());
+    }
+
+    // Start with the rarest trigram to keep the intermediate results small
+    std::ranges::sort(lists, {}, &Postings::size);
+    auto [first, last] = std::ranges::unique(lists);
+    lists.erase(first, last);
+
+    auto result = this->live(lists.front());
+    for (size_t i = 1; i < lists.size() && !result.empty(); i++)
+    {
+        result = intersect(result, *lists[i]);
+    }
+    return result;
+}
+
+MessageIndex::Postings MessageIndex::author(QStringView name) const
+{
+    auto it = this->authors_.constFind(name.toString().toCaseFolded());
+    return this->live(it == this->authors_.cend() ? nullptr : &it.value());
+}
+
+MessageIndex::Postings MessageIndex::badge(QStringView key) const
+{
+    auto it = this->badges_.constFind(key.toString().toCaseFolded());
+    return this->live(it == this->badges_.cend() ? nullptr : &it.value());
+}
+
+MessageIndex::Postings MessageIndex::links() const
+{
+    return this->live(&this->links_);
+}
+
+MessageIndex::Postings MessageIndex::all() const
+{
+    Postings positions(this->messages_.size());
+    std::iota(positions.begin(), positions.end(), this->first_);
+    return positions;
+}
+
+std::vector<MessagePtr> MessageIndex::messages(const Postings &positions) const
+{
+    std::vector<MessagePtr> result;
+    result.reserve(positions.size());
+    for (auto position : positions)
+    {
+        assert(position >= this->first_ &&
+               position - this->first_ < this->messages_.size());
+        result.push_back(this->messages_[position - this->first_]);
+    }
+    return result;
+}
+
+MessageIndex::Postings MessageIndex::intersect(const Postings &a,
+                                               const Postings &b)
+{
+    Postings result;
+    std::ranges::set_intersection(a, b, std::back_inserter(result));
+    return result;
+}
+
+MessageIndex::Postings MessageIndex::unite(const Postings &a,
+                                           const Postings &b)
+{
+    Postings result;
+    std::ranges::set_union(a, b, std::back_inserter(result));
+    return result;
+}
+
+MessageIndex::Postings MessageIndex::live(const Postings *list) const
+{
+    if (!list)
+    {
+        return {};
+    }
+    return {std::ranges::lower_bound(*list, this->first_), list->end()};
+}
+
+void MessageIndex::add(Postings &list, uint32_t position)
+{
+    // a message can contain the same trigram multiple times
+    if (list.empty() || list.back() != position)
+    {
+        list.push_back(position);
+    }
+}
+
+void MessageIndex::compact()
+{
+    compactMap(this->trigrams_, this->first_);
+    compactMap(this->authors_, this->first_);
+    compactMap(this->badges_, this->first_);
+    this->links_.erase(this->links_.begin(),
+                       std::ranges::lower_bound(this->links_, this->first_));
+    this->removed_ = 0;
+}
+
+}  // namespace chatterino
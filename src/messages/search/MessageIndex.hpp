@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ForwardDecl.hpp"
+
+#include <QHash>
+#include <QString>
+#include <QStringView>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace chatterino {
+
+/**
+ * @brief Inverted index over the messages of a search
+ *
+ * Messages are numbered in the order they're appended. For each trigram of
+ * the (case-folded) search text, author and badge, the index keeps a sorted
+ * list of the positions of the messages containing it. Predicates use these
+ * lists to find the messages they could apply to without looking at every
+ * message.
+ *
+ * The index is updated incrementally: new messages are appended at the end
+ * and old messages are removed from the start.
+ */
+class MessageIndex
+{
+public:
+    /// Sorted positions of messages
+    using Postings = std::vector<uint32_t>;
+
+    void append(MessagePtr message);
+
+    /// Removes the `n` oldest messages
+    void removeFront(size_t n);
+
+    size_t size() const;
+
+    /// Positions of messages whose search text could contain `text`
+    /// (case-insensitive). std::nullopt if `text` is too short to be looked
+    /// up.
+    std::optional<Postings> substring(QStringView text) const;
+
+    /// Positions of messages whose display or login name is `name`
+    /// (case-insensitive)
+    Postings author(QStringView name) const;
+
+    /// Positions of messages that have a Twitch badge with the key `key`
+    /// (case-insensitive)
+    Postings badge(QStringView key) const;
+
+    /// Positions of messages that contain a link
+    Postings links() const;
+
+    /// Positions of all messages
+    Postings all() const;
+
+    /// Returns the messages at the given positions
+    std::vector<MessagePtr> messages(const Postings &positions) const;
+
+    static Postings intersect(const Postings &a, const Postings &b);
+    static Postings unite(const Postings &a, const Postings &b);
+
+private:
+    /// Returns the positions in `list` that weren't removed yet
+    Postings live(const Postings *list) const;
+
+    void add(Postings &list, uint32_t position);
+    void compact();
+
+    std::deque<MessagePtr> messages_;
+    /// Position of the first message in `messages_`
+    uint32_t first_ = 0;
+    /// Messages removed since the last compaction
+    size_t removed_ = 0;
+
+    QHash<uint64_t, Postings> trigrams_;
+    QHash<QString, Postings> authors_;
+    QHash<QString, Postings> badges_;
+    Postings links_;
+};
+
+}  // namespace chatterino
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include "messages/search/MessageIndex.hpp"
+
 #include <memory>
+#include <optional>
 
 namespace chatterino {
 
@@ -42,6 +45,27 @@ public:
         return result;
     }
 
+    /**
+     * @brief Looks up the messages this predicate could apply to in an index
+     *
+     * The result is a superset of the messages this predicate applies to, so
+     * callers still have to check each message with `appliesTo`.
+     *
+     * @param index the index to look the messages up in
+     * @return the positions of the messages in the index, or std::nullopt if
+     *         this predicate can't be resolved by the index
+     **/
+    std::optional<MessageIndex::Postings> lookup(
+        const MessageIndex &index) const
+    {
+        // The index only knows which messages have a feature, not which don't
+        if (this->isNegated_)
+        {
+            return std::nullopt;
+        }
+        return this->lookupImpl(index);
+    }
+
 protected:
     explicit MessagePredicate(bool negate)
         : isNegated_(negate)
@@ -59,6 +83,23 @@ protected:
      */
     virtual bool appliesToImpl(const Message &message) = 0;
 
+    /**
+     * @brief Looks up the messages this predicate could apply to in an index
+     *
+     * Predicates that can't be resolved by the index don't need to override
+     * this.
+     *
+     * @param index the index to look the messages up in
+     * @return the positions of the messages in the index, or std::nullopt if
+     *         this predicate can't be resolved by the index
+     */
+    virtual std::optional<MessageIndex::Postings> lookupImpl(
+        const MessageIndex &index) const
+    {
+        (void)index;
+        return std::nullopt;
+    }
+
 private:
     const bool isNegated_ = false;
 };
@@ -19,4 +19,10 @@ bool SubstringPredicate::appliesToImpl(const Message &message)
     return message.searchText.contains(this->search_, Qt::CaseInsensitive);
 }
 
+std::optional<MessageIndex::Postings> SubstringPredicate::lookupImpl(
+    const MessageIndex &index) const
+{
+    return index.substring(this->search_);
+}
+
 }  // namespace chatterino
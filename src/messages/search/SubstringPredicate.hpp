@@ -40,6 +40,12 @@ protected:
      */
     bool appliesToImpl(const Message &message) override;
 
+    /**
+     * @brief Looks up the messages containing all trigrams of the substring.
+     */
+    std::optional<MessageIndex::Postings> lookupImpl(
+        const MessageIndex &index) const override;
+
 private:
     /// Holds the substring to search for in a message's `messageText`
     const QString search_;
@@ -341,7 +341,8 @@ EmotePtr BttvEmotes::addEmote(
     Atomic<std::shared_ptr<const EmoteMap>> &channelEmoteMap,
     const BttvLiveUpdateEmoteUpdateAddMessage &message)
 {
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *channelEmoteMap.get();
     auto result = createChannelEmote(channelDisplayName, message.jsonEmote);
 
@@ -357,15 +358,14 @@ std::optional<std::pair<EmotePtr, EmotePtr>> BttvEmotes::updateEmote(
     Atomic<std::shared_ptr<const EmoteMap>> &channelEmoteMap,
     const BttvLiveUpdateEmoteUpdateAddMessage &message)
 {
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *channelEmoteMap.get();
 
     // Step 1: remove the existing emote
     auto it = updatedMap.findEmote(QString(), message.emoteID);
     if (it == updatedMap.end())
     {
-        // We already copied the map at this point and are now discarding the copy.
-        // This is fine, because this case should be really rare.
         return std::nullopt;
     }
     auto oldEmotePtr = it->second;
@@ -392,13 +392,12 @@ std::optional<EmotePtr> BttvEmotes::removeEmote(
     Atomic<std::shared_ptr<const EmoteMap>> &channelEmoteMap,
     const BttvLiveUpdateEmoteRemoveMessage &message)
 {
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *channelEmoteMap.get();
     auto it = updatedMap.findEmote(QString(), message.emoteID);
     if (it == updatedMap.end())
     {
-        // We already copied the map at this point and are now discarding the copy.
-        // This is fine, because this case should be really rare.
         return std::nullopt;
     }
     auto emote = it->second;
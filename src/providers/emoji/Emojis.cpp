@@ -166,13 +166,20 @@ void Emojis::load()
     }
     this->loaded_ = true;
 
-    this->loadEmojis();
-
-    this->sortEmojis();
+    this->loadData();
 
     this->loadEmojiSet();
 }
 
+void Emojis::loadData()
+{
+    std::call_once(this->dataLoaded_, [this] {
+        this->loadEmojis();
+
+        this->sortEmojis();
+    });
+}
+
 void Emojis::loadEmojis()
 {
     // Current version: https://github.com/Nerixyz/emoji-data/blob/feat/17-0/emoji.json (Emoji version 17.0 (2025))
@@ -183,10 +190,11 @@ void Emojis::loadEmojis()
         qCWarning(chatterinoEmoji) << "Resources not available";
         return;
     }
-    QTextStream s1(&file);
-    QString data = s1.readAll();
+    // parse the UTF-8 directly instead of decoding it to a QString first
+    QByteArray data = file.readAll();
     rapidjson::Document root;
-    rapidjson::ParseResult result = root.Parse(data.toUtf8(), data.length());
+    rapidjson::ParseResult result =
+        root.Parse(data.constData(), static_cast<size_t>(data.size()));
 
     if (result.Code() != rapidjson::kParseErrorNone)
     {
@@ -12,6 +12,7 @@
 #include <QVector>
 
 #include <memory>
+#include <mutex>
 #include <variant>
 #include <vector>
 
@@ -65,6 +66,11 @@ class Emojis : public IEmojis
 {
 public:
     void load();
+    /// Parses the bundled emoji data. This is the slow part of load() and
+    /// doesn't use any settings, so it can run on a background thread before
+    /// load() is called.
+    void loadData();
+
     std::vector<std::variant<EmotePtr, QStringView>> parse(
         QStringView text) const override;
 
@@ -91,6 +97,7 @@ private:
     // possible emojis
     QMap<QChar, QVector<std::shared_ptr<EmojiData>>> emojiFirstByte_;
 
+    std::once_flag dataLoaded_;
     bool loaded_ = false;
 };
 
@@ -68,9 +68,11 @@ public:
     using Subscription = ClientT::Subscription;
     using Client = ClientT;
 
-    BasicPubSubManager(QString host, QString shortName)
+    BasicPubSubManager(QString host, QString shortName,
+                       WebSocketCompression compression = {})
         : pool_(std::make_optional<WebSocketPool>(shortName))
         , host_(std::move(host))
+        , compression_(compression)
     {
         // We do this here, because `Derived` needs to be a complete type. If we
         // did it as a requires clause on the class, the type would be
@@ -90,7 +92,7 @@ public:
     BasicPubSubManager &operator=(const BasicPubSubManager &) = delete;
     BasicPubSubManager &operator=(const BasicPubSubManager &&) = delete;
 
-    /** This is only used for testing. */
+    /** Connection statistics. This is mostly used for testing. */
     liveupdates::Diag diag;
 
     void stop()
@@ -265,6 +267,8 @@ private:
             WebSocketOptions{
                 .url = this->host_,
                 .headers = {},
+                .compression = this->compression_,
+                .traffic = this->diag.traffic,
             },
             std::make_unique<BasicPubSubListener<Derived>>(
                 std::weak_ptr{client}, this->derived(), id));
@@ -302,6 +306,7 @@ private:
     std::unordered_map<size_t, std::shared_ptr<Client>> clients_;
 
     const QString host_;
+    const WebSocketCompression compression_;
 
     size_t nextId_ = 0;
 
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include "common/websockets/WebSocketPool.hpp"
+
 #include <atomic>
+#include <memory>
 
 namespace chatterino::liveupdates {
 
@@ -12,6 +15,10 @@ struct Diag {
     std::atomic<uint32_t> connectionsClosed{0};
     std::atomic<uint32_t> connectionsOpened{0};
     std::atomic<uint32_t> connectionsFailed{0};
+
+    /// Traffic of all connections
+    std::shared_ptr<WebSocketTraffic> traffic =
+        std::make_shared<WebSocketTraffic>();
 };
 
 }  // namespace chatterino::liveupdates
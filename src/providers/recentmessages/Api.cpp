@@ -8,14 +8,103 @@
 #include "common/network/NetworkRequest.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/QLogging.hpp"
+#include "debug/AssertInGuiThread.hpp"
 #include "providers/recentmessages/Impl.hpp"
 #include "util/PostToThread.hpp"
 
+#include <QCoreApplication>
+#include <QTimer>
+
+#include <deque>
+#include <functional>
+
 namespace {
 
+using namespace chatterino;
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 const auto &LOG = chatterinoRecentMessages;
 
+/// Maximum number of channels whose history is loaded at the same time
+constexpr size_t MAX_CONCURRENT_LOADS = 4;
+
+/// Limits how many histories are requested and built at the same time.
+///
+/// When many channels are joined at startup, the others wait here instead of
+/// competing for the network and the thread pool. This way, the first
+/// channels are filled quickly.
+/// Only accessed from the GUI thread.
+class LoadQueue
+{
+public:
+    static LoadQueue &instance()
+    {
+        static LoadQueue queue;
+        return queue;
+    }
+
+    /// Runs `load` once fewer than MAX_CONCURRENT_LOADS are running. Every
+    /// load must call `finish` when it's done.
+    void run(std::function<void()> load)
+    {
+        assertInGuiThread();
+
+        if (this->running_ < MAX_CONCURRENT_LOADS)
+        {
+            this->running_++;
+            load();
+            return;
+        }
+        this->waiting_.push_back(std::move(load));
+    }
+
+    void finish()
+    {
+        assertInGuiThread();
+
+        if (this->waiting_.empty())
+        {
+            assert(this->running_ > 0);
+            this->running_--;
+            return;
+        }
+
+        // the finished load passes its place on to the next one
+        auto next = std::move(this->waiting_.front());
+        this->waiting_.pop_front();
+        next();
+    }
+
+private:
+    size_t running_ = 0;
+    std::deque<std::function<void()>> waiting_;
+};
+
+/// Finishes a load of the LoadQueue once it's destroyed.
+///
+/// The callbacks of a request share it, so the load finishes after the
+/// result was delivered.
+class LoadSlot
+{
+public:
+    LoadSlot() = default;
+    ~LoadSlot()
+    {
+        if (isAppAboutToQuit())
+        {
+            return;
+        }
+        postToThread([] {
+            LoadQueue::instance().finish();
+        });
+    }
+
+    LoadSlot(const LoadSlot &) = delete;
+    LoadSlot(LoadSlot &&) = delete;
+    LoadSlot &operator=(const LoadSlot &) = delete;
+    LoadSlot &operator=(LoadSlot &&) = delete;
+};
+
 }  // namespace
 
 namespace chatterino::recentmessages {
@@ -43,30 +132,56 @@ void load(
             return;
         }
 
-        NetworkRequest(url)
-            .onSuccess([channelPtr, onLoaded](const auto &result) {
-                assert(!isAppAboutToQuit());
-
-                auto shared = channelPtr.lock();
-                if (!shared)
-                {
-                    return;
-                }
-
-                qCDebug(LOG) << "Successfully loaded recent messages for"
-                             << shared->getName();
-
-                auto root = result.parseJson();
-                auto parsedMessages = parseRecentMessages(root);
-
-                // build the Communi messages into chatterino messages
-                auto builtMessages =
-                    buildRecentMessages(parsedMessages, shared.get());
+        LoadQueue::instance().run([=] {
+            auto slot = std::make_shared<LoadSlot>();
+            if (isAppAboutToQuit() || channelPtr.expired())
+            {
+                return;
+            }
+
+            // The response is parsed on the thread pool. The builder reads
+            // state that's owned by the GUI thread (e.g. highlights and
+            // emotes), so the messages are built there.
+            NetworkRequest(url)
+                .concurrent()
+                .onSuccess([channelPtr, onLoaded, slot](const auto &result) {
+                    if (isAppAboutToQuit())
+                    {
+                        return;
+                    }
+
+                    auto shared = channelPtr.lock();
+                    if (!shared)
+                    {
+                        return;
+                    }
+
+                    qCDebug(LOG) << "Successfully loaded recent messages for"
+                                 << shared->getName();
+
+                    auto root = result.parseJson();
+                    auto parsedMessages = parseRecentMessages(root);
+
+                    // The messages are deleted (later) on the GUI thread
+                    for (auto *message : parsedMessages)
+                    {
+                        message->moveToThread(
+                            QCoreApplication::instance()->thread());
+                    }
+
+                    // the channel must be released on the GUI thread as well
+                    postToThread([shared = std::move(shared),
+                                  root = std::move(root),
+                                  parsedMessages = std::move(parsedMessages),
+                                  onLoaded, slot]() mutable {
+                        if (isAppAboutToQuit())
+                        {
+                            return;
+                        }
 
-                postToThread(
-                    [shared = std::move(shared), root = std::move(root),
-                     messages = std::move(builtMessages), onLoaded]() mutable {
-                        assert(!isAppAboutToQuit());
+                        // build the Communi messages into chatterino messages
+                        auto messages =
+                            buildRecentMessages(parsedMessages, shared.get());
 
                         // Notify user about a possible gap in logs if it returned some messages
                         // but isn't currently joined to a channel
@@ -90,26 +205,30 @@ void load(
 
                         onLoaded(messages);
                     });
-            })
-            .onError([channelPtr, onError](const NetworkResult &result) {
-                auto shared = channelPtr.lock();
-                if (!shared)
-                {
-                    return;
-                }
-                assert(!isAppAboutToQuit());
-
-                qCDebug(LOG) << "Failed to load recent messages for"
-                             << shared->getName();
-
-                shared->addSystemMessage(
-                    QStringLiteral(
-                        "Message history service unavailable (Error: %1)")
-                        .arg(result.formatError()));
-
-                onError();
-            })
-            .execute();
+                })
+                .onError([channelPtr, onError,
+                          slot](const NetworkResult &result) {
+                    postToThread([channelPtr, onError, slot,
+                                  error = result.formatError()] {
+                        auto shared = channelPtr.lock();
+                        if (!shared || isAppAboutToQuit())
+                        {
+                            return;
+                        }
+
+                        qCDebug(LOG) << "Failed to load recent messages for"
+                                     << shared->getName();
+
+                        shared->addSystemMessage(
+                            QStringLiteral("Message history service "
+                                           "unavailable (Error: %1)")
+                                .arg(error));
+
+                        onError();
+                    });
+                })
+                .execute();
+        });
     });
 }
 
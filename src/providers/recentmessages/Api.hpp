@@ -38,6 +38,10 @@ using ErrorCallback = std::function<void()>;
  * @param after Only return messages that were received after this timestamp; ignored if `std::nullopt`
  * @param before Only return messages that were received before this timestamp; ignored if `std::nullopt`
  * @param jitter Whether to delay the request by a small random duration
+ *
+ * The response is parsed on the thread pool and built on the GUI thread.
+ * Only a few histories are loaded at the same time, others wait until one of
+ * them is done.
  */
 void load(
     const QString &channelName, std::weak_ptr<Channel> channelPtr,
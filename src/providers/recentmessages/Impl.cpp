@@ -8,12 +8,36 @@
 #include "messages/MessageBuilder.hpp"
 #include "providers/twitch/IrcMessageHandler.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
+#include "providers/twitch/TwitchIrcLine.hpp"
 #include "util/Helpers.hpp"
 #include "util/VectorMessageSink.hpp"
 
 #include <QJsonArray>
 #include <QUrlQuery>
 
+namespace {
+
+using namespace chatterino;
+
+/// Returns true for the commands IrcMessageHandler::parseMessageInto builds
+/// messages from
+bool isBuiltFromHistory(TwitchIrcCommand command)
+{
+    switch (command)
+    {
+        case TwitchIrcCommand::Privmsg:
+        case TwitchIrcCommand::UserNotice:
+        case TwitchIrcCommand::Notice:
+        case TwitchIrcCommand::ClearChat:
+        case TwitchIrcCommand::ClearMsg:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
 namespace chatterino::recentmessages::detail {
 
 // Parse the IRC messages returned in JSON form into Communi messages
@@ -28,14 +52,21 @@ std::vector<Communi::IrcMessage *> parseRecentMessages(
         return messages;
     }
 
+    messages.reserve(jsonMessages.size());
     for (const auto jsonMessage : jsonMessages)
     {
-        auto content = unescapeZeroWidthJoiner(jsonMessage.toString());
+        auto content =
+            unescapeZeroWidthJoiner(jsonMessage.toString()).toUtf8();
 
-        auto *message =
-            Communi::IrcMessage::fromData(content.toUtf8(), nullptr);
+        // Communi parses all tags into a map, so skip the lines we wouldn't
+        // build a message from (e.g. ROOMSTATE) before that
+        auto line = TwitchIrcLine::parse(content);
+        if (!line || !isBuiltFromHistory(line->type()))
+        {
+            continue;
+        }
 
-        messages.emplace_back(message);
+        messages.emplace_back(Communi::IrcMessage::fromData(content, nullptr));
     }
 
     return messages;
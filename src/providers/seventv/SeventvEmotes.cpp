@@ -366,14 +366,15 @@ std::optional<EmotePtr> SeventvEmotes::addEmote(
     Atomic<std::shared_ptr<const EmoteMap>> &map,
     const EmoteAddDispatch &dispatch)
 {
-    // Check for visibility first, so we don't copy the map.
+    // Check for visibility first, so we don't touch the map.
     auto emoteData = dispatch.emoteJson["data"].toObject();
     if (emoteData.empty() || !checkEmoteVisibility(emoteData))
     {
         return std::nullopt;
     }
 
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *map.get();
     auto result = createEmote(dispatch.emoteJson, emoteData, false);
     if (!result.hasImages)
@@ -401,7 +402,8 @@ std::optional<EmotePtr> SeventvEmotes::updateEmote(
         return std::nullopt;
     }
 
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *map.get();
     updatedMap.erase(oldEmote->second->name);
 
@@ -416,13 +418,12 @@ std::optional<EmotePtr> SeventvEmotes::removeEmote(
     Atomic<std::shared_ptr<const EmoteMap>> &map,
     const EmoteRemoveDispatch &dispatch)
 {
-    // This copies the map.
+    // The copy shares its nodes with the old map, only the changed path is
+    // copied.
     EmoteMap updatedMap = *map.get();
     auto it = updatedMap.findEmote(dispatch.emoteName, dispatch.emoteID);
     if (it == updatedMap.end())
     {
-        // We already copied the map at this point and are now discarding the copy.
-        // This is fine, because this case should be really rare.
         return std::nullopt;
     }
     auto emote = it->second;
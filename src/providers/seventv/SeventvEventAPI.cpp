@@ -53,7 +53,13 @@ public:
 SeventvEventAPIPrivate::SeventvEventAPIPrivate(
     SeventvEventAPI &parent, QString host,
     std::chrono::milliseconds defaultHeartbeatInterval)
-    : BasicPubSubManager(std::move(host), u"7TV"_s)
+    // Dispatches are verbose JSON. We only send small messages, so we don't
+    // need to keep a compressor around.
+    : BasicPubSubManager(std::move(host), u"7TV"_s,
+                         {
+                             .enabled = true,
+                             .clientContextTakeover = false,
+                         })
     , heartbeatInterval(defaultHeartbeatInterval)
     , parent(parent)
 {
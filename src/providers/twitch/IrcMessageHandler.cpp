@@ -159,6 +159,61 @@ void checkThreadSubscription(Communi::TagsRef tags, const QString &senderLogin,
     }
 }
 
+/// Creates the arguments to build a message with. Queues channel point
+/// redemptions if the sink requires the reward to be known.
+MessageParseArgs makeParseArgs(Communi::IrcMessage *message,
+                               MessageSinkTraits sinkTraits,
+                               TwitchChannel *chan,
+                               const QString &originalContent,
+                               const AddMessageArgs &addArgs)
+{
+    MessageParseArgs args;
+    args.isSubscriptionMessage = addArgs.isSub;
+    if (addArgs.isSpecial)
+    {
+        args.trimSubscriberUsername = true;
+    }
+
+    args.isAction = addArgs.isAction;
+    args.allowIgnore = !addArgs.isSub;
+
+    auto tags = message->tags();
+    QString rewardId;
+    if (auto optRewardId = tags.get("custom-reward-id"))
+    {
+        rewardId = *std::move(optRewardId);
+    }
+    else if (auto optMsgId = tags.get("msg-id"))
+    {
+        // slight hack to treat bits power-ups as channel point redemptions
+        const auto msgId = *std::move(optMsgId);
+        if (msgId == "animated-message" || msgId == "gigantified-emote-message")
+        {
+            rewardId = msgId;
+        }
+    }
+    if (!rewardId.isEmpty() &&
+        sinkTraits.has(MessageSinkTrait::RequiresKnownChannelPointReward) &&
+        !chan->isChannelPointRewardKnown(rewardId))
+    {
+        // Need to wait for pubsub reward notification
+        qCDebug(chatterinoTwitch) << "TwitchChannel reward added ADD "
+                                     "callback since reward is not known:"
+                                  << rewardId;
+        chan->addQueuedRedemption(rewardId, originalContent, message);
+    }
+    args.channelPointRewardId = rewardId;
+
+    return args;
+}
+
+/// Replies are resolved against the messages of a channel
+bool isReply(Communi::TagsRef tags)
+{
+    return tags.has("reply-parent-msg-id") ||
+           tags.has("reply-thread-parent-msg-id");
+}
+
 ChannelPtr channelOrEmptyByTarget(const QString &target,
                                   ITwitchIrcServer &server)
 {
@@ -389,17 +444,63 @@ void IrcMessageHandler::handlePrivMessage(Communi::IrcPrivateMessage *message,
         return;
     }
 
-    parsePrivMessageInto(message, *twitchChannel, twitchChannel);
+    if (isReply(message->tags()))
+    {
+        // Replies are resolved against the messages of the channel, so every
+        // earlier message has to be committed first.
+        twitchChannel->messageCommitQueue_.flush();
+        parsePrivMessageInto(message, *twitchChannel, twitchChannel);
+        return;
+    }
+
+    applyOwnUserState(message->tag("user-id").toString(),
+                      message->tag("badges"), twitchChannel);
+    addMessageBatched(message, twitchChannel,
+                      unescapeZeroWidthJoiner(message->content()),
+                      twitchServer,
+                      {
+                          .isAction = message->isAction(),
+                      });
+}
+
+void IrcMessageHandler::flushPendingMessages(Communi::IrcMessage *message,
+                                             ITwitchIrcServer &twitchServer)
+{
+    const auto target = message->parameter(0);
+    if (!target.startsWith('#'))
+    {
+        return;
+    }
+
+    auto chan = channelOrEmptyByTarget(target, twitchServer);
+    if (auto *twitchChannel = dynamic_cast<TwitchChannel *>(chan.get()))
+    {
+        twitchChannel->messageCommitQueue_.flush();
+    }
 }
 
 void IrcMessageHandler::parsePrivMessageInto(
     Communi::IrcPrivateMessage *message, MessageSink &sink,
     TwitchChannel *channel)
+{
+    applyOwnUserState(message->tag("user-id").toString(),
+                      message->tag("badges"), channel);
+
+    IrcMessageHandler::addMessage(message, sink, channel,
+                                  unescapeZeroWidthJoiner(message->content()),
+                                  *getApp()->getTwitch(),
+                                  {
+                                      .isAction = message->isAction(),
+                                  });
+}
+
+void IrcMessageHandler::applyOwnUserState(const QString &userID,
+                                          const QVariant &badgesTag,
+                                          TwitchChannel *channel)
 {
     auto currentUser = getApp()->getAccounts()->twitch.getCurrent();
-    if (message->tag("user-id") == currentUser->getUserId())
+    if (userID == currentUser->getUserId())
     {
-        auto badgesTag = message->tag("badges");
         if (badgesTag.isValid())
         {
             // TODO: We should not update mod or vip status from recent messages
@@ -426,13 +527,6 @@ void IrcMessageHandler::parsePrivMessageInto(
             }
         }
     }
-
-    IrcMessageHandler::addMessage(message, sink, channel,
-                                  unescapeZeroWidthJoiner(message->content()),
-                                  *getApp()->getTwitch(),
-                                  {
-                                      .isAction = message->isAction(),
-                                  });
 }
 
 void IrcMessageHandler::handleRoomStateMessage(Communi::IrcMessage *message)
@@ -549,9 +643,11 @@ void IrcMessageHandler::handleClearChatMessage(Communi::IrcMessage *message)
 
     if (getSettings()->hideModerated)
     {
-        // XXX: This is expensive. We could use a layout request if the layout
-        //      would store the previous message flags.
-        getApp()->getWindows()->forceLayoutChannelViews();
+        // only the disabled messages are laid out again
+        auto changed = clearChat.disableAllMessages
+                           ? chan->getMessageSnapshot()
+                           : chan->findMessagesByUser(clearChat.username);
+        getApp()->getWindows()->layoutChannelViews(chan.get(), changed);
     }
 }
 
@@ -601,9 +697,8 @@ void IrcMessageHandler::handleClearMessageMessage(Communi::IrcMessage *message)
 
     if (getSettings()->hideModerated && !tags.has("historical"))
     {
-        // XXX: This is expensive. We could use a layout request if the layout
-        //      would store the previous message flags.
-        getApp()->getWindows()->forceLayoutChannelViews();
+        // only the deleted message is laid out again
+        getApp()->getWindows()->layoutChannelViews(chan.get(), {msg});
     }
 }
 
@@ -1082,46 +1177,10 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
 {
     assert(chan);
 
-    auto isSub = addArgs.isSub;
-    auto isAction = addArgs.isAction;
-
-    MessageParseArgs args;
-    args.isSubscriptionMessage = isSub;
-    if (addArgs.isSpecial)
-    {
-        args.trimSubscriberUsername = true;
-    }
-
-    args.isAction = isAction;
+    auto args = makeParseArgs(message, sink.sinkTraits(), chan,
+                              originalContent, addArgs);
 
     auto tags = message->tags();
-    QString rewardId;
-    if (auto optRewardId = tags.get("custom-reward-id"))
-    {
-        rewardId = *std::move(optRewardId);
-    }
-    else if (auto optMsgId = tags.get("msg-id"))
-    {
-        // slight hack to treat bits power-ups as channel point redemptions
-        const auto msgId = *std::move(optMsgId);
-        if (msgId == "animated-message" || msgId == "gigantified-emote-message")
-        {
-            rewardId = msgId;
-        }
-    }
-    if (!rewardId.isEmpty() &&
-        sink.sinkTraits().has(
-            MessageSinkTrait::RequiresKnownChannelPointReward) &&
-        !chan->isChannelPointRewardKnown(rewardId))
-    {
-        // Need to wait for pubsub reward notification
-        qCDebug(chatterinoTwitch) << "TwitchChannel reward added ADD "
-                                     "callback since reward is not known:"
-                                  << rewardId;
-        chan->addQueuedRedemption(rewardId, originalContent, message);
-    }
-    args.channelPointRewardId = rewardId;
-
     QString content = originalContent;
     int messageOffset = stripLeadingReplyMention(tags, content);
 
@@ -1190,40 +1249,70 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
         }
     }
 
-    args.allowIgnore = !isSub;
     auto [msg, alert] = MessageBuilder::makeIrcMessage(
         chan, message, args, content, messageOffset, replyCtx.thread,
         replyCtx.parent);
 
     if (msg)
     {
-        sink.applySimilarityFilters(msg);
+        commitMessage(msg, alert, sink, chan, twitch);
+    }
+}
 
-        if (!msg->flags.has(MessageFlag::Similar) ||
-            (!getSettings()->hideSimilar &&
-             getSettings()->shownSimilarTriggerHighlights))
-        {
-            MessageBuilder::triggerHighlights(chan, alert);
-        }
+void IrcMessageHandler::addMessageBatched(Communi::IrcMessage *message,
+                                          TwitchChannel *chan,
+                                          const QString &originalContent,
+                                          ITwitchIrcServer &twitch,
+                                          AddMessageArgs addArgs)
+{
+    assert(chan);
+    assert(!isReply(message->tags()));
 
-        const auto highlighted = msg->flags.has(MessageFlag::Highlighted);
-        const auto showInMentions = msg->flags.has(MessageFlag::ShowInMentions);
+    auto args = makeParseArgs(message, chan->sinkTraits(), chan,
+                              originalContent, addArgs);
+    auto [msg, alert] = MessageBuilder::makeIrcMessage(
+        chan, message, args, originalContent, 0, nullptr, nullptr);
+    if (!msg)
+    {
+        return;
+    }
 
-        if (highlighted && showInMentions &&
-            sink.sinkTraits().has(MessageSinkTrait::AddMentionsToGlobalChannel))
-        {
-            twitch.getMentionsChannel()->addMessage(msg,
-                                                    MessageContext::Original);
-        }
+    chan->messageCommitQueue_.enqueue(
+        [chan, &twitch, msg = std::move(msg), alert = alert] {
+            commitMessage(msg, alert, *chan, chan, twitch);
+        });
+}
 
-        if (msg->flags.has(MessageFlag::SharedMessage))
-        {
-            chan->probeSharedChatSession();
-        }
+void IrcMessageHandler::commitMessage(const MessagePtrMut &msg,
+                                      const HighlightAlert &alert,
+                                      MessageSink &sink, TwitchChannel *chan,
+                                      ITwitchIrcServer &twitch)
+{
+    sink.applySimilarityFilters(msg);
 
-        sink.addMessage(msg, MessageContext::Original);
-        chan->addRecentChatter(msg->displayName);
+    if (!msg->flags.has(MessageFlag::Similar) ||
+        (!getSettings()->hideSimilar &&
+         getSettings()->shownSimilarTriggerHighlights))
+    {
+        MessageBuilder::triggerHighlights(chan, alert);
     }
+
+    const auto highlighted = msg->flags.has(MessageFlag::Highlighted);
+    const auto showInMentions = msg->flags.has(MessageFlag::ShowInMentions);
+
+    if (highlighted && showInMentions &&
+        sink.sinkTraits().has(MessageSinkTrait::AddMentionsToGlobalChannel))
+    {
+        twitch.getMentionsChannel()->addMessage(msg, MessageContext::Original);
+    }
+
+    if (msg->flags.has(MessageFlag::SharedMessage))
+    {
+        chan->probeSharedChatSession();
+    }
+
+    sink.addMessage(msg, MessageContext::Original);
+    chan->addRecentChatter(msg->displayName);
 }
 
 }  // namespace chatterino
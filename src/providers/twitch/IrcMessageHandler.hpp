@@ -16,6 +16,8 @@ class Channel;
 using ChannelPtr = std::shared_ptr<Channel>;
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
+using MessagePtrMut = std::shared_ptr<Message>;
+struct HighlightAlert;
 class TwitchChannel;
 class TwitchMessageBuilder;
 class MessageSink;
@@ -46,8 +48,15 @@ public:
     static void parseMessageInto(Communi::IrcMessage *message,
                                  MessageSink &sink, TwitchChannel *channel);
 
+    /// Adds a PRIVMSG to its channel. Messages are built right away and added
+    /// in batches (see MessageCommitQueue), in the order they were received.
     void handlePrivMessage(Communi::IrcPrivateMessage *message,
                            ITwitchIrcServer &twitchServer);
+    /// Adds the PRIVMSGs that are waiting to be committed to the channel
+    /// `message` is sent to. Must be called before other messages of the
+    /// channel are handled.
+    static void flushPendingMessages(Communi::IrcMessage *message,
+                                     ITwitchIrcServer &twitchServer);
     static void parsePrivMessageInto(Communi::IrcPrivateMessage *message,
                                      MessageSink &sink, TwitchChannel *channel);
 
@@ -73,6 +82,25 @@ public:
                            ITwitchIrcServer &twitch, AddMessageArgs addArgs);
 
 private:
+    /// Updates the mod/VIP state and send wait of the channel if the message
+    /// was sent by the current user
+    static void applyOwnUserState(const QString &userID,
+                                  const QVariant &badgesTag,
+                                  TwitchChannel *channel);
+
+    /// Like addMessage, but adds the message to its channel with the next
+    /// batch. The message must not be a reply.
+    static void addMessageBatched(Communi::IrcMessage *message,
+                                  TwitchChannel *chan,
+                                  const QString &originalContent,
+                                  ITwitchIrcServer &twitch,
+                                  AddMessageArgs addArgs);
+
+    /// Adds a built message to `sink` and triggers its highlights
+    static void commitMessage(const MessagePtrMut &msg,
+                              const HighlightAlert &alert, MessageSink &sink,
+                              TwitchChannel *chan, ITwitchIrcServer &twitch);
+
     static float similarity(const MessagePtr &msg,
                             const std::vector<MessagePtr> &messages);
     static void setSimilarityFlags(const MessagePtr &message,
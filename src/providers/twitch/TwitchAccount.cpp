@@ -123,8 +123,7 @@ void TwitchAccount::tryLoadBlocks()
     auto token = CancellationToken(false);
     this->blockToken_ = token;
     this->ignores_.clear();
-    this->ignoresUserIds_.clear();
-    this->ignoresUserLogins_.clear();
+    this->publishBlocks();
 
     CancellationToken retryToken = token;
 
@@ -138,9 +137,8 @@ void TwitchAccount::tryLoadBlocks()
                 TwitchUser blockedUser;
                 blockedUser.fromHelixBlock(block);
                 this->ignores_.insert(blockedUser);
-                this->ignoresUserIds_.insert(blockedUser.id);
-                this->ignoresUserLogins_.insert(blockedUser.name);
             }
+            this->publishBlocks();
         },
         [this, retryToken](const QString &error) {
             if (retryToken.isCancelled())
@@ -175,8 +173,7 @@ void TwitchAccount::blockUser(const QString &userId, const QString &userLogin,
             blockedUser.id = userId;
             blockedUser.name = userLogin;
             this->ignores_.insert(blockedUser);
-            this->ignoresUserIds_.insert(blockedUser.id);
-            this->ignoresUserLogins_.insert(blockedUser.name);
+            this->publishBlocks();
             onSuccess();
         },
         std::move(onFailure));
@@ -196,8 +193,7 @@ void TwitchAccount::unblockUser(const QString &userId, const QString &userLogin,
             ignoredUser.id = userId;
             ignoredUser.name = userLogin;
             this->ignores_.erase(ignoredUser);
-            this->ignoresUserIds_.erase(ignoredUser.id);
-            this->ignoresUserLogins_.erase(ignoredUser.name);
+            this->publishBlocks();
             onSuccess();
         },
         std::move(onFailure));
@@ -213,8 +209,7 @@ void TwitchAccount::blockUserLocally(const QString &userID,
     blockedUser.id = userID;
     blockedUser.name = userLogin;
     this->ignores_.insert(blockedUser);
-    this->ignoresUserIds_.insert(blockedUser.id);
-    this->ignoresUserLogins_.insert(blockedUser.name);
+    this->publishBlocks();
 }
 
 bool TwitchAccount::setUserName(const QString &newUserName)
@@ -233,16 +228,37 @@ const std::unordered_set<TwitchUser> &TwitchAccount::blocks() const
     return this->ignores_;
 }
 
-const std::unordered_set<QString> &TwitchAccount::blockedUserIds() const
+std::shared_ptr<const std::unordered_set<QString>>
+    TwitchAccount::blockedUserIds() const
 {
-    assertInGuiThread();
-    return this->ignoresUserIds_;
+    return this->ignoresUserIds_.get();
+}
+
+std::shared_ptr<const std::unordered_set<QString>>
+    TwitchAccount::blockedUserLogins() const
+{
+    return this->ignoresUserLogins_.get();
 }
 
-const std::unordered_set<QString> &TwitchAccount::blockedUserLogins() const
+void TwitchAccount::publishBlocks()
 {
     assertInGuiThread();
-    return this->ignoresUserLogins_;
+
+    std::unordered_set<QString> ids;
+    std::unordered_set<QString> logins;
+    ids.reserve(this->ignores_.size());
+    logins.reserve(this->ignores_.size());
+    for (const auto &user : this->ignores_)
+    {
+        ids.insert(user.id);
+        logins.insert(user.name);
+    }
+
+    this->ignoresUserIds_.set(
+        std::make_shared<const std::unordered_set<QString>>(std::move(ids)));
+    this->ignoresUserLogins_.set(
+        std::make_shared<const std::unordered_set<QString>>(
+            std::move(logins)));
 }
 
 // AutoModActions
@@ -484,7 +500,6 @@ void TwitchAccount::reloadEmotes(void *caller)
             qDebug(chatterinoTwitch).nospace()
                 << "Got " << emotes.size() << " more emote(s)";
 
-            emoteMap->reserve(emoteMap->size() + emotes.size());
             for (const auto &emote : emotes)
             {
                 addEmote(emote);
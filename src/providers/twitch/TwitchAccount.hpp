@@ -83,8 +83,19 @@ public:
     void blockUserLocally(const QString &userID, const QString &userLogin);
 
     [[nodiscard]] const std::unordered_set<TwitchUser> &blocks() const;
-    [[nodiscard]] const std::unordered_set<QString> &blockedUserIds() const;
-    [[nodiscard]] const std::unordered_set<QString> &blockedUserLogins() const;
+
+    /// Returns the IDs of the blocked users
+    ///
+    /// The set is an immutable snapshot, so it can be used from any thread
+    /// (e.g. when building messages in the background).
+    [[nodiscard]] std::shared_ptr<const std::unordered_set<QString>>
+        blockedUserIds() const;
+
+    /// Returns the logins of the blocked users
+    ///
+    /// Like blockedUserIds(), this can be used from any thread.
+    [[nodiscard]] std::shared_ptr<const std::unordered_set<QString>>
+        blockedUserLogins() const;
 
     // Automod actions
     void autoModAllow(const QString &msgID, ChannelPtr channel) const;
@@ -130,8 +141,12 @@ private:
     ScopedCancellationToken blockToken_;
     ExponentialBackoff<5> blocksRetryBackoff_{std::chrono::seconds(5)};
     std::unordered_set<TwitchUser> ignores_;
-    std::unordered_set<QString> ignoresUserIds_;
-    std::unordered_set<QString> ignoresUserLogins_;
+    // Snapshots of ignores_, published whenever it changes
+    Atomic<std::shared_ptr<const std::unordered_set<QString>>> ignoresUserIds_{
+        std::make_shared<const std::unordered_set<QString>>()};
+    Atomic<std::shared_ptr<const std::unordered_set<QString>>>
+        ignoresUserLogins_{
+            std::make_shared<const std::unordered_set<QString>>()};
 
     ScopedCancellationToken emoteToken_;
     UniqueAccess<std::shared_ptr<const TwitchEmoteSetMap>> emoteSets_;
@@ -140,6 +155,9 @@ private:
     QString seventvUserID_;
 
     void tryLoadBlocks();
+
+    /// Publishes the IDs and logins of ignores_
+    void publishBlocks();
 };
 
 }  // namespace chatterino
@@ -13,7 +13,9 @@
 #include "controllers/emotes/EmoteController.hpp"
 #include "controllers/notifications/NotificationController.hpp"
 #include "controllers/twitch/LiveController.hpp"
+#include "debug/AssertInGuiThread.hpp"
 #include "messages/Emote.hpp"
+#include "messages/EmoteLookupTable.hpp"
 #include "messages/Image.hpp"
 #include "messages/Link.hpp"
 #include "messages/Message.hpp"
@@ -107,6 +109,33 @@ constexpr auto MAX_CHATTERS_TO_FETCH = 5000;
 // From Twitch docs - expected size for a badge (1x)
 constexpr QSize BASE_BADGE_SIZE(18, 18);
 
+/// Returns the global third-party emotes merged into a table that's shared
+/// by the tables of all channels. It's rebuilt once one of the global emote
+/// maps was replaced.
+///
+/// Must be called from the GUI thread.
+std::shared_ptr<const EmoteLookupTable> globalEmoteTable()
+{
+    assertInGuiThread();
+
+    // Emote order:
+    //  - FrankerFaceZ Global
+    //  - BetterTTV Global
+    //  - 7TV Global
+    EmoteLookupTable::Sources sources{
+        getApp()->getFfzEmotes()->emotes(),
+        getApp()->getBttvEmotes()->emotes(),
+        getApp()->getSeventvEmotes()->globalEmotes(),
+    };
+
+    static std::shared_ptr<const EmoteLookupTable> table;
+    if (!table || !table->isBuiltFrom(sources))
+    {
+        table = std::make_shared<const EmoteLookupTable>(std::move(sources));
+    }
+    return table;
+}
+
 }  // namespace
 
 TwitchChannel::TwitchChannel(const QString &name)
@@ -1120,6 +1149,32 @@ std::shared_ptr<const EmoteMap> TwitchChannel::seventvEmotes() const
     return this->seventvEmotes_.get();
 }
 
+std::shared_ptr<const EmoteLookupTable> TwitchChannel::emoteTable() const
+{
+    assertInGuiThread();
+
+    // Emote order:
+    //  - FrankerFaceZ Channel
+    //  - BetterTTV Channel
+    //  - 7TV Channel
+    //  - Global emotes (see globalEmoteTable)
+    EmoteLookupTable::Sources sources{
+        this->ffzEmotes_.get(),
+        this->bttvEmotes_.get(),
+        this->seventvEmotes_.get(),
+    };
+    auto global = globalEmoteTable();
+
+    if (!this->emoteTable_ ||
+        !this->emoteTable_->isBuiltFrom(sources, global))
+    {
+        // only the channel emotes are copied, the global table is shared
+        this->emoteTable_ = std::make_shared<const EmoteLookupTable>(
+            std::move(sources), std::move(global));
+    }
+    return this->emoteTable_;
+}
+
 const QString &TwitchChannel::seventvUserID() const
 {
     return this->seventvUserID_;
@@ -10,6 +10,7 @@
 #include "common/ChannelChatters.hpp"
 #include "common/Common.hpp"
 #include "common/UniqueAccess.hpp"
+#include "messages/MessageCommitQueue.hpp"
 #include "providers/ffz/FfzBadges.hpp"
 #include "providers/ffz/FfzEmotes.hpp"
 #include "providers/twitch/api/Helix.hpp"
@@ -41,6 +42,7 @@ enum class HighlightState;
 struct Emote;
 using EmotePtr = std::shared_ptr<const Emote>;
 class EmoteMap;
+class EmoteLookupTable;
 
 class TwitchBadges;
 class FfzEmotes;
@@ -243,6 +245,14 @@ public:
     std::shared_ptr<const EmoteMap> ffzEmotes() const;
     std::shared_ptr<const EmoteMap> seventvEmotes() const;
 
+    /// Returns the channel and global third-party emotes merged into a single
+    /// table (in the order they're resolved in messages).
+    ///
+    /// The channel emotes are layered over a table of the global emotes that
+    /// all channels share. Only the layer whose emote maps were replaced is
+    /// rebuilt. Must be called from the GUI thread.
+    std::shared_ptr<const EmoteLookupTable> emoteTable() const;
+
     void refreshTwitchChannelEmotes(bool manualRefresh);
     void refreshBTTVChannelEmotes(bool manualRefresh);
     void refreshFFZChannelEmotes(bool manualRefresh);
@@ -565,6 +575,8 @@ protected:
     Atomic<std::shared_ptr<const EmoteMap>> seventvEmotes_;
     Atomic<std::optional<EmotePtr>> ffzCustomModBadge_;
     Atomic<std::optional<EmotePtr>> ffzCustomVipBadge_;
+    /// Cache of emoteTable(), only accessed from the GUI thread
+    mutable std::shared_ptr<const EmoteLookupTable> emoteTable_;
 
     FfzChannelBadgeMap ffzChannelBadges_;
     ThreadGuard tgFfzChannelBadges_;
@@ -680,6 +692,9 @@ private:
     QTimer sendWaitTimer_;
     // Timepoint at which the user can send messages again
     std::optional<std::chrono::steady_clock::time_point> sendWaitEnd_;
+
+    /// PRIVMSGs of this channel that are waiting to be added
+    MessageCommitQueue messageCommitQueue_;
 };
 
 }  // namespace chatterino
@@ -0,0 +1,323 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/TwitchIrcLine.hpp"
+
+#include <array>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr std::array COMMANDS{
+    std::pair{QByteArrayView("PRIVMSG"), TwitchIrcCommand::Privmsg},
+    std::pair{QByteArrayView("JOIN"), TwitchIrcCommand::Join},
+    std::pair{QByteArrayView("PART"), TwitchIrcCommand::Part},
+    std::pair{QByteArrayView("USERSTATE"), TwitchIrcCommand::UserState},
+    std::pair{QByteArrayView("GLOBALUSERSTATE"),
+              TwitchIrcCommand::GlobalUserState},
+    std::pair{QByteArrayView("ROOMSTATE"), TwitchIrcCommand::RoomState},
+    std::pair{QByteArrayView("CLEARCHAT"), TwitchIrcCommand::ClearChat},
+    std::pair{QByteArrayView("CLEARMSG"), TwitchIrcCommand::ClearMsg},
+    std::pair{QByteArrayView("USERNOTICE"), TwitchIrcCommand::UserNotice},
+    std::pair{QByteArrayView("NOTICE"), TwitchIrcCommand::Notice},
+    std::pair{QByteArrayView("WHISPER"), TwitchIrcCommand::Whisper},
+    std::pair{QByteArrayView("RECONNECT"), TwitchIrcCommand::Reconnect},
+    std::pair{QByteArrayView("PING"), TwitchIrcCommand::Ping},
+    std::pair{QByteArrayView("PONG"), TwitchIrcCommand::Pong},
+    std::pair{QByteArrayView("CAP"), TwitchIrcCommand::Cap},
+};
+
+/// Returns the position of the first `c` in `data[from..to)`, or `to`
+qsizetype find(const char *data, char c, qsizetype from, qsizetype to)
+{
+    if (from >= to)
+    {
+        return to;
+    }
+    const auto *found = static_cast<const char *>(
+        std::memchr(data + from, c, static_cast<size_t>(to - from)));
+    return found ? found - data : to;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+TwitchIrcCommand parseTwitchIrcCommand(QByteArrayView command)
+{
+    for (const auto &[name, type] : COMMANDS)
+    {
+        if (name.size() == command.size() && name == command)
+        {
+            return type;
+        }
+    }
+    return TwitchIrcCommand::Unknown;
+}
+
+TwitchIrcCommand parseTwitchIrcCommand(QStringView command)
+{
+    for (const auto &[name, type] : COMMANDS)
+    {
+        if (name.size() == command.size() &&
+            QLatin1StringView(name.data(), name.size()) == command)
+        {
+            return type;
+        }
+    }
+    return TwitchIrcCommand::Unknown;
+}
+
+std::optional<TwitchIrcLine> TwitchIrcLine::parse(QByteArrayView line)
+{
+    while (line.endsWith('\n') || line.endsWith('\r'))
+    {
+        line.chop(1);
+    }
+
+    const char *data = line.data();
+    const auto size = line.size();
+    qsizetype pos = 0;
+
+    auto span = [](qsizetype begin, qsizetype end) {
+        return Span{
+            .begin = static_cast<uint32_t>(begin),
+            .size = static_cast<uint32_t>(end - begin),
+        };
+    };
+    auto skipSpaces = [&] {
+        while (pos < size && data[pos] == ' ')
+        {
+            pos++;
+        }
+    };
+
+    TwitchIrcLine out;
+    out.line_ = line;
+
+    // @key=value;key2=value2
+    if (pos < size && data[pos] == '@')
+    {
+        pos++;
+        auto tagsEnd = find(data, ' ', pos, size);
+        while (pos < tagsEnd)
+        {
+            auto tagEnd = find(data, ';', pos, tagsEnd);
+            auto equals = find(data, '=', pos, tagEnd);
+            if (equals > pos)
+            {
+                out.tags_.push_back({
+                    .key = span(pos, equals),
+                    .value = equals < tagEnd ? span(equals + 1, tagEnd)
+                                             : span(tagEnd, tagEnd),
+                });
+            }
+            pos = tagEnd + 1;
+        }
+        pos = tagsEnd;
+        skipSpaces();
+    }
+
+    // :nick!user@host
+    if (pos < size && data[pos] == ':')
+    {
+        pos++;
+        auto prefixEnd = find(data, ' ', pos, size);
+        out.prefix_ = span(pos, prefixEnd);
+        pos = prefixEnd;
+        skipSpaces();
+    }
+
+    auto commandEnd = find(data, ' ', pos, size);
+    if (commandEnd == pos)
+    {
+        return std::nullopt;
+    }
+    out.command_ = span(pos, commandEnd);
+    out.type_ = parseTwitchIrcCommand(out.view(out.command_));
+    pos = commandEnd;
+
+    while (true)
+    {
+        skipSpaces();
+        if (pos >= size)
+        {
+            break;
+        }
+        if (data[pos] == ':')
+        {
+            // the trailing parameter can contain spaces
+            out.parameters_.push_back(span(pos + 1, size));
+            break;
+        }
+        auto parameterEnd = find(data, ' ', pos, size);
+        out.parameters_.push_back(span(pos, parameterEnd));
+        pos = parameterEnd;
+    }
+
+    return out;
+}
+
+QString TwitchIrcLine::unescapeTagValue(QByteArrayView value)
+{
+    auto firstEscape = value.indexOf('\\');
+    if (firstEscape < 0)
+    {
+        return QString::fromUtf8(value);
+    }
+
+    QByteArray unescaped;
+    unescaped.reserve(value.size());
+    unescaped.append(value.first(firstEscape));
+    for (qsizetype i = firstEscape; i < value.size(); i++)
+    {
+        char c = value[i];
+        if (c != '\\')
+        {
+            unescaped.append(c);
+            continue;
+        }
+
+        i++;
+        if (i >= value.size())
+        {
+            // a trailing backslash is dropped
+            break;
+        }
+        switch (value[i])
+        {
+            case ':':
+                unescaped.append(';');
+                break;
+            case 's':
+                unescaped.append(' ');
+                break;
+            case 'r':
+                unescaped.append('\r');
+                break;
+            case 'n':
+                unescaped.append('\n');
+                break;
+            default:
+                // includes "\\"
+                unescaped.append(value[i]);
+                break;
+        }
+    }
+    return QString::fromUtf8(unescaped);
+}
+
+QByteArrayView TwitchIrcLine::raw() const
+{
+    return this->line_;
+}
+
+QByteArrayView TwitchIrcLine::prefix() const
+{
+    return this->view(this->prefix_);
+}
+
+QByteArrayView TwitchIrcLine::nick() const
+{
+    auto prefix = this->prefix();
+    for (qsizetype i = 0; i < prefix.size(); i++)
+    {
+        if (prefix[i] == '!' || prefix[i] == '@')
+        {
+            return prefix.first(i);
+        }
+    }
+    return prefix;
+}
+
+QByteArrayView TwitchIrcLine::command() const
+{
+    return this->view(this->command_);
+}
+
+TwitchIrcCommand TwitchIrcLine::type() const
+{
+    return this->type_;
+}
+
+qsizetype TwitchIrcLine::parameterCount() const
+{
+    return this->parameters_.size();
+}
+
+QByteArrayView TwitchIrcLine::parameter(qsizetype index) const
+{
+    if (index < 0 || index >= this->parameters_.size())
+    {
+        return {};
+    }
+    return this->view(this->parameters_[index]);
+}
+
+QString TwitchIrcLine::parameterString(qsizetype index) const
+{
+    return QString::fromUtf8(this->parameter(index));
+}
+
+qsizetype TwitchIrcLine::tagCount() const
+{
+    return this->tags_.size();
+}
+
+QByteArrayView TwitchIrcLine::tagKey(qsizetype index) const
+{
+    return this->view(this->tags_[index].key);
+}
+
+QByteArrayView TwitchIrcLine::rawTagValue(qsizetype index) const
+{
+    return this->view(this->tags_[index].value);
+}
+
+bool TwitchIrcLine::hasTag(QByteArrayView key) const
+{
+    return this->findTag(key) != nullptr;
+}
+
+std::optional<QByteArrayView> TwitchIrcLine::rawTag(QByteArrayView key) const
+{
+    const auto *tag = this->findTag(key);
+    if (!tag)
+    {
+        return std::nullopt;
+    }
+    return this->view(tag->value);
+}
+
+std::optional<QString> TwitchIrcLine::tag(QByteArrayView key) const
+{
+    auto value = this->rawTag(key);
+    if (!value)
+    {
+        return std::nullopt;
+    }
+    return unescapeTagValue(*value);
+}
+
+QByteArrayView TwitchIrcLine::view(Span span) const
+{
+    return this->line_.sliced(span.begin, span.size);
+}
+
+const TwitchIrcLine::Tag *TwitchIrcLine::findTag(QByteArrayView key) const
+{
+    for (const auto &tag : this->tags_)
+    {
+        if (tag.key.size == key.size() && this->view(tag.key) == key)
+        {
+            return &tag;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArrayView>
+#include <QString>
+#include <QStringView>
+#include <QVarLengthArray>
+
+#include <cstdint>
+#include <optional>
+
+namespace chatterino {
+
+/// IRC commands handled by the Twitch connections
+enum class TwitchIrcCommand : uint8_t {
+    Unknown,
+    Privmsg,
+    Join,
+    Part,
+    UserState,
+    GlobalUserState,
+    RoomState,
+    ClearChat,
+    ClearMsg,
+    UserNotice,
+    Notice,
+    Whisper,
+    Reconnect,
+    Ping,
+    Pong,
+    Cap,
+};
+
+/// Looks up an IRC command (e.g. "PRIVMSG"). Unknown commands and numerics
+/// are returned as TwitchIrcCommand::Unknown.
+TwitchIrcCommand parseTwitchIrcCommand(QByteArrayView command);
+TwitchIrcCommand parseTwitchIrcCommand(QStringView command);
+
+/// @brief A parsed IRCv3 line that refers to the raw line instead of copying
+/// its parts.
+///
+/// Parsing only records where the tags, prefix, command and parameters are.
+/// Values are decoded (and tags unescaped) when they're accessed. The parser
+/// is specialised for the messages Twitch sends: parts are separated by a
+/// single space and a line has few parameters.
+///
+/// The raw line must outlive the TwitchIrcLine.
+class TwitchIrcLine
+{
+public:
+    /// Parses a single line. A trailing "\r\n" is ignored.
+    ///
+    /// @returns std::nullopt if the line has no command
+    static std::optional<TwitchIrcLine> parse(QByteArrayView line);
+
+    /// Unescapes an IRCv3 tag value (e.g. "hello\sworld" -> "hello world")
+    static QString unescapeTagValue(QByteArrayView value);
+
+    QByteArrayView raw() const;
+
+    /// The prefix without the leading ':' (e.g. "nick!user@host")
+    QByteArrayView prefix() const;
+    /// The nick in the prefix (e.g. "nick" in "nick!user@host")
+    QByteArrayView nick() const;
+
+    QByteArrayView command() const;
+    TwitchIrcCommand type() const;
+
+    qsizetype parameterCount() const;
+    /// The parameter at `index` (the trailing parameter without its ':')
+    QByteArrayView parameter(qsizetype index) const;
+    /// The decoded parameter at `index`, or an empty string if there's none
+    QString parameterString(qsizetype index) const;
+
+    qsizetype tagCount() const;
+    QByteArrayView tagKey(qsizetype index) const;
+    /// The escaped value of the tag at `index`
+    QByteArrayView rawTagValue(qsizetype index) const;
+
+    bool hasTag(QByteArrayView key) const;
+    /// The escaped value of a tag, or std::nullopt if the line doesn't have it
+    std::optional<QByteArrayView> rawTag(QByteArrayView key) const;
+    /// The unescaped and decoded value of a tag, or std::nullopt if the line
+    /// doesn't have it
+    std::optional<QString> tag(QByteArrayView key) const;
+
+private:
+    /// Part of `line_`
+    struct Span {
+        uint32_t begin = 0;
+        uint32_t size = 0;
+    };
+
+    struct Tag {
+        Span key;
+        Span value;
+    };
+
+    TwitchIrcLine() = default;
+
+    QByteArrayView view(Span span) const;
+    const Tag *findTag(QByteArrayView key) const;
+
+    QByteArrayView line_;
+    Span prefix_;
+    Span command_;
+    TwitchIrcCommand type_ = TwitchIrcCommand::Unknown;
+    // Twitch sends up to ~25 tags and 2 parameters
+    QVarLengthArray<Tag, 24> tags_;
+    QVarLengthArray<Span, 4> parameters_;
+};
+
+}  // namespace chatterino
@@ -26,6 +26,7 @@
 #include "providers/twitch/PubSubManager.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
+#include "providers/twitch/TwitchIrcLine.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/WindowManager.hpp"
 #include "util/PostToThread.hpp"
@@ -407,83 +408,84 @@ void TwitchIrcServer::readConnectionMessageReceived(
         return;
     }
 
-    const QString &command = message->command();
-
     auto &handler = IrcMessageHandler::instance();
 
-    // Below commands enabled through the twitch.tv/membership CAP REQ
-    if (command == "JOIN")
-    {
-        handler.handleJoinMessage(message);
-    }
-    else if (command == "PART")
-    {
-        handler.handlePartMessage(message);
-    }
-    else if (command == "USERSTATE")
-    {
-        // Received USERSTATE upon JOINing a channel
-        handler.handleUserStateMessage(message);
-    }
-    else if (command == "ROOMSTATE")
-    {
-        // Received ROOMSTATE upon JOINing a channel
-        handler.handleRoomStateMessage(message);
-    }
-    else if (command == "CLEARCHAT")
-    {
-        handler.handleClearChatMessage(message);
-    }
-    else if (command == "CLEARMSG")
+    switch (parseTwitchIrcCommand(message->command()))
     {
-        handler.handleClearMessageMessage(message);
-    }
-    else if (command == "USERNOTICE")
-    {
-        handler.handleUserNoticeMessage(message, *this);
-    }
-    else if (command == "NOTICE")
-    {
-        handler.handleNoticeMessage(
-            static_cast<Communi::IrcNoticeMessage *>(message));
-    }
-    else if (command == "WHISPER")
-    {
-        handler.handleWhisperMessage(message);
-    }
-    else if (command == "RECONNECT")
-    {
-        this->addGlobalSystemMessage(
-            "Twitch Servers requested us to reconnect, reconnecting");
-        this->markChannelsConnected();
-        this->connect();
+        // Below commands enabled through the twitch.tv/membership CAP REQ
+        case TwitchIrcCommand::Join:
+            handler.handleJoinMessage(message);
+            break;
+        case TwitchIrcCommand::Part:
+            handler.handlePartMessage(message);
+            break;
+        case TwitchIrcCommand::UserState:
+            // Received USERSTATE upon JOINing a channel
+            handler.handleUserStateMessage(message);
+            break;
+        case TwitchIrcCommand::RoomState:
+            // Received ROOMSTATE upon JOINing a channel
+            handler.handleRoomStateMessage(message);
+            break;
+        // PRIVMSGs are added to their channel in batches. The handlers below
+        // add to or change the messages of a channel, so they have to see the
+        // ones that were received before (e.g. to time them out).
+        case TwitchIrcCommand::ClearChat:
+            IrcMessageHandler::flushPendingMessages(message, *this);
+            handler.handleClearChatMessage(message);
+            break;
+        case TwitchIrcCommand::ClearMsg:
+            IrcMessageHandler::flushPendingMessages(message, *this);
+            handler.handleClearMessageMessage(message);
+            break;
+        case TwitchIrcCommand::UserNotice:
+            IrcMessageHandler::flushPendingMessages(message, *this);
+            handler.handleUserNoticeMessage(message, *this);
+            break;
+        case TwitchIrcCommand::Notice:
+            IrcMessageHandler::flushPendingMessages(message, *this);
+            handler.handleNoticeMessage(
+                static_cast<Communi::IrcNoticeMessage *>(message));
+            break;
+        case TwitchIrcCommand::Whisper:
+            handler.handleWhisperMessage(message);
+            break;
+        case TwitchIrcCommand::Reconnect:
+            this->addGlobalSystemMessage(
+                "Twitch Servers requested us to reconnect, reconnecting");
+            this->markChannelsConnected();
+            this->connect();
+            break;
+        default:
+            break;
     }
 }
 
 void TwitchIrcServer::writeConnectionMessageReceived(
     Communi::IrcMessage *message)
 {
-    const QString &command = message->command();
-
     auto &handler = IrcMessageHandler::instance();
-    // Below commands enabled through the twitch.tv/commands CAP REQ
-    if (command == "USERSTATE")
-    {
-        // Received USERSTATE upon sending PRIVMSG messages
-        handler.handleUserStateMessage(message);
-    }
-    else if (command == "NOTICE")
-    {
-        // List of expected NOTICE messages on write connection
-        // https://git.kotmisia.pl/Mm2PL/docs/src/branch/master/irc_msg_ids.md#command-results
-        handler.handleNoticeMessage(
-            static_cast<Communi::IrcNoticeMessage *>(message));
-    }
-    else if (command == "RECONNECT")
+
+    switch (parseTwitchIrcCommand(message->command()))
     {
-        this->addGlobalSystemMessage(
-            "Twitch Servers requested us to reconnect, reconnecting");
-        this->connect();
+        // Below commands enabled through the twitch.tv/commands CAP REQ
+        case TwitchIrcCommand::UserState:
+            // Received USERSTATE upon sending PRIVMSG messages
+            handler.handleUserStateMessage(message);
+            break;
+        case TwitchIrcCommand::Notice:
+            // List of expected NOTICE messages on write connection
+            // https://git.kotmisia.pl/Mm2PL/docs/src/branch/master/irc_msg_ids.md#command-results
+            handler.handleNoticeMessage(
+                static_cast<Communi::IrcNoticeMessage *>(message));
+            break;
+        case TwitchIrcCommand::Reconnect:
+            this->addGlobalSystemMessage(
+                "Twitch Servers requested us to reconnect, reconnecting");
+            this->connect();
+            break;
+        default:
+            break;
     }
 }
 
@@ -12,6 +12,7 @@
 #include "common/QLogging.hpp"
 #include "controllers/accounts/AccountController.hpp"
 #include "util/CancellationToken.hpp"
+#include "util/PostToThread.hpp"
 #include "util/QMagicEnum.hpp"
 
 #include <magic_enum/magic_enum.hpp>
@@ -26,6 +27,9 @@ constexpr auto NUM_MODERATORS_TO_FETCH_PER_REQUEST = 100;
 
 constexpr auto NUM_CHATTERS_TO_FETCH = 1000;
 
+/// Users that can be looked up with one request (IDs and logins combined)
+constexpr size_t NUM_USERS_TO_FETCH_PER_REQUEST = 100;
+
 }  // namespace
 
 namespace chatterino {
@@ -50,6 +54,18 @@ HelixChatters::HelixChatters(const QJsonObject &jsonObject)
 void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
                        ResultCallback<std::vector<HelixUser>> successCallback,
                        HelixFailureCallback failureCallback)
+{
+    this->requestUsers(userIds, userLogins, std::move(successCallback),
+                       [failureCallback](const auto & /*result*/) {
+                           // TODO: make better xd
+                           failureCallback();
+                       });
+}
+
+void Helix::requestUsers(
+    const QStringList &userIds, const QStringList &userLogins,
+    ResultCallback<std::vector<HelixUser>> successCallback,
+    std::function<void(const NetworkResult &)> errorCallback)
 {
     QUrlQuery urlQuery;
 
@@ -63,15 +79,14 @@ void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
         urlQuery.addQueryItem("login", login);
     }
 
-    // TODO: set on success and on error
-    this->makeGet("users", urlQuery)
-        .onSuccess([successCallback, failureCallback](auto result) {
+    this->makeGet("users", urlQuery, HelixPriority::Interactive)
+        .onSuccess([successCallback, errorCallback](const auto &result) {
             auto root = result.parseJson();
             auto data = root.value("data");
 
             if (!data.isArray())
             {
-                failureCallback();
+                errorCallback(result);
                 return;
             }
 
@@ -84,9 +99,8 @@ void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
 
             successCallback(users);
         })
-        .onError([failureCallback](auto /*result*/) {
-            // TODO: make better xd
-            failureCallback();
+        .onError([errorCallback](const auto &result) {
+            errorCallback(result);
         })
         .execute();
 }
@@ -95,41 +109,176 @@ void Helix::getUserByName(QString userName,
                           ResultCallback<HelixUser> successCallback,
                           HelixFailureCallback failureCallback)
 {
-    QStringList userIds;
-    QStringList userLogins{std::move(userName)};
+    this->queueUserLookup(std::move(userName), false,
+                          std::move(successCallback),
+                          std::move(failureCallback));
+}
 
-    this->fetchUsers(
-        userIds, userLogins,
-        [successCallback,
-         failureCallback](const std::vector<HelixUser> &users) {
-            if (users.empty())
+void Helix::getUserById(QString userId,
+                        ResultCallback<HelixUser> successCallback,
+                        HelixFailureCallback failureCallback)
+{
+    this->queueUserLookup(std::move(userId), true, std::move(successCallback),
+                          std::move(failureCallback));
+}
+
+struct Helix::UserLookupBatch {
+    std::unordered_map<QString, std::vector<UserLookup>> byId;
+    std::unordered_map<QString, std::vector<UserLookup>> byLogin;
+
+    size_t size() const
+    {
+        return this->byId.size() + this->byLogin.size();
+    }
+
+    void resolve(const HelixUser &user)
+    {
+        auto resolveIn = [&](auto &lookups, const QString &key) {
+            auto it = lookups.find(key);
+            if (it == lookups.end())
             {
-                failureCallback();
                 return;
             }
-            successCallback(users[0]);
-        },
-        failureCallback);
+            for (const auto &lookup : it->second)
+            {
+                lookup.successCallback(user);
+            }
+            lookups.erase(it);
+        };
+        resolveIn(this->byId, user.id);
+        resolveIn(this->byLogin, user.login.toLower());
+    }
+
+    void failAll()
+    {
+        for (auto *lookups : {&this->byId, &this->byLogin})
+        {
+            for (const auto &[key, pending] : *lookups)
+            {
+                for (const auto &lookup : pending)
+                {
+                    lookup.failureCallback();
+                }
+            }
+            lookups->clear();
+        }
+    }
+};
+
+void Helix::queueUserLookup(QString key, bool byId,
+                            ResultCallback<HelixUser> successCallback,
+                            HelixFailureCallback failureCallback)
+{
+    if (key.isEmpty())
+    {
+        // this would fail the whole batch
+        failureCallback();
+        return;
+    }
+
+    bool send = false;
+    {
+        std::lock_guard lock(this->userLookupsMutex);
+        auto &lookups =
+            byId ? this->userLookupsById : this->userLookupsByLogin;
+        lookups[byId ? std::move(key) : key.toLower()].push_back({
+            .successCallback = std::move(successCallback),
+            .failureCallback = std::move(failureCallback),
+        });
+        send = !std::exchange(this->userLookupsQueued, true);
+    }
+
+    if (send)
+    {
+        postToThread([this] {
+            this->sendUserLookups();
+        });
+    }
 }
 
-void Helix::getUserById(QString userId,
-                        ResultCallback<HelixUser> successCallback,
-                        HelixFailureCallback failureCallback)
+void Helix::sendUserLookups()
 {
-    QStringList userIds{std::move(userId)};
+    std::unordered_map<QString, std::vector<UserLookup>> byId;
+    std::unordered_map<QString, std::vector<UserLookup>> byLogin;
+    {
+        std::lock_guard lock(this->userLookupsMutex);
+        byId.swap(this->userLookupsById);
+        byLogin.swap(this->userLookupsByLogin);
+        this->userLookupsQueued = false;
+    }
+
+    auto batch = std::make_shared<UserLookupBatch>();
+    auto makeRoom = [&] {
+        if (batch->size() >= NUM_USERS_TO_FETCH_PER_REQUEST)
+        {
+            this->sendUserLookupBatch(std::move(batch));
+            batch = std::make_shared<UserLookupBatch>();
+        }
+    };
+    for (auto &[id, lookups] : byId)
+    {
+        makeRoom();
+        batch->byId.emplace(id, std::move(lookups));
+    }
+    for (auto &[login, lookups] : byLogin)
+    {
+        makeRoom();
+        batch->byLogin.emplace(login, std::move(lookups));
+    }
+    if (batch->size() > 0)
+    {
+        this->sendUserLookupBatch(std::move(batch));
+    }
+}
+
+void Helix::sendUserLookupBatch(std::shared_ptr<UserLookupBatch> batch)
+{
+    QStringList userIds;
+    for (const auto &[id, lookups] : batch->byId)
+    {
+        userIds.append(id);
+    }
     QStringList userLogins;
+    for (const auto &[login, lookups] : batch->byLogin)
+    {
+        userLogins.append(login);
+    }
 
-    this->fetchUsers(
+    this->requestUsers(
         userIds, userLogins,
-        [successCallback, failureCallback](const auto &users) {
-            if (users.empty())
+        [batch](const std::vector<HelixUser> &users) {
+            for (const auto &user : users)
             {
-                failureCallback();
-                return;
+                batch->resolve(user);
             }
-            successCallback(users[0]);
+            // the remaining users don't exist
+            batch->failAll();
         },
-        failureCallback);
+        [this, batch](const NetworkResult &result) {
+            // a single invalid login fails the whole request with a 400, so
+            // look up every user on its own to find the one that's invalid.
+            // Other errors (e.g. timeouts) would fail the single lookups too.
+            if (batch->size() <= 1 || result.status() != 400)
+            {
+                batch->failAll();
+                return;
+            }
+
+            for (auto &[id, lookups] : batch->byId)
+            {
+                auto single = std::make_shared<UserLookupBatch>();
+                single->byId.emplace(id, std::move(lookups));
+                this->sendUserLookupBatch(std::move(single));
+            }
+            for (auto &[login, lookups] : batch->byLogin)
+            {
+                auto single = std::make_shared<UserLookupBatch>();
+                single->byLogin.emplace(login, std::move(lookups));
+                this->sendUserLookupBatch(std::move(single));
+            }
+            batch->byId.clear();
+            batch->byLogin.clear();
+        });
 }
 
 void Helix::getChannelFollowers(
@@ -143,7 +292,7 @@ void Helix::getChannelFollowers(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
 
     // TODO: set on success and on error
-    this->makeGet("channels/followers", urlQuery)
+    this->makeGet("channels/followers", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             if (root.empty())
@@ -186,7 +335,7 @@ void Helix::fetchStreams(
     }
 
     // TODO: set on success and on error
-    this->makeGet("streams", urlQuery)
+    this->makeGet("streams", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -282,7 +431,7 @@ void Helix::fetchGames(QStringList gameIds, QStringList gameNames,
     }
 
     // TODO: set on success and on error
-    this->makeGet("games", urlQuery)
+    this->makeGet("games", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -316,7 +465,7 @@ void Helix::searchGames(QString gameName,
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("query", gameName);
 
-    this->makeGet("search/categories", urlQuery)
+    this->makeGet("search/categories", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -382,7 +531,7 @@ void Helix::createClip(
         urlQuery.addQueryItem("duration", QString::number(*duration));
     }
 
-    this->makePost("clips", urlQuery)
+    this->makePost("clips", urlQuery, HelixPriority::Interactive)
         .header("Content-Type", "application/json")
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
@@ -466,7 +615,7 @@ void Helix::fetchChannels(
         urlQuery.addQueryItem("broadcaster_id", userID);
     }
 
-    this->makeGet("channels", urlQuery)
+    this->makeGet("channels", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -504,7 +653,7 @@ void Helix::getChannel(QString broadcasterId,
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
 
-    this->makeGet("channels", urlQuery)
+    this->makeGet("channels", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -538,7 +687,7 @@ void Helix::createStreamMarker(
     }
     payload.insert("user_id", QJsonValue(broadcasterId));
 
-    this->makePost("streams/markers", QUrlQuery())
+    this->makePost("streams/markers", QUrlQuery(), HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
@@ -630,7 +779,7 @@ void Helix::loadBlocks(QString userId,
         [failureCallback](const NetworkResult &result) {
             failureCallback(result.formatError());
         },
-        std::move(token));
+        HelixPriority::Background, std::move(token));
 }
 
 void Helix::blockUser(QString targetUserId, const QObject *caller,
@@ -640,7 +789,7 @@ void Helix::blockUser(QString targetUserId, const QObject *caller,
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("target_user_id", targetUserId);
 
-    this->makePut("users/blocks", urlQuery)
+    this->makePut("users/blocks", urlQuery, HelixPriority::Interactive)
         .caller(caller)
         .onSuccess([successCallback](auto /*result*/) {
             successCallback();
@@ -659,7 +808,7 @@ void Helix::unblockUser(QString targetUserId, const QObject *caller,
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("target_user_id", targetUserId);
 
-    this->makeDelete("users/blocks", urlQuery)
+    this->makeDelete("users/blocks", urlQuery, HelixPriority::Interactive)
         .caller(caller)
         .onSuccess([successCallback](auto /*result*/) {
             successCallback();
@@ -700,7 +849,7 @@ void Helix::updateChannel(
     }
 
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
-    this->makePatch("channels", urlQuery)
+    this->makePatch("channels", urlQuery, HelixPriority::Interactive)
         .json(obj)
         .onSuccess([successCallback, failureCallback](auto result) {
             successCallback(result);
@@ -776,7 +925,8 @@ void Helix::manageAutoModMessages(
     payload.insert("msg_id", msgID);
     payload.insert("action", action);
 
-    this->makePost("moderation/automod/message", QUrlQuery())
+    this->makePost("moderation/automod/message", QUrlQuery(),
+                   HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback, failureCallback](auto result) {
             successCallback();
@@ -832,7 +982,7 @@ void Helix::getCheermotes(
 
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
 
-    this->makeGet("bits/cheermotes", urlQuery)
+    this->makeGet("bits/cheermotes", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -869,7 +1019,7 @@ void Helix::getEmoteSetData(QString emoteSetId,
 
     urlQuery.addQueryItem("emote_set_id", emoteSetId);
 
-    this->makeGet("chat/emotes/set", urlQuery)
+    this->makeGet("chat/emotes/set", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback, emoteSetId](auto result) {
             QJsonObject root = result.parseJson();
             auto data = root.value("data");
@@ -899,7 +1049,7 @@ void Helix::getChannelEmotes(
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
 
-    this->makeGet("chat/emotes", urlQuery)
+    this->makeGet("chat/emotes", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback, failureCallback](NetworkResult result) {
             QJsonObject root = result.parseJson();
             auto data = root.value("data");
@@ -937,7 +1087,7 @@ void Helix::updateUserChatColor(
     payload.insert("user_id", QJsonValue(userID));
     payload.insert("color", QJsonValue(color));
 
-    this->makePut("chat/color", QUrlQuery())
+    this->makePut("chat/color", QUrlQuery(), HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto obj = result.parseJson();
@@ -1021,7 +1171,7 @@ void Helix::deleteChatMessages(
         urlQuery.addQueryItem("message_id", messageID);
     }
 
-    this->makeDelete("moderation/chat", urlQuery)
+    this->makeDelete("moderation/chat", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1105,7 +1255,8 @@ void Helix::addChannelModerator(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makePost("moderation/moderators", urlQuery)
+    this->makePost("moderation/moderators", urlQuery,
+                   HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1199,7 +1350,8 @@ void Helix::removeChannelModerator(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makeDelete("moderation/moderators", urlQuery)
+    this->makeDelete("moderation/moderators", urlQuery,
+                     HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1289,7 +1441,7 @@ void Helix::sendChatAnnouncement(
     body.insert("message", message);
     body.insert("color", qmagicenum::enumNameString(color).toLower());
 
-    this->makePost("chat/announcements", urlQuery)
+    this->makePost("chat/announcements", urlQuery, HelixPriority::Interactive)
         .json(body)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
@@ -1365,7 +1517,7 @@ void Helix::addChannelVIP(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makePost("channels/vips", urlQuery)
+    this->makePost("channels/vips", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1449,7 +1601,7 @@ void Helix::removeChannelVIP(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makeDelete("channels/vips", urlQuery)
+    this->makeDelete("channels/vips", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1534,7 +1686,7 @@ void Helix::unbanUser(
     urlQuery.addQueryItem("moderator_id", moderatorID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makeDelete("moderation/bans", urlQuery)
+    this->makeDelete("moderation/bans", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1634,7 +1786,7 @@ void Helix::startRaid(
     urlQuery.addQueryItem("from_broadcaster_id", fromBroadcasterID);
     urlQuery.addQueryItem("to_broadcaster_id", toBroadcasterID);
 
-    this->makePost("raids", urlQuery)
+    this->makePost("raids", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto /*result*/) {
             successCallback();
         })
@@ -1718,7 +1870,7 @@ void Helix::cancelRaid(
 
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
 
-    this->makeDelete("raids", urlQuery)
+    this->makeDelete("raids", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) {
             if (result.status() != 204)
             {
@@ -1884,7 +2036,7 @@ void Helix::updateChatSettings(
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
     urlQuery.addQueryItem("moderator_id", moderatorID);
 
-    this->makePatch("chat/settings", urlQuery)
+    this->makePatch("chat/settings", urlQuery, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -2013,7 +2165,7 @@ void Helix::fetchChatters(
         urlQuery.addQueryItem("after", after);
     }
 
-    this->makeGet("chat/chatters", urlQuery)
+    this->makeGet("chat/chatters", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
             {
@@ -2127,7 +2279,7 @@ void Helix::fetchModerators(
         urlQuery.addQueryItem("after", after);
     }
 
-    this->makeGet("moderation/moderators", urlQuery)
+    this->makeGet("moderation/moderators", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
             {
@@ -2217,7 +2369,7 @@ void Helix::banUser(QString broadcasterID, QString moderatorID, QString userID,
         payload["data"] = data;
     }
 
-    this->makePost("moderation/bans", urlQuery)
+    this->makePost("moderation/bans", urlQuery, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -2326,7 +2478,7 @@ void Helix::warnUser(
         payload["data"] = data;
     }
 
-    this->makePost("moderation/warnings", urlQuery)
+    this->makePost("moderation/warnings", urlQuery, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -2419,7 +2571,8 @@ void Helix::addSuspiciousUser(const QString broadcasterID,
     payload["user_id"] = userID;
     payload["status"] = restricted ? "RESTRICTED" : "ACTIVE_MONITORING";
 
-    this->makePost("moderation/suspicious_users", urlQuery)
+    this->makePost("moderation/suspicious_users", urlQuery,
+                   HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 200)
@@ -2464,7 +2617,8 @@ void Helix::removeSuspiciousUser(const QString broadcasterID,
     urlQuery.addQueryItem("moderator_id", moderatorID);
     urlQuery.addQueryItem("user_id", userID);
 
-    this->makeDelete("moderation/suspicious_users", urlQuery)
+    this->makeDelete("moderation/suspicious_users", urlQuery,
+                     HelixPriority::Interactive)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 200)
             {
@@ -2512,7 +2666,7 @@ void Helix::sendWhisper(
     QJsonObject payload;
     payload["message"] = message;
 
-    this->makePost("whispers", urlQuery)
+    this->makePost("whispers", urlQuery, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 204)
@@ -2660,7 +2814,7 @@ void Helix::getChannelVIPs(
     //   as the mod list can go over 100 (I assume, I see no limit)
     urlQuery.addQueryItem("first", "100");
 
-    this->makeGet("channels/vips", urlQuery)
+    this->makeGet("channels/vips", urlQuery, HelixPriority::Interactive)
         .header("Content-Type", "application/json")
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -2752,7 +2906,8 @@ void Helix::startCommercial(
     payload.insert("broadcaster_id", QJsonValue(broadcasterID));
     payload.insert("length", QJsonValue(length));
 
-    this->makePost("channels/commercial", QUrlQuery())
+    this->makePost("channels/commercial", QUrlQuery(),
+                   HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback, failureCallback](auto result) {
             auto obj = result.parseJson();
@@ -2848,7 +3003,7 @@ void Helix::getGlobalBadges(
 {
     using Error = HelixGetGlobalBadgesError;
 
-    this->makeGet("chat/badges/global", QUrlQuery())
+    this->makeGet("chat/badges/global", QUrlQuery(), HelixPriority::Background)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
             {
@@ -2900,7 +3055,7 @@ void Helix::getChannelBadges(
     QUrlQuery urlQuery;
     urlQuery.addQueryItem("broadcaster_id", broadcasterID);
 
-    this->makeGet("chat/badges", urlQuery)
+    this->makeGet("chat/badges", urlQuery, HelixPriority::Background)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
             {
@@ -2957,7 +3112,8 @@ void Helix::updateShieldMode(
     QJsonObject payload;
     payload["is_active"] = isActive;
 
-    this->makePut("moderation/shield_mode", urlQuery)
+    this->makePut("moderation/shield_mode", urlQuery,
+                  HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -3033,7 +3189,7 @@ void Helix::sendShoutout(
     urlQuery.addQueryItem("to_broadcaster_id", toBroadcasterID);
     urlQuery.addQueryItem("moderator_id", moderatorID);
 
-    this->makePost("chat/shoutouts", urlQuery)
+    this->makePost("chat/shoutouts", urlQuery, HelixPriority::Interactive)
         .header("Content-Type", "application/json")
         .onSuccess([successCallback](NetworkResult result) {
             if (result.status() != 204)
@@ -3146,7 +3302,7 @@ void Helix::sendChatMessage(
         json["pin"_L1] = args.pin;
     }
 
-    this->makePost("chat/messages", {})
+    this->makePost("chat/messages", {}, HelixPriority::Interactive)
         .json(json)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
@@ -3281,7 +3437,7 @@ void Helix::getUserEmotes(
                 }
             }
         },
-        std::move(token));
+        HelixPriority::Background, std::move(token));
 }
 
 void Helix::getFollowedChannel(
@@ -3293,7 +3449,8 @@ void Helix::getFollowedChannel(
                   {
                       {u"user_id"_s, userID},
                       {u"broadcaster_id"_s, broadcasterID},
-                  })
+                  },
+                  HelixPriority::Interactive)
         .caller(caller)
         .onSuccess([successCallback](auto result) {
             if (result.status() != 200)
@@ -3360,7 +3517,7 @@ void Helix::createPoll(QString broadcasterID, QString title,
     }
 
     // Execute API call
-    this->makePost("polls", {})
+    this->makePost("polls", {}, HelixPriority::Interactive)
         .json(json)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
@@ -3412,7 +3569,7 @@ void Helix::getPolls(const QString broadcasterID, QStringList ids,
         urlQuery.addQueryItem("id", id);
     }
 
-    this->makeGet("polls", urlQuery)
+    this->makeGet("polls", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 200)
             {
@@ -3455,7 +3612,7 @@ void Helix::endPoll(const QString broadcasterID, const QString id,
     payload.insert("id", id);
     payload.insert("status", immediatelyHide ? "ARCHIVED" : "TERMINATED");
 
-    this->makePatch("polls", {})
+    this->makePatch("polls", {}, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
@@ -3510,7 +3667,7 @@ void Helix::createPrediction(const QString broadcasterID, const QString title,
     payload.insert("outcomes", outcomeArray);
 
     // Execute API call
-    this->makePost("predictions", {})
+    this->makePost("predictions", {}, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
@@ -3562,7 +3719,7 @@ void Helix::getPredictions(const QString broadcasterID, QStringList ids,
         urlQuery.addQueryItem("id", id);
     }
 
-    this->makeGet("predictions", urlQuery)
+    this->makeGet("predictions", urlQuery, HelixPriority::Interactive)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 200)
             {
@@ -3619,7 +3776,7 @@ void Helix::endPrediction(const QString broadcasterID, const QString id,
         payload.insert("winning_outcome_id", winningOutcomeID);
     }
 
-    this->makePatch("predictions", {})
+    this->makePatch("predictions", {}, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
@@ -3679,7 +3836,7 @@ void Helix::createEventSubSubscription(
 
     body.insert("transport", transport);
 
-    this->makePost("eventsub/subscriptions", {})
+    this->makePost("eventsub/subscriptions", {}, HelixPriority::Background)
         .json(body)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 202)
@@ -3771,7 +3928,8 @@ void Helix::getSharedChatSession(
 {
     using Error = HelixGetSharedChatSessionError;
 
-    this->makeGet("shared_chat/session", {{u"broadcaster_id"_s, broadcasterID}})
+    this->makeGet("shared_chat/session", {{u"broadcaster_id"_s, broadcasterID}},
+                  HelixPriority::Background)
         .onSuccess([successCallback](const NetworkResult &result) {
             if (result.status() != 200)
             {
@@ -3864,7 +4022,7 @@ void Helix::deleteEventSubSubscription(const QString &subscriptionID,
     QUrlQuery query;
     query.addQueryItem("id", subscriptionID);
 
-    this->makeDelete("eventsub/subscriptions", query)
+    this->makeDelete("eventsub/subscriptions", query, HelixPriority::Background)
         .onSuccess([successCallback](const auto &result) {
             if (result.status() != 204)
             {
@@ -3914,7 +4072,7 @@ void Helix::pinChatMessage(
                        static_cast<qint64>(duration->count()));
     }
 
-    this->makePut("chat/pins", {})
+    this->makePut("chat/pins", {}, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const NetworkResult & /*result*/) {
             successCallback();
@@ -3977,7 +4135,7 @@ void Helix::updatePinnedChatMessage(
                        static_cast<qint64>(duration->count()));
     }
 
-    this->makePatch("chat/pins", {})
+    this->makePatch("chat/pins", {}, HelixPriority::Interactive)
         .json(payload)
         .onSuccess([successCallback](const NetworkResult & /*result*/) {
             successCallback();
@@ -4032,7 +4190,7 @@ void Helix::getPinnedChatMessage(
         {u"moderator_id"_s, moderatorID},
     };
 
-    this->makeGet("chat/pins", query)
+    this->makeGet("chat/pins", query, HelixPriority::Background)
         .onSuccess([successCallback](const NetworkResult &result) {
             const auto json = result.parseJson();
             const auto data = json["data"_L1].toArray();
@@ -4076,7 +4234,7 @@ void Helix::unpinChatMessage(
         {"message_id"_L1, messageID},
     };
 
-    this->makeDelete("chat/pins", query)
+    this->makeDelete("chat/pins", query, HelixPriority::Interactive)
         .onSuccess([successCallback](const NetworkResult & /*result*/) {
             successCallback();
         })
@@ -4118,7 +4276,8 @@ void Helix::unpinChatMessage(
 }
 
 NetworkRequest Helix::makeRequest(const QString &url, const QUrlQuery &urlQuery,
-                                  NetworkRequestType type)
+                                  NetworkRequestType type,
+                                  HelixPriority priority)
 {
     assert(!url.startsWith("/"));
 
@@ -4152,6 +4311,10 @@ NetworkRequest Helix::makeRequest(const QString &url, const QUrlQuery &urlQuery,
     fullUrl.setQuery(urlQuery);
 
     return NetworkRequest(fullUrl, type)
+        .scheduler([scheduler = this->scheduler,
+                    priority](std::shared_ptr<NetworkData> data) {
+            scheduler->schedule(std::move(data), priority);
+        })
         .timeout(5 * 1000)
         .header("Accept", "application/json")
         .header("Client-ID", this->clientId)
@@ -4162,36 +4325,43 @@ NetworkRequest Helix::makeRequest(const QString &url, const QUrlQuery &urlQuery,
         ;
 }
 
-NetworkRequest Helix::makeGet(const QString &url, const QUrlQuery &urlQuery)
+NetworkRequest Helix::makeGet(const QString &url, const QUrlQuery &urlQuery,
+                              HelixPriority priority)
 {
-    return this->makeRequest(url, urlQuery, NetworkRequestType::Get);
+    return this->makeRequest(url, urlQuery, NetworkRequestType::Get, priority);
 }
 
-NetworkRequest Helix::makeDelete(const QString &url, const QUrlQuery &urlQuery)
+NetworkRequest Helix::makeDelete(const QString &url, const QUrlQuery &urlQuery,
+                                 HelixPriority priority)
 {
-    return this->makeRequest(url, urlQuery, NetworkRequestType::Delete);
+    return this->makeRequest(url, urlQuery, NetworkRequestType::Delete,
+                             priority);
 }
 
-NetworkRequest Helix::makePost(const QString &url, const QUrlQuery &urlQuery)
+NetworkRequest Helix::makePost(const QString &url, const QUrlQuery &urlQuery,
+                               HelixPriority priority)
 {
-    return this->makeRequest(url, urlQuery, NetworkRequestType::Post);
+    return this->makeRequest(url, urlQuery, NetworkRequestType::Post, priority);
 }
 
-NetworkRequest Helix::makePut(const QString &url, const QUrlQuery &urlQuery)
+NetworkRequest Helix::makePut(const QString &url, const QUrlQuery &urlQuery,
+                              HelixPriority priority)
 {
-    return this->makeRequest(url, urlQuery, NetworkRequestType::Put);
+    return this->makeRequest(url, urlQuery, NetworkRequestType::Put, priority);
 }
 
-NetworkRequest Helix::makePatch(const QString &url, const QUrlQuery &urlQuery)
+NetworkRequest Helix::makePatch(const QString &url, const QUrlQuery &urlQuery,
+                                HelixPriority priority)
 {
-    return this->makeRequest(url, urlQuery, NetworkRequestType::Patch);
+    return this->makeRequest(url, urlQuery, NetworkRequestType::Patch,
+                             priority);
 }
 
 void Helix::paginate(
     const QString &url, const QUrlQuery &baseQuery,
     std::function<bool(const QJsonObject &, const HelixPaginationState &state)>
         onPage,
-    std::function<void(NetworkResult)> onError,
+    std::function<void(NetworkResult)> onError, HelixPriority priority,
     CancellationToken &&cancellationToken)
 {
     auto onSuccess =
@@ -4203,7 +4373,7 @@ void Helix::paginate(
     };
 
     *onSuccess = [this, onPage = std::move(onPage), onError, onSuccessCb,
-                  url{url}, baseQuery{baseQuery},
+                  url{url}, baseQuery{baseQuery}, priority,
                   cancellationToken =
                       std::move(cancellationToken)](const NetworkResult &res) {
         if (cancellationToken.isCancelled())
@@ -4235,13 +4405,13 @@ void Helix::paginate(
         query.removeAllQueryItems(u"after"_s);
         query.addQueryItem(u"after"_s, cursor);
 
-        this->makeGet(url, query)
+        this->makeGet(url, query, priority)
             .onSuccess(onSuccessCb)
             .onError(onError)
             .execute();
     };
 
-    this->makeGet(url, baseQuery)
+    this->makeGet(url, baseQuery, priority)
         .onSuccess(std::move(onSuccessCb))
         .onError(std::move(onError))
         .execute();
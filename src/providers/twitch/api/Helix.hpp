@@ -8,6 +8,7 @@
 #include "common/enums/UsernameDisplayMode.hpp"
 #include "common/network/NetworkRequest.hpp"
 #include "providers/twitch/api/HelixEnums.hpp"
+#include "providers/twitch/api/HelixScheduler.hpp"
 #include "providers/twitch/eventsub/SubscriptionRequest.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "util/Helpers.hpp"
@@ -24,7 +25,10 @@
 
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -1683,13 +1687,21 @@ protected:
         FailureCallback<HelixGetModeratorsError, QString> failureCallback);
 
 private:
+    /// `priority` tells the scheduler whether the user is waiting for the
+    /// response (see HelixScheduler)
     NetworkRequest makeRequest(const QString &url, const QUrlQuery &urlQuery,
-                               NetworkRequestType type);
-    NetworkRequest makeGet(const QString &url, const QUrlQuery &urlQuery);
-    NetworkRequest makeDelete(const QString &url, const QUrlQuery &urlQuery);
-    NetworkRequest makePost(const QString &url, const QUrlQuery &urlQuery);
-    NetworkRequest makePut(const QString &url, const QUrlQuery &urlQuery);
-    NetworkRequest makePatch(const QString &url, const QUrlQuery &urlQuery);
+                               NetworkRequestType type,
+                               HelixPriority priority);
+    NetworkRequest makeGet(const QString &url, const QUrlQuery &urlQuery,
+                           HelixPriority priority);
+    NetworkRequest makeDelete(const QString &url, const QUrlQuery &urlQuery,
+                              HelixPriority priority);
+    NetworkRequest makePost(const QString &url, const QUrlQuery &urlQuery,
+                            HelixPriority priority);
+    NetworkRequest makePut(const QString &url, const QUrlQuery &urlQuery,
+                           HelixPriority priority);
+    NetworkRequest makePatch(const QString &url, const QUrlQuery &urlQuery,
+                             HelixPriority priority);
 
     /// Paginate the `url` endpoint and use `baseQuery` as the starting point for pagination.
     /// @param onPage returns true while a new page is expected. Once false is returned, pagination will stop.
@@ -1698,10 +1710,40 @@ private:
                                      const HelixPaginationState &state)>
                       onPage,
                   std::function<void(NetworkResult)> onError,
-                  CancellationToken &&token);
+                  HelixPriority priority, CancellationToken &&token);
+
+    struct UserLookup {
+        ResultCallback<HelixUser> successCallback;
+        HelixFailureCallback failureCallback;
+    };
+    struct UserLookupBatch;
+
+    /// Like fetchUsers, but passes the response to `errorCallback` on errors
+    void requestUsers(const QStringList &userIds, const QStringList &userLogins,
+                      ResultCallback<std::vector<HelixUser>> successCallback,
+                      std::function<void(const NetworkResult &)> errorCallback);
+
+    /// Queues a lookup by ID or login. All lookups queued in one iteration of
+    /// the event loop are sent together (see sendUserLookups).
+    void queueUserLookup(QString key, bool byId,
+                         ResultCallback<HelixUser> successCallback,
+                         HelixFailureCallback failureCallback);
+    /// Sends the queued lookups with as few requests as possible
+    void sendUserLookups();
+    void sendUserLookupBatch(std::shared_ptr<UserLookupBatch> batch);
 
     QString clientId;
     QString oauthToken;
+
+    std::shared_ptr<HelixScheduler> scheduler =
+        std::make_shared<HelixScheduler>();
+
+    std::mutex userLookupsMutex;
+    /// Queued lookups by user ID
+    std::unordered_map<QString, std::vector<UserLookup>> userLookupsById;
+    /// Queued lookups by lowercase login
+    std::unordered_map<QString, std::vector<UserLookup>> userLookupsByLogin;
+    bool userLookupsQueued = false;
 };
 
 // initializeHelix sets the helix instance to _instance
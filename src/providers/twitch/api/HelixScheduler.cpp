@@ -0,0 +1,319 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/api/HelixScheduler.hpp"
+
+#include "common/network/NetworkPrivate.hpp"
+#include "common/network/NetworkResult.hpp"
+#include "common/QLogging.hpp"
+#include "util/DebugCount.hpp"
+#include "util/PostToThread.hpp"
+
+#include <QCoreApplication>
+#include <QStringBuilder>
+#include <QTimer>
+
+#include <optional>
+
+namespace {
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+/// Used if a 429 doesn't say when the bucket is refilled
+constexpr auto DEFAULT_RESET_DELAY = 1s;
+/// Added to the reset time to account for clock skew
+constexpr auto RESET_MARGIN = 250ms;
+
+/// Returns the key under which identical requests are coalesced or an empty
+/// string if the request must be sent on its own
+QString coalescingKey(const NetworkData &data)
+{
+    if (data.requestType != NetworkRequestType::Get)
+    {
+        return {};
+    }
+    return data.request.url().toString() % u'\n' %
+           QString::fromUtf8(data.request.rawHeader("Authorization"));
+}
+
+size_t index(HelixPriority priority)
+{
+    return static_cast<size_t>(priority);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void HelixScheduler::schedule(std::shared_ptr<NetworkData> data,
+                              HelixPriority priority)
+{
+    assert(data != nullptr);
+
+    auto key = coalescingKey(*data);
+    {
+        std::lock_guard lock(this->mutex_);
+        if (!key.isEmpty())
+        {
+            auto it = this->followers_.find(key);
+            if (it != this->followers_.end())
+            {
+                it->second.emplace_back(std::move(data));
+                this->coalesced_++;
+                this->updateDebugCounts();
+                return;
+            }
+            this->followers_.try_emplace(key);
+        }
+
+        data->onResponse = [weak = this->weak_from_this(),
+                            weakData = std::weak_ptr(data), key, priority,
+                            retries = size_t{0}](
+                               const NetworkResult &result) mutable {
+            auto self = weak.lock();
+            auto data = weakData.lock();
+            if (!self || !data)
+            {
+                return true;
+            }
+            return self->handleResponse(data, result, key, priority, retries);
+        };
+
+        this->queues_[index(priority)].push_back({
+            .data = std::move(data),
+            .queuedAt = Clock::now(),
+        });
+    }
+
+    this->pump();
+}
+
+HelixScheduler::Metrics HelixScheduler::metrics() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->metricsLocked();
+}
+
+HelixScheduler::Metrics HelixScheduler::metricsLocked() const
+{
+    Metrics metrics{
+        .queued = 0,
+        .inFlight = this->inFlight_,
+        .coalesced = this->coalesced_,
+        .retried = this->retried_,
+        .remaining = this->remaining_,
+        .averageWait = {},
+    };
+    for (const auto &queue : this->queues_)
+    {
+        metrics.queued += queue.size();
+    }
+    if (this->sent_ > 0)
+    {
+        metrics.averageWait =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                this->totalWait_ / this->sent_);
+    }
+    return metrics;
+}
+
+bool HelixScheduler::handleResponse(const std::shared_ptr<NetworkData> &data,
+                                    const NetworkResult &result,
+                                    const QString &key, HelixPriority priority,
+                                    size_t &retries)
+{
+    std::vector<std::shared_ptr<NetworkData>> followers;
+    bool retry = false;
+    {
+        std::lock_guard lock(this->mutex_);
+        assert(this->inFlight_ > 0);
+        this->inFlight_--;
+        this->updateBucket(result);
+
+        // a multipart payload can only be sent once
+        retry = result.status() == 429 && retries < MAX_RETRIES &&
+                data->multiPartPayload == nullptr;
+        if (retry)
+        {
+            retries++;
+            this->retried_++;
+            // the request was queued first, so it goes before newer ones
+            this->queues_[index(priority)].push_front({
+                .data = data,
+                .queuedAt = Clock::now(),
+            });
+        }
+        else if (!key.isEmpty())
+        {
+            auto it = this->followers_.find(key);
+            if (it != this->followers_.end())
+            {
+                followers = std::move(it->second);
+                this->followers_.erase(it);
+            }
+        }
+        this->updateDebugCounts();
+    }
+
+    if (retry)
+    {
+        qCDebug(chatterinoTwitch)
+            << "Helix rate limit exceeded, queueing request again"
+            << data->request.url().toString();
+    }
+
+    for (const auto &follower : followers)
+    {
+        NetworkResult copy = result;
+        if (result.error() == NetworkResult::NetworkError::NoError)
+        {
+            follower->emitSuccess(std::move(copy));
+        }
+        else
+        {
+            follower->emitError(std::move(copy));
+        }
+        follower->emitFinally();
+    }
+
+    this->pump();
+
+    return !retry;
+}
+
+void HelixScheduler::pump()
+{
+    std::vector<std::shared_ptr<NetworkData>> ready;
+    std::optional<std::chrono::milliseconds> wakeUp;
+    {
+        std::lock_guard lock(this->mutex_);
+        auto now = Clock::now();
+
+        // interactive requests go first
+        for (auto priority :
+             {HelixPriority::Interactive, HelixPriority::Background})
+        {
+            auto &queue = this->queues_[index(priority)];
+            while (!queue.empty() && this->canSend(priority))
+            {
+                auto &request = queue.front();
+                this->inFlight_++;
+                this->sent_++;
+                this->totalWait_ += now - request.queuedAt;
+                ready.emplace_back(std::move(request.data));
+                queue.pop_front();
+            }
+        }
+
+        bool waiting = !this->queues_[0].empty() || !this->queues_[1].empty();
+        // with requests in flight, their responses wake us up
+        if (waiting && this->inFlight_ == 0 && !this->wakeUpPending_)
+        {
+            this->wakeUpPending_ = true;
+            wakeUp = std::max(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    this->resetAt_ - std::chrono::system_clock::now() +
+                    RESET_MARGIN),
+                std::chrono::milliseconds{RESET_MARGIN});
+        }
+        this->updateDebugCounts();
+    }
+
+    for (auto &data : ready)
+    {
+        loadScheduled(std::move(data));
+    }
+    if (wakeUp)
+    {
+        this->wakeUpIn(*wakeUp);
+    }
+}
+
+void HelixScheduler::wakeUpIn(std::chrono::milliseconds delay)
+{
+    postToThread([weak = this->weak_from_this(), delay] {
+        QTimer::singleShot(delay, QCoreApplication::instance(), [weak] {
+            auto self = weak.lock();
+            if (!self)
+            {
+                return;
+            }
+            {
+                std::lock_guard lock(self->mutex_);
+                self->wakeUpPending_ = false;
+            }
+            self->pump();
+        });
+    });
+}
+
+bool HelixScheduler::canSend(HelixPriority priority)
+{
+    if (this->remaining_ >= 0 &&
+        std::chrono::system_clock::now() >= this->resetAt_)
+    {
+        // the bucket was refilled, we'll know its size after the next request
+        this->remaining_ = -1;
+    }
+
+    if (this->remaining_ < 0)
+    {
+        return this->inFlight_ < MAX_IN_FLIGHT;
+    }
+
+    // every request in flight costs at least one point
+    auto available =
+        this->remaining_ - static_cast<int64_t>(this->inFlight_);
+    if (priority == HelixPriority::Interactive)
+    {
+        return available > 0;
+    }
+    return available > INTERACTIVE_RESERVE;
+}
+
+void HelixScheduler::updateBucket(const NetworkResult &result)
+{
+    bool ok = false;
+    auto remaining = result.rawHeader("Ratelimit-Remaining").toLongLong(&ok);
+    if (ok)
+    {
+        this->remaining_ = remaining;
+    }
+
+    auto reset = result.rawHeader("Ratelimit-Reset").toLongLong(&ok);
+    if (ok)
+    {
+        this->resetAt_ = std::chrono::system_clock::time_point(
+            std::chrono::seconds(reset));
+    }
+    else if (result.status() == 429)
+    {
+        this->resetAt_ =
+            std::chrono::system_clock::now() + DEFAULT_RESET_DELAY;
+    }
+
+    if (result.status() == 429)
+    {
+        this->remaining_ = 0;
+    }
+}
+
+void HelixScheduler::updateDebugCounts() const
+{
+    auto metrics = this->metricsLocked();
+    DebugCount::set(DebugObject::HelixRequestsQueued,
+                    static_cast<int64_t>(metrics.queued));
+    DebugCount::set(DebugObject::HelixRequestsInFlight,
+                    static_cast<int64_t>(metrics.inFlight));
+    DebugCount::set(DebugObject::HelixRequestsCoalesced,
+                    static_cast<int64_t>(metrics.coalesced));
+    DebugCount::set(DebugObject::HelixRequestsRetried,
+                    static_cast<int64_t>(metrics.retried));
+    DebugCount::set(DebugObject::HelixRatelimitRemaining, metrics.remaining);
+    DebugCount::set(DebugObject::HelixRequestWaitMs,
+                    metrics.averageWait.count());
+}
+
+}  // namespace chatterino
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+class NetworkData;
+class NetworkResult;
+
+enum class HelixPriority : uint8_t {
+    /// Requests the user is waiting for (e.g. moderation actions)
+    Interactive,
+    /// Requests that load or refresh data in the background
+    Background,
+};
+
+/// @brief Sends Helix requests within the rate limit of the user's token.
+///
+/// Helix gives each token a bucket of points that is refilled every minute
+/// and reports its state in the `Ratelimit-Remaining` and `Ratelimit-Reset`
+/// headers. Once the bucket is (almost) empty, the scheduler holds requests
+/// back until it's refilled. A few points are reserved for interactive
+/// requests, so background refreshes can't starve them.
+///
+/// Identical GET requests are coalesced while one of them is in flight: only
+/// the first one is sent and the others get a copy of its response. Requests
+/// that were rejected with 429 are queued again instead of failing.
+///
+/// All methods are thread-safe.
+class HelixScheduler : public std::enable_shared_from_this<HelixScheduler>
+{
+public:
+    struct Metrics {
+        /// Requests waiting for points
+        size_t queued = 0;
+        /// Requests that were sent and didn't get a response yet
+        size_t inFlight = 0;
+        /// Requests that got the response of an identical request
+        size_t coalesced = 0;
+        /// Requests that were queued again after a 429
+        size_t retried = 0;
+        /// Points left as of the last response or -1 if that's unknown
+        int64_t remaining = -1;
+        /// Average time requests spent in the queue
+        std::chrono::milliseconds averageWait{0};
+    };
+
+    /// Points that are only used by interactive requests
+    static constexpr int64_t INTERACTIVE_RESERVE = 10;
+    /// Upper bound for requests in flight while the bucket is unknown
+    static constexpr size_t MAX_IN_FLIGHT = 16;
+    /// How often a request is queued again after a 429
+    static constexpr size_t MAX_RETRIES = 2;
+
+    /// Sends `data` once there are points left (see NetworkRequest::scheduler)
+    void schedule(std::shared_ptr<NetworkData> data, HelixPriority priority);
+
+    /// Returns the state of the queues. The same numbers are shown in the
+    /// debug popup (see DebugCount).
+    Metrics metrics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request {
+        std::shared_ptr<NetworkData> data;
+        Clock::time_point queuedAt;
+    };
+
+    /// Called with every response of a request that was sent
+    bool handleResponse(const std::shared_ptr<NetworkData> &data,
+                        const NetworkResult &result, const QString &key,
+                        HelixPriority priority, size_t &retries);
+
+    /// Sends as many queued requests as the bucket allows
+    void pump();
+    /// Calls pump() in `delay` on the GUI thread
+    void wakeUpIn(std::chrono::milliseconds delay);
+
+    /// Must be called with mutex_ held
+    bool canSend(HelixPriority priority);
+    /// Must be called with mutex_ held
+    void updateBucket(const NetworkResult &result);
+    /// Must be called with mutex_ held
+    Metrics metricsLocked() const;
+    /// Must be called with mutex_ held
+    void updateDebugCounts() const;
+
+    mutable std::mutex mutex_;
+
+    std::array<std::deque<Request>, 2> queues_;
+    /// Requests waiting for the response of an identical GET, by its key.
+    /// An entry exists for every coalescable GET in flight.
+    std::unordered_map<QString, std::vector<std::shared_ptr<NetworkData>>>
+        followers_;
+    size_t inFlight_ = 0;
+    bool wakeUpPending_ = false;
+
+    int64_t remaining_ = -1;
+    std::chrono::system_clock::time_point resetAt_;
+
+    size_t coalesced_ = 0;
+    size_t retried_ = 0;
+    size_t sent_ = 0;
+    Clock::duration totalWait_{0};
+};
+
+}  // namespace chatterino
@@ -28,9 +28,9 @@ void handleModerateMessage(
             MessageBuilder::makeClearChatMessage(time, actor), time);
         if (getSettings()->hideModerated)
         {
-            // XXX: This is expensive. We could use a layout request if the layout
-            //      would store the previous message flags.
-            getApp()->getWindows()->forceLayoutChannelViews();
+            // only the disabled messages are laid out again
+            getApp()->getWindows()->layoutChannelViews(
+                chan, chan->getMessageSnapshot());
         }
     });
 }
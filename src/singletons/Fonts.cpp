@@ -207,6 +207,25 @@ QFontMetricsF Fonts::getFontMetrics(FontStyle type, float scale)
     return this->getOrCreateFontData(type, scale).metrics;
 }
 
+qreal Fonts::getTextWidth(FontStyle type, float scale, const QString &text)
+{
+    auto &data = this->getOrCreateFontData(type, scale);
+    if (data.textWidths.exists(text))
+    {
+        return data.textWidths.get(text);
+    }
+
+    auto width = data.metrics.horizontalAdvance(text);
+    data.textWidths.put(text, width);
+    return width;
+}
+
+bool Fonts::hasCachedTextWidth(FontStyle type, float scale,
+                               const QString &text)
+{
+    return this->getOrCreateFontData(type, scale).textWidths.exists(text);
+}
+
 Fonts::FontData &Fonts::getOrCreateFontData(FontStyle type, float scale)
 {
     assertInGuiThread();
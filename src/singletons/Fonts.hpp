@@ -6,6 +6,7 @@
 
 #include "pajlada/settings/settinglistener.hpp"
 
+#include <lrucache/lrucache.hpp>
 #include <pajlada/signals/signal.hpp>
 #include <QFont>
 #include <QFontMetrics>
@@ -53,6 +54,15 @@ public:
     QFont getFont(FontStyle type, float scale);
     QFontMetricsF getFontMetrics(FontStyle type, float scale);
 
+    /// Returns the horizontal advance of `text` in the font.
+    ///
+    /// The widths of recently measured texts are cached, so laying out the
+    /// same words again (e.g. when a split is resized) doesn't shape them
+    /// again.
+    qreal getTextWidth(FontStyle type, float scale, const QString &text);
+    /// Returns true if the width of `text` in the font is cached
+    bool hasCachedTextWidth(FontStyle type, float scale, const QString &text);
+
     pajlada::Signals::NoArgSignal fontChanged;
 
 private:
@@ -60,11 +70,16 @@ private:
         FontData(const QFont &_font)
             : font(_font)
             , metrics(_font)
+            , textWidths(TEXT_WIDTH_CACHE_SIZE)
         {
         }
 
+        /// Number of texts per font whose width is cached
+        static constexpr size_t TEXT_WIDTH_CACHE_SIZE = 8192;
+
         const QFont font;
         const QFontMetricsF metrics;
+        cache::lru_cache<QString, qreal> textWidths;
     };
 
     struct ChatFontData {
@@ -6,17 +6,25 @@
 
 #include "messages/Message.hpp"
 #include "singletons/helper/LoggingChannel.hpp"
+#include "singletons/helper/LogWriter.hpp"
 #include "singletons/Settings.hpp"
 
 #include <QDir>
 #include <QStandardPaths>
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <utility>
 
 namespace chatterino {
 
 Logging::Logging(Settings &settings)
+    : writer(std::make_unique<LogWriter>(LogWriter::Options{
+          .flushInterval = std::chrono::milliseconds(
+              std::max(settings.logFlushInterval.getValue(), 0)),
+          .flushBytes = std::max(settings.logFlushSize.getValue(), 0),
+      }))
 {
     // We can safely ignore this signal connection since settings are only-ever destroyed
     // on application exit
@@ -33,6 +41,25 @@ Logging::Logging(Settings &settings)
                 this->onlyLogListedChannels.insert(loggedChannel.channelName());
             }
         });
+
+    settings.logFlushInterval.connect(
+        [this](int interval) {
+            this->writer->setFlushInterval(
+                std::chrono::milliseconds(std::max(interval, 0)));
+        },
+        this->managedConnections, false);
+    settings.logFlushSize.connect(
+        [this](int bytes) {
+            this->writer->setFlushBytes(std::max(bytes, 0));
+        },
+        this->managedConnections, false);
+}
+
+Logging::~Logging()
+{
+    // Enqueue the closing lines of all channels before the writer drains its
+    // queue and stops
+    this->loggingChannels_.clear();
 }
 
 void Logging::addMessage(const QString &channelName, MessagePtr message,
@@ -61,7 +88,8 @@ void Logging::addMessage(const QString &channelName, MessagePtr message,
     auto platIt = this->loggingChannels_.find(platformName);
     if (platIt == this->loggingChannels_.end())
     {
-        auto *channel = new LoggingChannel(channelName, platformName);
+        auto *channel =
+            new LoggingChannel(channelName, platformName, *this->writer);
         channel->addMessage(message, streamID);
         auto map = std::map<QString, std::unique_ptr<LoggingChannel>>();
         this->loggingChannels_[platformName] = std::move(map);
@@ -72,7 +100,8 @@ void Logging::addMessage(const QString &channelName, MessagePtr message,
     auto chanIt = platIt->second.find(channelName);
     if (chanIt == platIt->second.end())
     {
-        auto *channel = new LoggingChannel(channelName, platformName);
+        auto *channel =
+            new LoggingChannel(channelName, platformName, *this->writer);
         channel->addMessage(message, streamID);
         platIt->second.emplace(channelName, channel);
     }
@@ -7,11 +7,13 @@
 #include "util/QStringHash.hpp"
 #include "util/ThreadGuard.hpp"
 
+#include <pajlada/signals/scoped-connection.hpp>
 #include <QString>
 
 #include <map>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace chatterino {
 
@@ -19,6 +21,7 @@ class Settings;
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
 class LoggingChannel;
+class LogWriter;
 
 class ILogging
 {
@@ -37,6 +40,12 @@ class Logging : public ILogging
 {
 public:
     Logging(Settings &settings);
+    ~Logging() override;
+
+    Logging(const Logging &) = delete;
+    Logging &operator=(const Logging &) = delete;
+    Logging(Logging &&) = delete;
+    Logging &operator=(Logging &&) = delete;
 
     void addMessage(const QString &channelName, MessagePtr message,
                     const QString &platformName,
@@ -46,6 +55,10 @@ public:
                       const QString &platformName) override;
 
 private:
+    // Declared before the channels so it outlives them and can write their
+    // closing lines
+    std::unique_ptr<LogWriter> writer;
+
     using PlatformName = QString;
     using ChannelName = QString;
     std::map<PlatformName,
@@ -55,6 +68,9 @@ private:
     // Keeps the value of the `loggedChannels` settings
     std::unordered_set<ChannelName> onlyLogListedChannels;
     ThreadGuard threadGuard;
+
+    std::vector<std::unique_ptr<pajlada::Signals::ScopedConnection>>
+        managedConnections;
 };
 
 }  // namespace chatterino
@@ -679,6 +679,12 @@ public:
         false,
     };
     QStringSetting logPath = {"/logging/path", ""};
+    /// How long (in milliseconds) log lines may be buffered before they are
+    /// written to disk
+    IntSetting logFlushInterval = {"/logging/flushInterval", 1000};
+    /// How many bytes may be buffered per log file before they are written
+    /// to disk
+    IntSetting logFlushSize = {"/logging/flushSize", 64 * 1024};
 
     QStringSetting pathHighlightSound = {"/highlighting/highlightSoundPath",
                                          ""};
@@ -767,6 +773,16 @@ public:
         ThumbnailPreviewMode::AlwaysShow,
     };
     QStringSetting cachePath = {"/cache/path", ""};
+    /// Maximum size of the HTTP cache in MiB
+    IntSetting cacheMaxSize = {"/cache/maxSize", 1024};
+    /// Maximum memory used by the buffers messages are painted into in MiB
+    IntSetting messageBufferBudget = {"/misc/messageBuffers/budget", 256};
+    /// Messages up to this height (in pixels) are painted without a buffer
+    IntSetting messageBufferDirectPaintMaxHeight = {
+        "/misc/messageBuffers/directPaintMaxHeight", 0};
+    /// Seconds after which hidden splits release their message layouts.
+    /// 0 keeps them.
+    IntSetting dormantSplitDelay = {"/misc/dormantSplits/delay", 60};
     BoolSetting attachExtensionToAnyProcess = {
         "/misc/attachExtensionToAnyProcess", false};
     BoolSetting askOnImageUpload = {"/misc/askOnImageUpload", true};
@@ -826,6 +842,10 @@ public:
         "/plugins/enabledPlugins",
         {},
     };
+    /// Lua instructions a plugin may run in one call from Chatterino before
+    /// the call is aborted. 0 disables the limit.
+    IntSetting pluginInstructionBudget = {"/plugins/instructionBudget",
+                                          50'000'000};
 
     // Sound
     EnumStringSetting<SoundBackend> soundBackend = {
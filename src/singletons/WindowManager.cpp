@@ -276,12 +276,24 @@ void WindowManager::layoutChannelViews(Channel *channel)
     this->layoutRequested.invoke(channel);
 }
 
+void WindowManager::layoutChannelViews(
+    Channel *channel, const std::vector<MessagePtr> &changedMessages)
+{
+    this->messagesChanged.invoke(channel, changedMessages);
+}
+
 void WindowManager::forceLayoutChannelViews()
 {
     this->incGeneration();
     this->layoutChannelViews(nullptr);
 }
 
+void WindowManager::notifyImagesLoaded()
+{
+    this->imageGeneration_++;
+    this->imagesLoaded.invoke();
+}
+
 void WindowManager::invalidateChannelViewBuffers(Channel *channel)
 {
     this->invalidateBuffersRequested.invoke(channel);
@@ -730,6 +742,11 @@ void WindowManager::incGeneration()
     this->generation_++;
 }
 
+size_t WindowManager::getImageGeneration() const
+{
+    return this->imageGeneration_;
+}
+
 WindowLayout WindowManager::loadWindowLayoutFromFile() const
 {
     return WindowLayout::loadFromFile(this->windowLayoutFilePath);
@@ -16,6 +16,7 @@
 #include <memory>
 #include <set>
 #include <span>
+#include <vector>
 
 namespace chatterino {
 
@@ -80,14 +81,25 @@ public:
     void showAccountSelectPopup(QPoint point);
 
     // Tell a channel (or all channels if channel is nullptr) to redo their
-    // layout
+    // layout. Only messages that changed since their last layout (e.g. ones
+    // that were disabled) are redone.
     void layoutChannelViews(Channel *channel = nullptr);
 
-    // Force all channel views to redo their layout
+    // Tell the views of a channel and all other views that may show one of
+    // the messages (e.g. /mentions or a usercard) to redo their layout. Used
+    // when the messages were changed in place, e.g. disabled by a timeout.
+    void layoutChannelViews(Channel *channel,
+                            const std::vector<MessagePtr> &changedMessages);
+
+    // Force all channel views to redo the layout of every message
     // This is called, for example, when the emote scale or timestamp format has
-    // changed
+    // changed. Use layoutChannelViews if only some messages changed.
     void forceLayoutChannelViews();
 
+    // Tell all views that some images finished loading. Only messages that
+    // were laid out while one of their images was still loading are redone.
+    void notifyImagesLoaded();
+
     // Tell a channel (or all channels if channel is nullptr) to invalidate all paint buffers
     void invalidateChannelViewBuffers(Channel *channel = nullptr);
 
@@ -136,6 +148,9 @@ public:
     int getGeneration() const;
     void incGeneration();
 
+    /// Incremented every time images finished loading
+    size_t getImageGeneration() const;
+
     MessageElementFlags getWordFlags();
     void updateWordTypeMask();
 
@@ -162,9 +177,16 @@ public:
     // This signal fires whenever views rendering a channel, or all views if the
     // channel is a nullptr, need to redo their layout
     pajlada::Signals::Signal<Channel *> layoutRequested;
+    // This signal fires whenever messages of a channel were changed in place
+    // and the views that show them need to redo their layout
+    pajlada::Signals::Signal<Channel *, const std::vector<MessagePtr> &>
+        messagesChanged;
     // This signal fires whenever views rendering a channel, or all views if the
     // channel is a nullptr, need to invalidate their paint buffers
     pajlada::Signals::Signal<Channel *> invalidateBuffersRequested;
+    // This signal fires whenever images that may be shown in a view finished
+    // loading. See notifyImagesLoaded().
+    pajlada::Signals::NoArgSignal imagesLoaded;
 
     pajlada::Signals::NoArgSignal wordFlagsChanged;
 
@@ -197,6 +219,7 @@ private:
     QRect emotePopupBounds_;
 
     std::atomic<int> generation_{0};
+    std::atomic<size_t> imageGeneration_{0};
 
     std::vector<Window *> windows_;
 
@@ -5,8 +5,10 @@
 #include "singletons/helper/GifTimer.hpp"
 
 #include "Application.hpp"
+#include "messages/Image.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/WindowManager.hpp"
+#include "util/DebugCount.hpp"
 
 #include <QApplication>
 
@@ -37,7 +39,17 @@ void GIFTimer::initialize()
         }
 
         this->position_ += GIF_FRAME_LENGTH;
+
+        auto sequence = Image::frameSequence();
         this->signal.invoke();
+        if (Image::frameSequence() == sequence)
+        {
+            // No animation advanced to its next frame (most frames are longer
+            // than GIF_FRAME_LENGTH), so there's nothing to repaint.
+            DebugCount::increase(DebugObject::AnimationTicksSkipped);
+            return;
+        }
+
         getApp()->getWindows()->repaintGifEmotes();
     });
 }
@@ -0,0 +1,393 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "singletons/helper/LogWriter.hpp"
+
+#include "common/QLogging.hpp"
+#include "util/DebugCount.hpp"
+#include "util/OnceFlag.hpp"
+#include "util/RenameThread.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <cassert>
+#include <optional>
+#include <vector>
+
+namespace chatterino {
+
+using Clock = std::chrono::steady_clock;
+
+/// State owned by the writer thread
+class LogWriter::Files
+{
+public:
+    void process(Record &record, const Options &options)
+    {
+        switch (record.kind)
+        {
+            case Record::Kind::Open:
+                this->open(record.filePath, record.data);
+                break;
+
+            case Record::Kind::Append: {
+                auto it = this->files.find(record.filePath);
+                if (it == this->files.end() || !it->second->handle.isOpen())
+                {
+                    // the file wasn't opened or failed to open
+                    return;
+                }
+                auto &file = *it->second;
+                if (file.pending.isEmpty())
+                {
+                    file.firstPending = Clock::now();
+                }
+                file.pending.append(record.data.toUtf8());
+                if (file.pending.size() >= options.flushBytes)
+                {
+                    writePending(file);
+                }
+            }
+            break;
+
+            case Record::Kind::Close: {
+                auto it = this->files.find(record.filePath);
+                if (it == this->files.end())
+                {
+                    return;
+                }
+                auto &file = *it->second;
+                file.pending.append(record.data.toUtf8());
+                writePending(file);
+                if (--file.openCount == 0)
+                {
+                    file.handle.close();
+                    this->files.erase(it);
+                }
+            }
+            break;
+
+            case Record::Kind::Barrier:
+                this->flushAll();
+                record.barrier->set();
+                break;
+
+            case Record::Kind::Sync:
+                this->syncs.push_back(record.barrier);
+                break;
+        }
+    }
+
+    /// Releases the callers of LogWriter::sync. Called once a batch of
+    /// records and the expired buffers are written.
+    void notifySyncs()
+    {
+        for (auto *sync : this->syncs)
+        {
+            sync->set();
+        }
+        this->syncs.clear();
+    }
+
+    /// Writes out all buffers that have been pending for at least `interval`
+    void flushExpired(std::chrono::milliseconds interval)
+    {
+        auto now = Clock::now();
+        for (auto &[path, file] : this->files)
+        {
+            if (!file->pending.isEmpty() &&
+                now - file->firstPending >= interval)
+            {
+                writePending(*file);
+            }
+        }
+    }
+
+    void flushAll()
+    {
+        for (auto &[path, file] : this->files)
+        {
+            writePending(*file);
+        }
+    }
+
+    /// The point in time at which the oldest pending buffer expires
+    std::optional<Clock::time_point> nextFlush(
+        std::chrono::milliseconds interval) const
+    {
+        std::optional<Clock::time_point> next;
+        for (const auto &[path, file] : this->files)
+        {
+            if (file->pending.isEmpty())
+            {
+                continue;
+            }
+            auto at = file->firstPending + interval;
+            if (!next || at < *next)
+            {
+                next = at;
+            }
+        }
+        return next;
+    }
+
+private:
+    struct File {
+        QFile handle;
+        QByteArray pending;
+        Clock::time_point firstPending;
+        /// Number of opens that weren't closed yet
+        size_t openCount = 0;
+    };
+
+    void open(const QString &filePath, const QString &header)
+    {
+        // Another channel (or a reopened one) might already be writing here.
+        // Files that failed to open are tracked too, so every close is
+        // matched by an open.
+        auto &file = this->files[filePath];
+        if (!file)
+        {
+            file = std::make_unique<File>();
+            file->handle.setFileName(filePath);
+        }
+        file->openCount++;
+
+        if (!file->handle.isOpen())
+        {
+            auto directory = QFileInfo(filePath).absolutePath();
+            if (!QDir().mkpath(directory))
+            {
+                qCDebug(chatterinoHelper) << "Unable to create logging path";
+                return;
+            }
+
+            qCDebug(chatterinoHelper) << "Logging to" << filePath;
+
+            if (!file->handle.open(QIODevice::Append))
+            {
+                qCDebug(chatterinoHelper)
+                    << "Failed to open file" << file->handle.errorString();
+                return;
+            }
+        }
+
+        file->pending.append(header.toUtf8());
+        writePending(*file);
+    }
+
+    static void writePending(File &file)
+    {
+        if (!file.handle.isOpen())
+        {
+            // the file failed to open
+            file.pending.clear();
+            return;
+        }
+        if (file.pending.isEmpty())
+        {
+            return;
+        }
+
+        file.handle.write(file.pending);
+        file.handle.flush();
+        file.pending.clear();
+    }
+
+    std::unordered_map<QString, std::unique_ptr<File>> files;
+    std::vector<OnceFlag *> syncs;
+};
+
+LogWriter::LogWriter()
+    : LogWriter(Options{})
+{
+}
+
+LogWriter::LogWriter(Options options)
+    : options(options)
+    , files(std::make_unique<Files>())
+{
+    this->thread = std::make_unique<std::thread>([this] {
+        this->run();
+    });
+    renameThread(*this->thread, "C2ChatLogs");
+}
+
+LogWriter::~LogWriter()
+{
+    {
+        std::unique_lock lock(this->mutex);
+        this->stopping = true;
+    }
+    this->condvar.notify_one();
+
+    // The writer drains the queue before exiting
+    if (this->thread->joinable())
+    {
+        this->thread->join();
+    }
+}
+
+void LogWriter::open(const QString &filePath, const QString &header)
+{
+    this->enqueue({
+        .kind = Record::Kind::Open,
+        .filePath = filePath,
+        .data = header,
+    });
+}
+
+void LogWriter::append(const QString &filePath, const QString &line)
+{
+    this->enqueue({
+        .kind = Record::Kind::Append,
+        .filePath = filePath,
+        .data = line,
+    });
+}
+
+void LogWriter::close(const QString &filePath, const QString &footer)
+{
+    this->enqueue({
+        .kind = Record::Kind::Close,
+        .filePath = filePath,
+        .data = footer,
+    });
+}
+
+void LogWriter::flush()
+{
+    OnceFlag done;
+    this->enqueue({
+        .kind = Record::Kind::Barrier,
+        .barrier = &done,
+    });
+    done.wait();
+}
+
+void LogWriter::sync()
+{
+    OnceFlag done;
+    this->enqueue({
+        .kind = Record::Kind::Sync,
+        .barrier = &done,
+    });
+    done.wait();
+}
+
+void LogWriter::setFlushInterval(std::chrono::milliseconds interval)
+{
+    {
+        std::unique_lock lock(this->mutex);
+        this->options.flushInterval = interval;
+    }
+    this->condvar.notify_one();
+}
+
+void LogWriter::setFlushBytes(qsizetype bytes)
+{
+    std::unique_lock lock(this->mutex);
+    this->options.flushBytes = bytes;
+}
+
+size_t LogWriter::droppedRecords() const
+{
+    return this->dropped.load(std::memory_order_relaxed);
+}
+
+void LogWriter::enqueue(Record &&record)
+{
+    {
+        std::unique_lock lock(this->mutex);
+        assert(!this->stopping);
+
+        // Only plain lines may be dropped - opening, closing and barriers
+        // must reach the writer to keep the file state consistent.
+        if (record.kind == Record::Kind::Append &&
+            this->queue.size() >= this->options.queueCapacity)
+        {
+            this->dropped.fetch_add(1, std::memory_order_relaxed);
+            this->droppedPerFile[record.filePath]++;
+            DebugCount::increase(DebugObject::LogRecordsDropped);
+            return;
+        }
+
+        // Note the gap in the file before its next record. This goes over
+        // the capacity by one record at most.
+        auto it = this->droppedPerFile.find(record.filePath);
+        if (it != this->droppedPerFile.end())
+        {
+            this->queue.push_back({
+                .kind = Record::Kind::Append,
+                .filePath = record.filePath,
+                .data = QString("# %1 lines dropped, logging fell behind\n")
+                            .arg(it->second),
+            });
+            this->droppedPerFile.erase(it);
+            DebugCount::increase(DebugObject::LogRecordsQueued);
+        }
+
+        this->queue.emplace_back(std::move(record));
+    }
+    DebugCount::increase(DebugObject::LogRecordsQueued);
+    this->condvar.notify_one();
+}
+
+void LogWriter::run()
+{
+    std::deque<Record> batch;
+
+    while (true)
+    {
+        bool stop = false;
+        Options current;
+        {
+            std::unique_lock lock(this->mutex);
+            auto hasWork = [this] {
+                return this->stopping || !this->queue.empty();
+            };
+            auto nextFlush =
+                this->files->nextFlush(this->options.flushInterval);
+            if (nextFlush)
+            {
+                this->condvar.wait_until(lock, *nextFlush, hasWork);
+            }
+            else
+            {
+                this->condvar.wait(lock, hasWork);
+            }
+
+            batch.swap(this->queue);
+            stop = this->stopping;
+            current = this->options;
+        }
+
+        if (!batch.empty())
+        {
+            DebugCount::decrease(DebugObject::LogRecordsQueued,
+                                 static_cast<int64_t>(batch.size()));
+        }
+
+        for (auto &record : batch)
+        {
+            this->files->process(record, current);
+        }
+        batch.clear();
+
+        if (stop)
+        {
+            // No more records can be enqueued at this point
+            this->files->flushAll();
+            this->files->notifySyncs();
+            return;
+        }
+
+        this->files->flushExpired(current.flushInterval);
+        this->files->notifySyncs();
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace chatterino {
+
+class OnceFlag;
+
+/// Writes chat log files on a dedicated thread.
+///
+/// The GUI thread only enqueues pre-formatted records. Appends to the same
+/// file are coalesced and written out once the buffered data reaches
+/// `flushBytes`, or once `flushInterval` has passed since the last write.
+/// All queued records are written before the writer is destroyed.
+class LogWriter
+{
+public:
+    struct Options {
+        /// Maximum time a line may sit in the write buffer
+        std::chrono::milliseconds flushInterval{1000};
+        /// Buffered bytes per file after which the buffer is written out
+        qsizetype flushBytes = 64 * 1024;
+        /// Maximum number of records waiting for the writer thread.
+        /// Lines appended while the queue is full are dropped. The next
+        /// record for the same file is preceded by a line that states how
+        /// many lines were dropped.
+        size_t queueCapacity = 16384;
+    };
+
+    LogWriter();
+    explicit LogWriter(Options options);
+    ~LogWriter();
+
+    LogWriter(const LogWriter &) = delete;
+    LogWriter &operator=(const LogWriter &) = delete;
+    LogWriter(LogWriter &&) = delete;
+    LogWriter &operator=(LogWriter &&) = delete;
+
+    /// Opens `filePath` for appending, creating its directory if needed,
+    /// and writes `header` to it.
+    ///
+    /// A file can be opened multiple times (e.g. by channels sharing a log
+    /// file). It stays open until every open is matched by a #close().
+    void open(const QString &filePath, const QString &header);
+
+    /// Appends `line` to the previously opened `filePath`
+    void append(const QString &filePath, const QString &line);
+
+    /// Writes `footer` to `filePath` and closes it once it was closed as
+    /// often as it was opened
+    void close(const QString &filePath, const QString &footer);
+
+    /// Blocks until all records enqueued before this call are written to disk
+    void flush();
+
+    /// Blocks until all records enqueued before this call are processed.
+    /// Unlike #flush(), lines stay buffered until they're due.
+    ///
+    /// This should only be used in tests.
+    void sync();
+
+    void setFlushInterval(std::chrono::milliseconds interval);
+    void setFlushBytes(qsizetype bytes);
+
+    /// Number of lines dropped because the queue was full
+    size_t droppedRecords() const;
+
+private:
+    struct Record {
+        enum class Kind : uint8_t {
+            Open,
+            Append,
+            Close,
+            /// Flushes all files and sets `barrier`
+            Barrier,
+            /// Sets `barrier` once the records before it are processed
+            Sync,
+        };
+
+        Kind kind;
+        QString filePath;
+        QString data;
+        OnceFlag *barrier = nullptr;
+    };
+
+    class Files;
+
+    void enqueue(Record &&record);
+    void run();
+
+    Options options;
+
+    mutable std::mutex mutex;
+    std::condition_variable condvar;
+    std::deque<Record> queue;
+    bool stopping = false;
+
+    std::atomic<size_t> dropped = 0;
+    /// Lines dropped per file since the last record that reached the queue
+    std::unordered_map<QString, size_t> droppedPerFile;
+
+    std::unique_ptr<Files> files;
+    std::unique_ptr<std::thread> thread;
+};
+
+}  // namespace chatterino
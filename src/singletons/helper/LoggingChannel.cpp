@@ -5,9 +5,9 @@
 #include "singletons/helper/LoggingChannel.hpp"
 
 #include "Application.hpp"
-#include "common/QLogging.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageThread.hpp"
+#include "singletons/helper/LogWriter.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Settings.hpp"
 
@@ -18,15 +18,6 @@ namespace {
 
 const QByteArray ENDLINE("\n");
 
-void appendLine(QFile &fileHandle, const QString &line)
-{
-    assert(fileHandle.isOpen());
-    assert(fileHandle.isWritable());
-
-    fileHandle.write(line.toUtf8());
-    fileHandle.flush();
-}
-
 QString generateOpeningString(
     const QDateTime &now = QDateTime::currentDateTime())
 {
@@ -60,9 +51,11 @@ QString generateDateString(const QDateTime &now)
 
 namespace chatterino {
 
-LoggingChannel::LoggingChannel(QString _channelName, QString _platform)
+LoggingChannel::LoggingChannel(QString _channelName, QString _platform,
+                               LogWriter &writer)
     : channelName(std::move(_channelName))
     , platform(std::move(_platform))
+    , writer(writer)
 {
     if (this->channelName.startsWith("/whispers"))
     {
@@ -101,9 +94,14 @@ LoggingChannel::LoggingChannel(QString _channelName, QString _platform)
 
 LoggingChannel::~LoggingChannel()
 {
-    appendLine(this->fileHandle, generateClosingString());
-    this->fileHandle.close();
-    this->currentStreamFileHandle.close();
+    if (!this->filePath.isEmpty())
+    {
+        this->writer.close(this->filePath, generateClosingString());
+    }
+    if (!this->streamFilePath.isEmpty())
+    {
+        this->writer.close(this->streamFilePath, {});
+    }
 }
 
 void LoggingChannel::openLogFile()
@@ -111,10 +109,9 @@ void LoggingChannel::openLogFile()
     QDateTime now = QDateTime::currentDateTime();
     this->dateString = generateDateString(now);
 
-    if (this->fileHandle.isOpen())
+    if (!this->filePath.isEmpty())
     {
-        this->fileHandle.flush();
-        this->fileHandle.close();
+        this->writer.close(this->filePath, {});
     }
 
     QString baseFileName = this->channelName + "-" + this->dateString + ".log";
@@ -122,25 +119,10 @@ void LoggingChannel::openLogFile()
     QString directory =
         this->baseDirectory + QDir::separator() + this->subDirectory;
 
-    if (!QDir().mkpath(directory))
-    {
-        qCDebug(chatterinoHelper) << "Unable to create logging path";
-        return;
-    }
-
-    // Open file handle to log file of current date
-    QString fileName = directory + QDir::separator() + baseFileName;
-    qCDebug(chatterinoHelper) << "Logging to" << fileName;
-    this->fileHandle.setFileName(fileName);
-
-    if (!this->fileHandle.open(QIODevice::Append))
-    {
-        qCDebug(chatterinoHelper)
-            << "Failed to open file" << this->fileHandle.errorString();
-        return;
-    }
-
-    appendLine(this->fileHandle, generateOpeningString(now));
+    // Open the log file of current date. The directory is created by the
+    // writer thread.
+    this->filePath = directory + QDir::separator() + baseFileName;
+    this->writer.open(this->filePath, generateOpeningString(now));
 }
 
 void LoggingChannel::openStreamLogFile(const QString &streamID)
@@ -148,10 +130,9 @@ void LoggingChannel::openStreamLogFile(const QString &streamID)
     QDateTime now = QDateTime::currentDateTime();
     this->currentStreamID = streamID;
 
-    if (this->currentStreamFileHandle.isOpen())
+    if (!this->streamFilePath.isEmpty())
     {
-        this->currentStreamFileHandle.flush();
-        this->currentStreamFileHandle.close();
+        this->writer.close(this->streamFilePath, {});
     }
 
     QString baseFileName = this->channelName + "-" + streamID + ".log";
@@ -159,24 +140,8 @@ void LoggingChannel::openStreamLogFile(const QString &streamID)
     QString directory =
         this->baseDirectory + QDir::separator() + this->subDirectory;
 
-    if (!QDir().mkpath(directory))
-    {
-        qCDebug(chatterinoHelper) << "Unable to create logging path";
-        return;
-    }
-
-    QString fileName = directory + QDir::separator() + baseFileName;
-    qCDebug(chatterinoHelper) << "Logging stream to" << fileName;
-    this->currentStreamFileHandle.setFileName(fileName);
-
-    if (!this->currentStreamFileHandle.open(QIODevice::Append))
-    {
-        qCDebug(chatterinoHelper)
-            << "Failed to open file"
-            << this->currentStreamFileHandle.errorString();
-        return;
-    }
-    appendLine(this->currentStreamFileHandle, generateOpeningString(now));
+    this->streamFilePath = directory + QDir::separator() + baseFileName;
+    this->writer.open(this->streamFilePath, generateOpeningString(now));
 }
 
 void LoggingChannel::addMessage(const MessagePtr &message,
@@ -259,7 +224,7 @@ void LoggingChannel::addMessage(const MessagePtr &message,
     str.append(messageText);
     str.append(ENDLINE);
 
-    appendLine(this->fileHandle, str);
+    this->writer.append(this->filePath, str);
 
     if (!streamID.isEmpty() && getSettings()->separatelyStoreStreamLogs)
     {
@@ -268,7 +233,7 @@ void LoggingChannel::addMessage(const MessagePtr &message,
             this->openStreamLogFile(streamID);
         }
 
-        appendLine(this->currentStreamFileHandle, str);
+        this->writer.append(this->streamFilePath, str);
     }
 }
 
@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <QFile>
 #include <QString>
 
 #include <memory>
@@ -12,12 +11,14 @@
 namespace chatterino {
 
 class Logging;
+class LogWriter;
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
 
 class LoggingChannel
 {
-    explicit LoggingChannel(QString _channelName, QString _platform);
+    explicit LoggingChannel(QString _channelName, QString _platform,
+                            LogWriter &writer);
 
 public:
     ~LoggingChannel();
@@ -39,8 +40,12 @@ private:
     QString baseDirectory;
     QString subDirectory;
 
-    QFile fileHandle;
-    QFile currentStreamFileHandle;
+    LogWriter &writer;
+
+    /// Path of the daily log file, empty if none is open
+    QString filePath;
+    /// Path of the current stream's log file, empty if none is open
+    QString streamFilePath;
     QString currentStreamID;
 
     QString dateString;
@@ -34,6 +34,8 @@ constexpr bool isBytes(DebugObject target)
         case DebugObject::BytesImageCurrent:
         case DebugObject::BytesImageLoaded:
         case DebugObject::BytesImageUnloaded:
+        case DebugObject::BytesNetworkCache:
+        case DebugObject::BytesMessageDrawingBuffers:
             return true;
     }
 }
@@ -26,7 +26,18 @@ enum class DebugObject : size_t {
     // http/other networking
     HTTPRequestStarted,
     HTTPRequestSuccess,
+    HTTPCacheHit,
+    HTTPCacheRevalidated,
     NetworkData,
+    BytesNetworkCache,
+
+    // helix
+    HelixRequestsQueued,
+    HelixRequestsInFlight,
+    HelixRequestsCoalesced,
+    HelixRequestsRetried,
+    HelixRatelimitRemaining,
+    HelixRequestWaitMs,
 
     // images
     Image,
@@ -36,6 +47,10 @@ enum class DebugObject : size_t {
     BytesImageLoaded,
     BytesImageUnloaded,
 
+    AnimationRepaints,
+    AnimationRepaintsAvoided,
+    AnimationTicksSkipped,
+
     LastImageGcExpired,
     LastImageGcEligible,
     LastImageGcLeft,
@@ -46,11 +61,21 @@ enum class DebugObject : size_t {
 
     // Messages
     MessageDrawingBuffer,
+    MessageDrawingBuffersReused,
+    MessageDrawingBuffersEvicted,
+    BytesMessageDrawingBuffers,
     MessageElement,
     MessageLayout,
     MessageLayoutElement,
     MessageThread,
     Message,
+    MessageRelayouts,
+    MessageRelayoutsAvoided,
+    ChannelViewRelayoutsAvoided,
+
+    // Chat logs
+    LogRecordsQueued,
+    LogRecordsDropped,
 
     Count,
 };
@@ -109,6 +134,24 @@ constexpr magic_enum::customize::customize_t
             return "http requests started";
         case chatterino::DebugObject::HTTPRequestSuccess:
             return "http requests succeeded";
+        case chatterino::DebugObject::HTTPCacheHit:
+            return "http cache hits";
+        case chatterino::DebugObject::HTTPCacheRevalidated:
+            return "http cache revalidations (304)";
+        case chatterino::DebugObject::BytesNetworkCache:
+            return "http cache bytes";
+        case chatterino::DebugObject::HelixRequestsQueued:
+            return "helix requests queued";
+        case chatterino::DebugObject::HelixRequestsInFlight:
+            return "helix requests in flight";
+        case chatterino::DebugObject::HelixRequestsCoalesced:
+            return "helix requests coalesced";
+        case chatterino::DebugObject::HelixRequestsRetried:
+            return "helix requests retried (429)";
+        case chatterino::DebugObject::HelixRatelimitRemaining:
+            return "helix rate limit points remaining";
+        case chatterino::DebugObject::HelixRequestWaitMs:
+            return "helix average queue time (ms)";
         case chatterino::DebugObject::Image:
             return "images";
         case chatterino::DebugObject::LoadedImage:
@@ -119,6 +162,12 @@ constexpr magic_enum::customize::customize_t
             return "image bytes (ever loaded)";
         case chatterino::DebugObject::BytesImageUnloaded:
             return "image bytes (ever unloaded)";
+        case chatterino::DebugObject::AnimationRepaints:
+            return "animation repaints";
+        case chatterino::DebugObject::AnimationRepaintsAvoided:
+            return "animation repaints avoided";
+        case chatterino::DebugObject::AnimationTicksSkipped:
+            return "animation ticks without frame changes";
         case chatterino::DebugObject::LastImageGcExpired:
             return "last image gc: expired";
         case chatterino::DebugObject::LastImageGcEligible:
@@ -131,5 +180,21 @@ constexpr magic_enum::customize::customize_t
             return "lua::api::HTTPRequest";
         case chatterino::DebugObject::MessageDrawingBuffer:
             return "message drawing buffers";
+        case chatterino::DebugObject::MessageDrawingBuffersReused:
+            return "message drawing buffers reused";
+        case chatterino::DebugObject::MessageDrawingBuffersEvicted:
+            return "message drawing buffers evicted";
+        case chatterino::DebugObject::BytesMessageDrawingBuffers:
+            return "message drawing buffer bytes";
+        case chatterino::DebugObject::MessageRelayouts:
+            return "message relayouts";
+        case chatterino::DebugObject::MessageRelayoutsAvoided:
+            return "message relayouts avoided";
+        case chatterino::DebugObject::ChannelViewRelayoutsAvoided:
+            return "channel view relayouts avoided";
+        case chatterino::DebugObject::LogRecordsQueued:
+            return "chat log records queued";
+        case chatterino::DebugObject::LogRecordsDropped:
+            return "chat log records dropped";
     }
 }
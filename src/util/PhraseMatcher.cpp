@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/PhraseMatcher.hpp"
+
+#include "common/QLogging.hpp"
+
+#include <algorithm>
+#include <deque>
+
+namespace {
+
+using namespace Qt::Literals;
+
+/// Matches regular expressions that can't be wrapped in a group and joined
+/// with others without changing their meaning: numbered and named back
+/// references and subroutine calls, `\Q` (quotes until the end), verbs
+/// like `(*UTF)` that must be at the start, and extended mode where `#`
+/// comments out the rest of the pattern.
+const QRegularExpression &nonCombinableRegex()
+{
+    static const QRegularExpression regex(
+        uR"(\\[1-9gkQ]|\(\?(?:P[=>]|&|R|[0-9]|[+-][0-9])|\(\*|\(\?[a-zA-Z^-]*x)"_s);
+    return regex;
+}
+
+QRegularExpression::PatternOptions regexOptions(bool isCaseSensitive)
+{
+    return QRegularExpression::UseUnicodePropertiesOption |
+           (isCaseSensitive ? QRegularExpression::NoPatternOption
+                            : QRegularExpression::CaseInsensitiveOption);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+PhraseMatcher::PhraseMatcher(const std::vector<Phrase> &phrases)
+{
+    QString alternation;
+    for (size_t i = 0; i < phrases.size(); i++)
+    {
+        const auto &phrase = phrases[i];
+        if (phrase.pattern.isEmpty())
+        {
+            continue;
+        }
+
+        if (!phrase.isRegex)
+        {
+            if (phrase.isCaseSensitive)
+            {
+                this->caseSensitive_.add(phrase.pattern, i);
+            }
+            else
+            {
+                this->caseInsensitive_.add(phrase.pattern.toCaseFolded(), i);
+            }
+            continue;
+        }
+
+        QRegularExpression regex(phrase.pattern,
+                                 regexOptions(phrase.isCaseSensitive));
+        if (!regex.isValid())
+        {
+            continue;
+        }
+
+        if (nonCombinableRegex().match(phrase.pattern).hasMatch())
+        {
+            this->separateRegexes_.push_back(i);
+            continue;
+        }
+
+        if (!alternation.isEmpty())
+        {
+            alternation += u'|';
+        }
+        alternation += phrase.isCaseSensitive ? u"(?:"_s : u"(?i:"_s;
+        alternation += phrase.pattern;
+        alternation += u')';
+        this->combinedRegexes_.push_back(i);
+    }
+
+    this->caseSensitive_.build();
+    this->caseInsensitive_.build();
+
+    if (this->combinedRegexes_.empty())
+    {
+        return;
+    }
+
+    this->combined_ = QRegularExpression(alternation, regexOptions(true));
+    if (!this->combined_.isValid())
+    {
+        // e.g. two expressions use the same group name
+        qCDebug(chatterinoHighlights)
+            << "Failed to combine regular expressions:"
+            << this->combined_.errorString();
+        this->separateRegexes_.insert(this->separateRegexes_.end(),
+                                      this->combinedRegexes_.begin(),
+                                      this->combinedRegexes_.end());
+        this->combinedRegexes_.clear();
+        this->combined_ = {};
+        return;
+    }
+    this->combined_.optimize();
+}
+
+std::vector<size_t> PhraseMatcher::candidates(QStringView text) const
+{
+    std::vector<size_t> out = this->separateRegexes_;
+
+    this->caseSensitive_.find(text, out, false);
+    if (!this->caseInsensitive_.empty())
+    {
+        this->caseInsensitive_.find(text.toString().toCaseFolded(), out,
+                                    false);
+    }
+
+    if (!this->combinedRegexes_.empty() &&
+        this->combined_.matchView(text).hasMatch())
+    {
+        out.insert(out.end(), this->combinedRegexes_.begin(),
+                   this->combinedRegexes_.end());
+    }
+
+    std::ranges::sort(out);
+    auto [first, last] = std::ranges::unique(out);
+    out.erase(first, last);
+    return out;
+}
+
+bool PhraseMatcher::anyCandidate(QStringView text) const
+{
+    if (!this->separateRegexes_.empty())
+    {
+        return true;
+    }
+
+    std::vector<size_t> out;
+    this->caseSensitive_.find(text, out, true);
+    if (out.empty() && !this->caseInsensitive_.empty())
+    {
+        this->caseInsensitive_.find(text.toString().toCaseFolded(), out,
+                                    true);
+    }
+    if (!out.empty())
+    {
+        return true;
+    }
+
+    return !this->combinedRegexes_.empty() &&
+           this->combined_.matchView(text).hasMatch();
+}
+
+bool PhraseMatcher::empty() const
+{
+    return this->caseSensitive_.empty() && this->caseInsensitive_.empty() &&
+           this->combinedRegexes_.empty() && this->separateRegexes_.empty();
+}
+
+void PhraseMatcher::Automaton::add(QStringView pattern, size_t phrase)
+{
+    uint32_t node = 0;
+    for (QChar ch : pattern)
+    {
+        auto c = ch.unicode();
+        auto &edges = this->nodes_[node].edges;
+        auto it = std::ranges::find(edges, c, &Edge::c);
+        if (it != edges.end())
+        {
+            node = it->target;
+            continue;
+        }
+
+        auto target = static_cast<uint32_t>(this->nodes_.size());
+        edges.push_back({.c = c, .target = target});
+        // `edges` is invalidated here
+        this->nodes_.emplace_back();
+        node = target;
+    }
+    this->nodes_[node].phrases.push_back(phrase);
+}
+
+void PhraseMatcher::Automaton::build()
+{
+    for (auto &node : this->nodes_)
+    {
+        std::ranges::sort(node.edges, {}, &Edge::c);
+    }
+
+    // Nodes are visited in breadth-first order, so the fail link of a node
+    // always points to a node that was already visited.
+    std::deque<uint32_t> queue;
+    for (const auto &edge : this->nodes_[0].edges)
+    {
+        queue.push_back(edge.target);
+    }
+
+    while (!queue.empty())
+    {
+        auto current = queue.front();
+        queue.pop_front();
+
+        for (const auto &edge : this->nodes_[current].edges)
+        {
+            auto &child = this->nodes_[edge.target];
+            child.fail = this->next(this->nodes_[current].fail, edge.c);
+
+            const auto &fail = this->nodes_[child.fail];
+            child.output = fail.phrases.empty() ? fail.output : child.fail;
+
+            queue.push_back(edge.target);
+        }
+    }
+}
+
+bool PhraseMatcher::Automaton::empty() const
+{
+    return this->nodes_.size() <= 1;
+}
+
+void PhraseMatcher::Automaton::find(QStringView text,
+                                    std::vector<size_t> &out,
+                                    bool firstOnly) const
+{
+    if (this->empty())
+    {
+        return;
+    }
+
+    uint32_t state = 0;
+    for (QChar c : text)
+    {
+        state = this->next(state, c.unicode());
+        for (auto node = state; node != 0; node = this->nodes_[node].output)
+        {
+            const auto &phrases = this->nodes_[node].phrases;
+            out.insert(out.end(), phrases.begin(), phrases.end());
+            if (firstOnly && !out.empty())
+            {
+                return;
+            }
+        }
+    }
+}
+
+uint32_t PhraseMatcher::Automaton::next(uint32_t node, char16_t c) const
+{
+    while (true)
+    {
+        const auto &edges = this->nodes_[node].edges;
+        auto it = std::ranges::lower_bound(edges, c, {}, &Edge::c);
+        if (it != edges.end() && it->c == c)
+        {
+            return it->target;
+        }
+        if (node == 0)
+        {
+            return 0;
+        }
+        node = this->nodes_[node].fail;
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QRegularExpression>
+#include <QString>
+#include <QStringView>
+
+#include <cstdint>
+#include <vector>
+
+namespace chatterino {
+
+/// Finds which phrases out of a (possibly long) list could match a text
+/// without running each phrase's regular expression.
+///
+/// Plain phrases are searched for at once with an Aho-Corasick automaton.
+/// Case-insensitive phrases are searched for in the case-folded text.
+/// Regular expressions are combined into one alternation, so a text that
+/// matches none of them is rejected with a single match.
+///
+/// The result is a superset of the matching phrases: a plain phrase that
+/// must be surrounded by word boundaries is reported as soon as it appears
+/// in the text, and if the alternation matches, all regular expressions in
+/// it are reported. Callers check the candidates with the phrase's own
+/// matcher, so the order and the result of the checks don't change.
+class PhraseMatcher
+{
+public:
+    struct Phrase {
+        QString pattern;
+        bool isRegex = false;
+        bool isCaseSensitive = false;
+    };
+
+    PhraseMatcher() = default;
+    explicit PhraseMatcher(const std::vector<Phrase> &phrases);
+
+    /// Returns the indices of the phrases that could match `text` in
+    /// ascending order. Empty phrases and invalid regular expressions are
+    /// never returned.
+    std::vector<size_t> candidates(QStringView text) const;
+
+    /// Returns true if any phrase could match `text`
+    bool anyCandidate(QStringView text) const;
+
+    bool empty() const;
+
+private:
+    /// Aho-Corasick automaton over UTF-16 code units
+    class Automaton
+    {
+    public:
+        void add(QStringView pattern, size_t phrase);
+        void build();
+
+        bool empty() const;
+
+        /// Appends the phrases found in `text` to `out` (possibly
+        /// duplicated). Stops at the first phrase if `firstOnly` is set.
+        void find(QStringView text, std::vector<size_t> &out,
+                  bool firstOnly) const;
+
+    private:
+        struct Edge {
+            char16_t c;
+            uint32_t target;
+        };
+
+        struct Node {
+            /// Edges to the children, sorted by `c` after build()
+            std::vector<Edge> edges;
+            uint32_t fail = 0;
+            /// Closest node along the fail links that ends a phrase
+            uint32_t output = 0;
+            /// Phrases ending at this node
+            std::vector<size_t> phrases;
+        };
+
+        uint32_t next(uint32_t node, char16_t c) const;
+
+        std::vector<Node> nodes_{Node{}};
+    };
+
+    Automaton caseSensitive_;
+    Automaton caseInsensitive_;
+
+    /// Alternation of the regular expressions in `combinedRegexes_`
+    QRegularExpression combined_;
+    std::vector<size_t> combinedRegexes_;
+
+    /// Regular expressions that can't be part of the alternation
+    /// (e.g. because they use back references). These are always returned.
+    std::vector<size_t> separateRegexes_;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/TaskGraph.hpp"
+
+#include "debug/StartupTrace.hpp"
+
+#include <QtConcurrent>
+
+#include <cassert>
+
+namespace chatterino {
+
+TaskGraph::TaskID TaskGraph::add(QString name, Executor executor,
+                                 std::function<void()> fn,
+                                 std::vector<TaskID> dependencies)
+{
+    assert(!this->running_ && "Tasks must be added before run()");
+
+    auto id = this->tasks_.size();
+    for (auto dependency : dependencies)
+    {
+        assert(dependency < id && "Dependencies must be added first");
+        this->tasks_[dependency].dependents.push_back(id);
+    }
+
+    this->tasks_.push_back({
+        .name = std::move(name),
+        .executor = executor,
+        .fn = std::move(fn),
+        .dependents = {},
+        .pending = dependencies.size(),
+    });
+    if (executor == Executor::Caller)
+    {
+        this->callerTasks_.push_back(id);
+    }
+    return id;
+}
+
+void TaskGraph::run()
+{
+    std::unique_lock lock(this->mutex_);
+    assert(!this->running_);
+    this->running_ = true;
+
+    for (TaskID id = 0; id < this->tasks_.size(); id++)
+    {
+        const auto &task = this->tasks_[id];
+        if (task.executor == Executor::Pool && task.pending == 0)
+        {
+            this->startOnPool(id);
+        }
+    }
+
+    auto nextCaller = this->callerTasks_.begin();
+    while (true)
+    {
+        this->condition_.wait(lock, [&] {
+            return this->finished_ == this->tasks_.size() ||
+                   (nextCaller != this->callerTasks_.end() &&
+                    this->tasks_[*nextCaller].pending == 0);
+        });
+        if (this->finished_ == this->tasks_.size())
+        {
+            break;
+        }
+
+        auto id = *nextCaller++;
+        lock.unlock();
+        this->execute(id);
+        lock.lock();
+        this->finish(id);
+    }
+
+    if (this->error_)
+    {
+        std::rethrow_exception(this->error_);
+    }
+}
+
+void TaskGraph::execute(TaskID id)
+{
+    // no other thread touches the task while it's running
+    auto &task = this->tasks_[id];
+    StartupSpan span(task.name);
+    try
+    {
+        task.fn();
+    }
+    catch (...)
+    {
+        std::lock_guard lock(this->mutex_);
+        if (!this->error_)
+        {
+            this->error_ = std::current_exception();
+        }
+    }
+}
+
+void TaskGraph::startOnPool(TaskID id)
+{
+    std::ignore = QtConcurrent::run([this, id] {
+        this->execute(id);
+
+        std::lock_guard lock(this->mutex_);
+        this->finish(id);
+    });
+}
+
+void TaskGraph::finish(TaskID id)
+{
+    this->finished_++;
+    for (auto dependent : this->tasks_[id].dependents)
+    {
+        auto &task = this->tasks_[dependent];
+        assert(task.pending > 0);
+        task.pending--;
+        if (task.pending == 0 && task.executor == Executor::Pool)
+        {
+            this->startOnPool(dependent);
+        }
+    }
+    // run() waits for tasks on the caller and for the end of the graph
+    this->condition_.notify_all();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+/// @brief Runs tasks that depend on each other, concurrently where possible.
+///
+/// Used to initialize Chatterino: steps that need the GUI thread run on the
+/// caller, while independent steps (e.g. parsing data) run on Qt's global
+/// thread pool in the meantime. Every task is measured in a StartupSpan.
+///
+/// A task can only depend on tasks that were added before it, so there can't
+/// be cycles.
+class TaskGraph
+{
+public:
+    using TaskID = size_t;
+
+    enum class Executor : uint8_t {
+        /// The thread that calls run(). These tasks run in the order they
+        /// were added.
+        Caller,
+        /// Qt's global thread pool
+        Pool,
+    };
+
+    TaskGraph() = default;
+    ~TaskGraph() = default;
+
+    TaskGraph(const TaskGraph &) = delete;
+    TaskGraph &operator=(const TaskGraph &) = delete;
+    TaskGraph(TaskGraph &&) = delete;
+    TaskGraph &operator=(TaskGraph &&) = delete;
+
+    /// Adds a task that runs once all of its `dependencies` finished
+    TaskID add(QString name, Executor executor, std::function<void()> fn,
+               std::vector<TaskID> dependencies = {});
+
+    /// Runs all tasks and returns once they finished.
+    ///
+    /// If a task throws, its dependents still run and the first exception is
+    /// rethrown once all tasks finished.
+    void run();
+
+private:
+    struct Task {
+        QString name;
+        Executor executor;
+        std::function<void()> fn;
+        std::vector<TaskID> dependents;
+        /// Dependencies that didn't finish yet
+        size_t pending = 0;
+    };
+
+    void execute(TaskID id);
+    /// Must be called with mutex_ held
+    void startOnPool(TaskID id);
+    /// Must be called with mutex_ held
+    void finish(TaskID id);
+
+    std::vector<Task> tasks_;
+    /// Tasks on the caller in the order they were added
+    std::vector<TaskID> callerTasks_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    size_t finished_ = 0;
+    std::exception_ptr error_;
+    bool running_ = false;
+};
+
+}  // namespace chatterino
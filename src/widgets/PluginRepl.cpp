@@ -473,7 +473,8 @@ PluginRepl::PluginRepl(QString id, QWidget *parent)
     QObject::connect(input, &HistoricTextEdit::onSend, this,
                      &PluginRepl::tryRun);
     splitter->addWidget(this->ui.input);
-    this->ui.input->setPlaceholderText(u"Type something..."_s);
+    this->ui.input->setPlaceholderText(
+        u"Type something... (:profile shows timings)"_s);
     this->ui.input->setAcceptRichText(false);
     this->ui.input->setFocus();
 
@@ -532,6 +533,24 @@ void PluginRepl::tryRun(QString code)
 
     this->log({}, u"> "_s + code);
 
+    auto trimmed = QStringView(code).trimmed();
+    if (trimmed == u":profile")
+    {
+        auto text = this->plugin->profile.format().trimmed();
+        if (text.isEmpty())
+        {
+            text = u"No calls were recorded yet."_s;
+        }
+        this->log(lua::api::LogLevel::Info, text);
+        return;
+    }
+    if (trimmed == u":profile reset")
+    {
+        this->plugin->profile.reset();
+        this->log({}, u"Cleared the profile."_s);
+        return;
+    }
+
     bool addedReturn = false;
     size_t maxItems = 10;
 
@@ -101,23 +101,35 @@ TooltipWidget::TooltipWidget(BaseWidget *parent)
                 return;
             }
 
-            bool needSizeAdjustment = false;
-            for (int i = 0; i < this->visibleEntries_; ++i)
-            {
-                auto *entry = this->entryAt(i);
-                if (entry->hasImage() && entry->attemptRefresh())
-                {
-                    bool successfullyUpdated = entry->refreshPixmap();
-                    needSizeAdjustment |= successfullyUpdated;
-                }
-            }
-
-            if (needSizeAdjustment)
-            {
-                this->adjustSize();
-                this->applyLastBoundsCheck();
-            }
+            this->refreshImages();
         });
+
+    this->connections_.managedConnect(windows->imagesLoaded, [this] {
+        if (this->isVisible())
+        {
+            this->refreshImages();
+        }
+    });
+}
+
+void TooltipWidget::refreshImages()
+{
+    bool needSizeAdjustment = false;
+    for (int i = 0; i < this->visibleEntries_; ++i)
+    {
+        auto *entry = this->entryAt(i);
+        if (entry->hasImage() && entry->attemptRefresh())
+        {
+            bool successfullyUpdated = entry->refreshPixmap();
+            needSizeAdjustment |= successfullyUpdated;
+        }
+    }
+
+    if (needSizeAdjustment)
+    {
+        this->adjustSize();
+        this->applyLastBoundsCheck();
+    }
 }
 
 void TooltipWidget::setOne(const TooltipEntry &entry, TooltipStyle style)
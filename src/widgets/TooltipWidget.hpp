@@ -58,6 +58,8 @@ protected:
 
 private:
     void updateFont();
+    /// Refreshes the pixmaps of entries whose image finished loading
+    void refreshImages();
 
     QLayout *currentLayout() const;
     int currentLayoutCount() const;
@@ -113,7 +113,7 @@ bool checkMessageUserName(const QString &userName, MessagePtr message)
 
 ChannelPtr filterMessages(const QString &userName, ChannelPtr channel)
 {
-    std::vector<MessagePtr> snapshot = channel->getMessageSnapshot();
+    std::vector<MessagePtr> snapshot = channel->findMessagesByUser(userName);
 
     ChannelPtr channelPtr;
     if (channel->isTwitchChannel())
@@ -1026,7 +1026,7 @@ void UserInfoPopup::updateUserData()
             []() {});
 
         // get ignore state
-        bool isIgnoring = currentUser->blockedUserIds().contains(user.id);
+        bool isIgnoring = currentUser->blockedUserIds()->contains(user.id);
 
         // get ignoreHighlights state
         bool isIgnoringHighlights = false;
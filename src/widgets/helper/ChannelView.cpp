@@ -12,6 +12,7 @@
 #include "controllers/commands/CommandController.hpp"
 #include "controllers/filters/FilterSet.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/StartupTrace.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/layouts/MessageLayout.hpp"
@@ -33,6 +34,7 @@
 #include "singletons/Theme.hpp"
 #include "singletons/WindowManager.hpp"
 #include "util/Clipboard.hpp"
+#include "util/DebugCount.hpp"
 #include "util/DistanceBetweenPoints.hpp"
 #include "util/Helpers.hpp"
 #include "util/IncognitoBrowser.hpp"
@@ -83,6 +85,9 @@ using namespace chatterino;
 
 constexpr int SCROLLBAR_PADDING = 8;
 
+/// Minimum number of layouts created when a dormant view wakes up
+constexpr size_t MIN_WAKE_LAYOUTS = 100;
+
 void addEmoteContextMenuItems(QMenu *menu, const Emote &emote, QStringView kind)
 {
     auto *openAction = menu->addAction("&Open");
@@ -348,6 +353,11 @@ ChannelView::ChannelView(InternalCtor /*tag*/, QWidget *parent, Split *split,
     this->clickTimer_.setSingleShot(true);
     this->clickTimer_.setInterval(500);
 
+    this->dormancyTimer_.setSingleShot(true);
+    QObject::connect(&this->dormancyTimer_, &QTimer::timeout, this, [this] {
+        this->goDormant();
+    });
+
     this->scrollTimer_.setInterval(20);
     QObject::connect(&this->scrollTimer_, &QTimer::timeout, this, [this] {
         this->scrollUpdateRequested();
@@ -426,10 +436,21 @@ void ChannelView::initializeSignals()
 
     this->signalHolder_.managedConnect(
         getApp()->getWindows()->gifRepaintRequested, [&] {
-            if (!this->animationArea_.isEmpty())
+            if (this->animations_.empty())
+            {
+                return;
+            }
+
+            auto dirty = this->animations_.dirtyRegion();
+            if (dirty.isEmpty())
             {
-                this->queueUpdate(this->animationArea_);
+                // none of the visible animations advanced this tick
+                DebugCount::increase(DebugObject::AnimationRepaintsAvoided);
+                return;
             }
+
+            DebugCount::increase(DebugObject::AnimationRepaints);
+            this->update(dirty);
         });
 
     this->signalHolder_.managedConnect(
@@ -442,6 +463,20 @@ void ChannelView::initializeSignals()
             }
         });
 
+    this->signalHolder_.managedConnect(
+        getApp()->getWindows()->messagesChanged,
+        [this](Channel *channel, const std::vector<MessagePtr> &messages) {
+            this->messagesChanged(channel, messages);
+        });
+
+    this->signalHolder_.managedConnect(
+        getApp()->getWindows()->imagesLoaded, [this] {
+            if (this->isVisible())
+            {
+                this->queueLayout();
+            }
+        });
+
     this->signalHolder_.managedConnect(
         getApp()->getWindows()->invalidateBuffersRequested,
         [this](Channel *channel) {
@@ -678,6 +713,12 @@ void ChannelView::queueLayout()
 
 void ChannelView::showEvent(QShowEvent * /*event*/)
 {
+    this->dormancyTimer_.stop();
+    if (this->dormant_)
+    {
+        this->wake();
+    }
+
     if (this->layoutQueued_)
     {
         this->performLayout(false, true);
@@ -706,6 +747,16 @@ void ChannelView::performLayout(bool causedByScrollbar, bool causedByShow)
     this->goToBottom_->setVisible(this->enableScrollingToBottom_ &&
                                   this->scrollBar_->isVisible() &&
                                   !this->scrollBar_->isAtBottom());
+
+    // Less than a page is left above the view (the scrollbar is only hidden
+    // if all layouts fit into the view)
+    if (this->olderLayoutsPending_ &&
+        (this->scrollBar_->isHidden() ||
+         this->scrollBar_->getRelativeCurrentValue() <
+             this->scrollBar_->getPageSize()))
+    {
+        this->loadOlderLayouts();
+    }
 }
 
 void ChannelView::layoutVisibleMessages(
@@ -815,6 +866,9 @@ void ChannelView::clearMessages()
 {
     // Clear all stored messages in this chat widget
     this->messages_.clear();
+    this->dormantPendingMessages_ = 0;
+    this->dormantScrollFromBottom_.reset();
+    this->olderLayoutsPending_ = false;
     this->scrollBar_->clearHighlights();
     this->scrollBar_->resetBounds();
     this->scrollBar_->setMaximum(0);
@@ -915,9 +969,23 @@ const std::optional<MessageElementFlags> &ChannelView::getOverrideFlags() const
 std::vector<MessageLayoutPtr> &ChannelView::getMessagesSnapshot()
 {
     this->snapshotGuard_.guard();
+    if (this->dormant_)
+    {
+        // e.g. when scrolling to a message in a hidden split
+        this->wake();
+    }
+
     if (!this->paused() /*|| this->scrollBar_->isVisible()*/)
     {
-        this->snapshot_ = this->messages_.getSnapshot();
+        // This is called for every paint, layout and most mouse events.
+        // Copying all layouts is expensive with large scrollback limits, so
+        // the snapshot is only taken again if the messages changed.
+        auto generation = this->messages_.generation();
+        if (this->snapshotGeneration_ != generation)
+        {
+            this->snapshot_ = this->messages_.getSnapshot();
+            this->snapshotGeneration_ = generation;
+        }
     }
 
     return this->snapshot_;
@@ -945,6 +1013,9 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
     /// Clear connections from the last channel
     this->channelConnections_.clear();
 
+    // all layouts are created below
+    this->dormant_ = false;
+
     this->clearMessages();
     this->scrollBar_->clearHighlights();
 
@@ -1005,7 +1076,8 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
         });
 
     this->channelConnections_.managedConnect(
-        underlyingChannel->filledInMessages, [this](const auto &messages) {
+        underlyingChannel->filledInMessages,
+        [this](const auto &messages, const auto & /*indices*/) {
             std::vector<MessagePtr> filtered;
             filtered.reserve(messages.size());
             std::copy_if(messages.begin(), messages.end(),
@@ -1087,10 +1159,11 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
         });
 
     // on messages filled in
-    this->channelConnections_.managedConnect(this->channel_->filledInMessages,
-                                             [this](const auto &) {
-                                                 this->messagesUpdated();
-                                             });
+    this->channelConnections_.managedConnect(
+        this->channel_->filledInMessages,
+        [this](const auto &messages, const auto &indices) {
+            this->messagesFilledIn(messages, indices);
+        });
 
     this->underlyingChannel_ = underlyingChannel;
 
@@ -1190,6 +1263,14 @@ void ChannelView::messageAppended(MessagePtr &message,
         messageFlags = &*overridingFlags;
     }
 
+    if (this->dormant_)
+    {
+        // the layout is created once the view is shown again
+        this->dormantPendingMessages_++;
+        this->requestTabHighlight(*messageFlags);
+        return;
+    }
+
     auto messageRef = std::make_shared<MessageLayout>(message);
 
     if (this->lastMessageHasAlternateBackground_)
@@ -1231,23 +1312,7 @@ void ChannelView::messageAppended(MessagePtr &message,
         }
     }
 
-    if (!messageFlags->has(MessageFlag::DoNotTriggerNotification))
-    {
-        if ((messageFlags->has(MessageFlag::Highlighted) &&
-             messageFlags->has(MessageFlag::ShowInMentions) &&
-             !messageFlags->has(MessageFlag::Subscription) &&
-             (getSettings()->highlightMentions ||
-              this->channel_->getType() != Channel::Type::TwitchMentions)) ||
-            (this->channel_->getType() == Channel::Type::TwitchAutomod &&
-             getSettings()->enableAutomodHighlight))
-        {
-            this->tabHighlightRequested.invoke(HighlightState::Highlighted);
-        }
-        else
-        {
-            this->tabHighlightRequested.invoke(HighlightState::NewMessage);
-        }
-    }
+    this->requestTabHighlight(*messageFlags);
 
     if (this->showScrollbarHighlights())
     {
@@ -1257,8 +1322,37 @@ void ChannelView::messageAppended(MessagePtr &message,
     this->queueLayout();
 }
 
+void ChannelView::requestTabHighlight(const MessageFlags &messageFlags)
+{
+    if (messageFlags.has(MessageFlag::DoNotTriggerNotification))
+    {
+        return;
+    }
+
+    if ((messageFlags.has(MessageFlag::Highlighted) &&
+         messageFlags.has(MessageFlag::ShowInMentions) &&
+         !messageFlags.has(MessageFlag::Subscription) &&
+         (getSettings()->highlightMentions ||
+          this->channel_->getType() != Channel::Type::TwitchMentions)) ||
+        (this->channel_->getType() == Channel::Type::TwitchAutomod &&
+         getSettings()->enableAutomodHighlight))
+    {
+        this->tabHighlightRequested.invoke(HighlightState::Highlighted);
+    }
+    else
+    {
+        this->tabHighlightRequested.invoke(HighlightState::NewMessage);
+    }
+}
+
 void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
 {
+    // The messages get their layouts together with the older ones
+    if (this->dormant_ || this->olderLayoutsPending_)
+    {
+        return;
+    }
+
     std::vector<MessageLayoutPtr> messageRefs;
     messageRefs.resize(messages.size());
 
@@ -1279,8 +1373,13 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
         messageRefs.at(i) = std::move(layout);
     }
 
-    /// Add the messages at the start
-    auto addedMessages = this->messages_.pushFront(messageRefs);
+    this->addLayoutsAtStart(messageRefs);
+}
+
+void ChannelView::addLayoutsAtStart(
+    const std::vector<MessageLayoutPtr> &layouts)
+{
+    auto addedMessages = this->messages_.pushFront(layouts);
     if (!addedMessages.empty())
     {
         if (this->scrollBar_->isAtBottom())
@@ -1297,10 +1396,10 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
     if (this->showScrollbarHighlights())
     {
         std::vector<ScrollbarHighlight> highlights;
-        highlights.reserve(messages.size());
-        for (const auto &message : messages)
+        highlights.reserve(layouts.size());
+        for (const auto &layout : layouts)
         {
-            highlights.push_back(message->getScrollBarHighlight());
+            highlights.push_back(layout->getMessage()->getScrollBarHighlight());
         }
 
         this->scrollBar_->addHighlightsAtStart(highlights);
@@ -1312,6 +1411,11 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
 void ChannelView::messageReplaced(size_t hint, const MessagePtr &prev,
                                   const MessagePtr &replacement)
 {
+    if (this->dormant_)
+    {
+        return;
+    }
+
     auto optItem = this->messages_.find(hint, [&](const auto &it) {
         return it->getMessagePtr() == prev;
     });
@@ -1339,37 +1443,158 @@ void ChannelView::messagesUpdated()
 {
     auto snapshot = this->channel_->getMessageSnapshot();
 
-    this->messages_.clear();
-    this->scrollBar_->clearHighlights();
-    this->scrollBar_->resetBounds();
-    this->scrollBar_->setMaximum(qreal(snapshot.size()));
-    this->scrollBar_->setMinimum(0);
-    this->lastMessageHasAlternateBackground_ = false;
-    this->lastMessageHasAlternateBackgroundReverse_ = true;
+    // Most messages are usually still present. Their layouts are reused, so
+    // they don't have to be laid out again.
+    std::unordered_map<const Message *, MessageLayoutPtr> previousLayouts;
+    for (auto &layout : this->messages_.getSnapshot())
+    {
+        previousLayouts.emplace(layout->getMessage(), std::move(layout));
+    }
+    if (this->lastReadMessage_)
+    {
+        // keeps the last read line after the view was dormant
+        previousLayouts.emplace(this->lastReadMessage_->getMessage(),
+                                this->lastReadMessage_);
+    }
 
+    std::vector<MessageLayoutPtr> layouts;
+    layouts.reserve(snapshot.size());
     for (const auto &msg : snapshot)
     {
-        auto messageLayout = std::make_shared<MessageLayout>(msg);
+        auto it = previousLayouts.find(msg.get());
+        if (it != previousLayouts.end())
+        {
+            layouts.emplace_back(std::move(it->second));
+            previousLayouts.erase(it);
+        }
+        else
+        {
+            layouts.emplace_back(std::make_shared<MessageLayout>(msg));
+        }
+    }
 
-        if (this->lastMessageHasAlternateBackground_)
+    this->olderLayoutsPending_ = false;
+    this->replaceMessageLayouts(std::move(layouts));
+}
+
+void ChannelView::messagesFilledIn(const std::vector<MessagePtr> &messages,
+                                   const std::vector<size_t> &indices)
+{
+    if (this->dormant_)
+    {
+        return;
+    }
+
+    if (this->olderLayoutsPending_)
+    {
+        // The filled in messages might be spread over the messages without
+        // layouts
+        this->messagesUpdated();
+        return;
+    }
+
+    auto snapshot = this->channel_->getMessageSnapshot();
+    auto previous = this->messages_.getSnapshot();
+
+    // The layouts mirror the messages of the channel, so the filled in
+    // messages are spliced in at their indices. If the channel overflowed,
+    // messages were removed from its start.
+    auto kept = snapshot.size() - std::min(indices.size(), snapshot.size());
+    if (kept > previous.size())
+    {
+        this->messagesUpdated();
+        return;
+    }
+    auto removedFromStart = previous.size() - kept;
+    auto topIndex = static_cast<size_t>(
+        std::max(this->scrollBar_->getRelativeCurrentValue(), qreal(0)));
+    qreal scrollOffset = 0;
+
+    std::vector<MessageLayoutPtr> layouts;
+    layouts.reserve(snapshot.size());
+    size_t nextFilledIn = 0;
+    size_t nextPrevious = removedFromStart;
+    for (size_t i = 0; i < snapshot.size(); i++)
+    {
+        if (nextFilledIn < indices.size() && indices[nextFilledIn] == i)
         {
-            messageLayout->flags.set(MessageLayoutFlag::AlternateBackground);
+            layouts.emplace_back(
+                std::make_shared<MessageLayout>(messages[nextFilledIn]));
+            nextFilledIn++;
+        }
+        else
+        {
+            if (nextPrevious == topIndex)
+            {
+                // keep the messages in view where they are
+                scrollOffset = qreal(i) - qreal(topIndex);
+            }
+            layouts.emplace_back(std::move(previous[nextPrevious]));
+            nextPrevious++;
         }
-        this->lastMessageHasAlternateBackground_ =
-            !this->lastMessageHasAlternateBackground_;
 
-        if (this->channel_->shouldIgnoreHighlights())
+        if (layouts.back()->getMessage() != snapshot[i].get())
         {
-            messageLayout->flags.set(MessageLayoutFlag::IgnoreHighlights);
+            // The view is out of sync with its channel
+            this->messagesUpdated();
+            return;
         }
+    }
 
-        this->messages_.pushBack(messageLayout);
-        if (this->showScrollbarHighlights())
+    bool atBottom = this->scrollBar_->isAtBottom();
+    this->replaceMessageLayouts(std::move(layouts));
+    if (!atBottom && scrollOffset != 0)
+    {
+        this->scrollBar_->offset(scrollOffset);
+    }
+}
+
+void ChannelView::replaceMessageLayouts(std::vector<MessageLayoutPtr> layouts)
+{
+    std::vector<ScrollbarHighlight> highlights;
+    bool showHighlights = this->showScrollbarHighlights();
+    if (showHighlights)
+    {
+        highlights.reserve(layouts.size());
+    }
+    bool ignoreHighlights = this->channel_->shouldIgnoreHighlights();
+
+    this->lastMessageHasAlternateBackground_ = false;
+    this->lastMessageHasAlternateBackgroundReverse_ = true;
+
+    for (const auto &messageLayout : layouts)
+    {
+        if (messageLayout->flags.has(MessageLayoutFlag::AlternateBackground) !=
+            this->lastMessageHasAlternateBackground_)
         {
-            this->scrollBar_->addHighlight(msg->getScrollBarHighlight());
+            messageLayout->flags.set(MessageLayoutFlag::AlternateBackground,
+                                     this->lastMessageHasAlternateBackground_);
+            messageLayout->invalidateBuffer();
+        }
+        this->lastMessageHasAlternateBackground_ =
+            !this->lastMessageHasAlternateBackground_;
+
+        messageLayout->flags.set(MessageLayoutFlag::IgnoreHighlights,
+                                 ignoreHighlights);
+
+        if (showHighlights)
+        {
+            highlights.emplace_back(
+                messageLayout->getMessage()->getScrollBarHighlight());
         }
     }
 
+    auto nLayouts = layouts.size();
+    this->messages_.clear();
+    // The queue is empty, so this keeps the newest messages that fit
+    this->messages_.pushFront(layouts);
+
+    this->scrollBar_->clearHighlights();
+    this->scrollBar_->addHighlightsAtStart(highlights);
+    this->scrollBar_->resetBounds();
+    this->scrollBar_->setMaximum(qreal(nLayouts));
+    this->scrollBar_->setMinimum(0);
+
     this->queueLayout();
 }
 
@@ -1481,6 +1706,7 @@ bool ChannelView::scrollToMessage(const MessagePtr &message)
         return false;
     }
 
+    this->loadOlderLayouts();
     auto &messagesSnapshot = this->getMessagesSnapshot();
     if (messagesSnapshot.size() == 0)
     {
@@ -1517,6 +1743,7 @@ bool ChannelView::scrollToMessage(const MessagePtr &message)
 
 bool ChannelView::scrollToMessageId(const QString &messageId)
 {
+    this->loadOlderLayouts();
     auto &messagesSnapshot = this->getMessagesSnapshot();
     if (messagesSnapshot.size() == 0)
     {
@@ -1571,6 +1798,11 @@ void ChannelView::paintEvent(QPaintEvent *event)
 
     // draw messages
     this->drawMessages(painter, event->rect());
+    StartupTrace::milestone(StartupTrace::Milestone::FirstChatPainted);
+    if (!this->getMessagesSnapshot().empty())
+    {
+        StartupTrace::milestone(StartupTrace::Milestone::FirstMessagesPainted);
+    }
 
     // draw paused sign
     if (this->paused())
@@ -1645,8 +1877,16 @@ void ChannelView::drawMessages(QPainter &painter, const QRect &area)
     };
     bool showLastMessageIndicator = getSettings()->showLastMessageIndicator;
 
-    // using QRect here, because we can only request updates with a rect
-    QRect animationArea;
+    // Only track animations on a full repaint as some messages with animated
+    // elements might get left out in partial repaints.
+    // This happens for example when hovering over the go-to-bottom button.
+    bool isFullRepaint = this->height() <= area.height();
+    if (isFullRepaint)
+    {
+        this->animations_.reset();
+        ctx.animations = &this->animations_;
+    }
+
     auto areaContainsY = [&area](auto y) {
         return y >= area.y() && y < area.y() + area.height();
     };
@@ -1668,25 +1908,7 @@ void ChannelView::drawMessages(QPainter &painter, const QRect &area)
             areaContainsY(ctx.y + layout->getHeight()) ||
             (ctx.y < area.y() && layout->getHeight() > area.height()))
         {
-            auto paintResult = layout->paint(ctx);
-            if (paintResult.hasAnimatedElements)
-            {
-                if (animationArea.isNull())
-                {
-                    animationArea = QRect{
-                        0,
-                        ctx.y,
-                        layout->getWidth(),
-                        layout->getHeight(),
-                    };
-                }
-                else
-                {
-                    animationArea.setBottom((ctx.y + layout->getHeight()));
-                    animationArea.setWidth(
-                        std::max(layout->getWidth(), animationArea.width()));
-                }
-            }
+            layout->paint(ctx);
 
             if (this->highlightedMessage_ == layout)
             {
@@ -1715,15 +1937,12 @@ void ChannelView::drawMessages(QPainter &painter, const QRect &area)
         }
     }
 
-    // Only update on a full repaint as some messages with animated elements
-    // might get left out in partial repaints.
-    // This happens for example when hovering over the go-to-bottom button.
-    if (this->height() <= area.height())
+    if (!isFullRepaint)
     {
-        this->animationArea_ = animationArea;
+        this->animations_.markPainted(area);
     }
 #ifdef FOURTF
-    else
+    if (!isFullRepaint)
     {
         // shows the updated area on partial repaints
         painter.setPen(Qt::red);
@@ -3064,6 +3283,180 @@ void ChannelView::hideEvent(QHideEvent * /*event*/)
     }
 
     this->messagesOnScreen_.clear();
+
+    this->startDormancyTimer();
+}
+
+bool ChannelView::canGoDormant() const
+{
+    // Views in popups are destroyed when they're closed
+    return this->split_ != nullptr && this->context_ == Context::None &&
+           !this->dormant_ && !this->paused();
+}
+
+void ChannelView::startDormancyTimer()
+{
+    auto delay = getSettings()->dormantSplitDelay.getValue();
+    if (delay > 0 && this->canGoDormant())
+    {
+        this->dormancyTimer_.start(std::chrono::seconds(delay));
+    }
+}
+
+void ChannelView::goDormant()
+{
+    if (this->isVisible() || !this->canGoDormant())
+    {
+        return;
+    }
+
+    this->dormancyTimer_.stop();
+    this->dormant_ = true;
+    this->dormantPendingMessages_ = 0;
+    this->dormantScrollFromBottom_.reset();
+    this->olderLayoutsPending_ = false;
+    // The scrollbar is hidden together with the view, so only its position
+    // tells whether the latest messages were shown.
+    if (!this->scrollBar_->isAtBottom())
+    {
+        this->dormantScrollFromBottom_ = this->scrollBar_->getMaximum() -
+                                         this->scrollBar_->getCurrentValue();
+    }
+
+    this->messages_.clear();
+    this->snapshot_.clear();
+    this->snapshot_.shrink_to_fit();
+    this->snapshotGeneration_.reset();
+    this->messagesOnScreen_.clear();
+    this->scrollBar_->clearHighlights();
+    this->selection_ = {};
+    this->doubleClickSelection_ = {};
+    this->highlightedMessage_ = nullptr;
+    if (this->lastReadMessage_)
+    {
+        this->lastReadMessage_->deleteBuffer();
+    }
+}
+
+void ChannelView::wake()
+{
+    assert(this->dormant_);
+    this->dormant_ = false;
+
+    // Layouts are only created for the messages in view and a page above
+    // them. Older messages get theirs once the view is scrolled close to
+    // them (see #performLayout()).
+    auto snapshot = this->channel_->getMessageSnapshot();
+    auto shown =
+        static_cast<size_t>(std::ceil(this->scrollBar_->getPageSize())) * 2 +
+        this->dormantPendingMessages_;
+    if (this->dormantScrollFromBottom_)
+    {
+        shown +=
+            static_cast<size_t>(std::ceil(*this->dormantScrollFromBottom_));
+    }
+    shown = std::min(std::max(shown, MIN_WAKE_LAYOUTS), snapshot.size());
+
+    std::vector<MessageLayoutPtr> layouts;
+    layouts.reserve(shown);
+    for (auto i = snapshot.size() - shown; i < snapshot.size(); i++)
+    {
+        layouts.emplace_back(this->createLayout(snapshot[i]));
+    }
+    this->replaceMessageLayouts(std::move(layouts));
+    this->olderLayoutsPending_ = shown < snapshot.size();
+
+    if (this->dormantScrollFromBottom_)
+    {
+        // keep the same messages in view
+        this->scrollBar_->setDesiredValue(std::max(
+            this->scrollBar_->getMinimum(),
+            this->scrollBar_->getMaximum() - *this->dormantScrollFromBottom_ -
+                qreal(this->dormantPendingMessages_)));
+    }
+    else
+    {
+        this->scrollBar_->scrollToBottom();
+    }
+
+    this->dormantPendingMessages_ = 0;
+    this->dormantScrollFromBottom_.reset();
+    this->layoutQueued_ = true;
+
+    if (!this->isVisible())
+    {
+        // woken up by accessing the messages (e.g. when searching)
+        this->startDormancyTimer();
+    }
+}
+
+void ChannelView::loadOlderLayouts()
+{
+    if (!this->olderLayoutsPending_)
+    {
+        return;
+    }
+    this->olderLayoutsPending_ = false;
+
+    auto first = this->messages_.first();
+    auto snapshot = this->channel_->getMessageSnapshot();
+    auto end = snapshot.end();
+    if (first)
+    {
+        end = std::ranges::find(snapshot, (*first)->getMessagePtr());
+    }
+    if (end == snapshot.end())
+    {
+        // The channel dropped the oldest layout since
+        this->messagesUpdated();
+        return;
+    }
+
+    std::vector<MessageLayoutPtr> layouts;
+    layouts.reserve(static_cast<size_t>(end - snapshot.begin()));
+    bool ignoreHighlights = this->channel_->shouldIgnoreHighlights();
+    // the newest of these is followed by a layout without the alternate
+    // background
+    bool alternate = (end - snapshot.begin()) % 2 == 1;
+    for (auto it = snapshot.begin(); it != end; ++it)
+    {
+        auto layout = this->createLayout(*it);
+        if (layout->flags.has(MessageLayoutFlag::AlternateBackground) !=
+            alternate)
+        {
+            layout->flags.set(MessageLayoutFlag::AlternateBackground,
+                              alternate);
+            layout->invalidateBuffer();
+        }
+        layout->flags.set(MessageLayoutFlag::IgnoreHighlights,
+                          ignoreHighlights);
+        alternate = !alternate;
+        layouts.emplace_back(std::move(layout));
+    }
+    if (layouts.empty())
+    {
+        return;
+    }
+    this->lastMessageHasAlternateBackgroundReverse_ =
+        layouts.front()->flags.has(MessageLayoutFlag::AlternateBackground);
+
+    this->addLayoutsAtStart(layouts);
+}
+
+MessageLayoutPtr ChannelView::createLayout(const MessagePtr &message)
+{
+    // keeps the last read line after the view was dormant
+    if (this->lastReadMessage_ &&
+        this->lastReadMessage_->getMessagePtr() == message)
+    {
+        return this->lastReadMessage_;
+    }
+    return std::make_shared<MessageLayout>(message);
+}
+
+bool ChannelView::isDormant() const
+{
+    return this->dormant_;
 }
 
 void ChannelView::showUserInfoPopup(const QString &userName,
@@ -3091,6 +3484,38 @@ void ChannelView::showUserInfoPopup(const QString &userName,
     userPopup->show();
 }
 
+void ChannelView::messagesChanged(Channel *channel,
+                                  const std::vector<MessagePtr> &messages)
+{
+    size_t nChanged = 0;
+    if (this->underlyingChannel_.get() == channel)
+    {
+        nChanged = messages.size();
+    }
+    else
+    {
+        nChanged = static_cast<size_t>(
+            std::ranges::count_if(messages, [this](const auto &message) {
+                return this->mayContainMessage(message);
+            }));
+    }
+
+    // Only the changed messages are laid out again (their flags differ from
+    // the last layout), the remaining layouts of this view are kept.
+    auto nLayouts = this->messages_.size();
+    DebugCount::increase(
+        DebugObject::MessageRelayoutsAvoided,
+        static_cast<int64_t>(nLayouts - std::min(nChanged, nLayouts)));
+
+    if (nChanged == 0)
+    {
+        DebugCount::increase(DebugObject::ChannelViewRelayoutsAvoided);
+        return;
+    }
+
+    this->queueLayout();
+}
+
 bool ChannelView::mayContainMessage(const MessagePtr &message)
 {
     switch (this->channel()->getType())
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "common/FlagsEnum.hpp"
+#include "messages/layouts/AnimationTracker.hpp"
 #include "messages/layouts/MessageLayoutContext.hpp"
 #include "messages/LimitedQueue.hpp"
 #include "messages/MessageFlag.hpp"
@@ -197,6 +198,15 @@ public:
 
     Context getContext() const;
 
+    /// @brief Releases all message layouts if this view is hidden
+    ///
+    /// Splits do this on their own once they were hidden for a while (see
+    /// Settings::dormantSplitDelay). The layouts are created again once the
+    /// view is shown or its messages are accessed.
+    void goDormant();
+    /// Whether the message layouts are released, see #goDormant()
+    bool isDormant() const;
+
     /**
      * @brief Creates and shows a UserInfoPopup dialog
      *
@@ -296,6 +306,31 @@ private:
     void messageReplaced(size_t hint, const MessagePtr &prev,
                          const MessagePtr &replacement);
     void messagesUpdated();
+    /// Lays out the view again if it may show one of the `messages` of
+    /// `channel`, which were changed in place
+    void messagesChanged(Channel *channel,
+                         const std::vector<MessagePtr> &messages);
+    void messagesFilledIn(const std::vector<MessagePtr> &messages,
+                          const std::vector<size_t> &indices);
+    /// Replaces all layouts and updates their backgrounds and the scrollbar
+    void replaceMessageLayouts(std::vector<MessageLayoutPtr> layouts);
+    /// Asks the tab to highlight itself for a new message
+    void requestTabHighlight(const MessageFlags &messageFlags);
+
+    /// Whether this view may release its layouts while it's hidden
+    bool canGoDormant() const;
+    /// Starts #dormancyTimer_ if this view may go dormant
+    void startDormancyTimer();
+    /// Creates the layouts of the messages a dormant view shows again
+    void wake();
+    /// Creates the layouts of the messages older than the ones created by
+    /// #wake(), if there are any
+    void loadOlderLayouts();
+    /// Returns the layout of #lastReadMessage_ if it's the layout of
+    /// `message`, otherwise a new one
+    MessageLayoutPtr createLayout(const MessagePtr &message);
+    /// Adds `layouts` before all others, keeping the messages in view
+    void addLayoutsAtStart(const std::vector<MessageLayoutPtr> &layouts);
 
     void performLayout(bool causedByScrollbar = false,
                        bool causedByShow = false);
@@ -346,12 +381,28 @@ private:
     bool layoutQueued_ = false;
     bool bufferInvalidationQueued_ = false;
 
+    /// @brief Whether the layouts were released while this view was hidden
+    ///
+    /// Dormant views don't keep layouts for their messages. New messages are
+    /// still added to #channel_ and only counted. The layouts are created
+    /// again once the view is shown (see #wake()).
+    bool dormant_ = false;
+    /// Number of messages appended while dormant
+    size_t dormantPendingMessages_ = 0;
+    /// How far the view was scrolled up from the bottom when it went dormant.
+    /// Empty if it was showing the latest messages.
+    std::optional<qreal> dormantScrollFromBottom_;
+    /// Whether #wake() left out the layouts of older messages. They're
+    /// created once the view is scrolled close to them.
+    bool olderLayoutsPending_ = false;
+    /// Started when the view is hidden, see #goDormant()
+    QTimer dormancyTimer_;
+
     bool lastMessageHasAlternateBackground_ = false;
     bool lastMessageHasAlternateBackgroundReverse_ = true;
 
-    /// Tracks the area of animated elements in the last full repaint.
-    /// If this is empty (QRect::isEmpty()), no animated element is shown.
-    QRect animationArea_;
+    /// Tracks the animated images painted in the last full repaint
+    AnimationTracker animations_;
 
     bool pausable_ = false;
     QTimer pauseTimer_;
@@ -368,6 +419,8 @@ private:
 
     ThreadGuard snapshotGuard_;
     std::vector<MessageLayoutPtr> snapshot_;
+    /// LimitedQueue::generation() of messages_ when snapshot_ was taken
+    std::optional<size_t> snapshotGeneration_;
 
     /// @brief The backing (internal) channel
     ///
@@ -4,16 +4,48 @@
 
 #include "widgets/helper/DebugPopup.hpp"
 
+#include "Application.hpp"
 #include "common/Literals.hpp"
 #include "util/Clipboard.hpp"
 #include "util/DebugCount.hpp"
 
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/PluginController.hpp"
+#endif
+
 #include <QFontDatabase>
 #include <QLabel>
 #include <QPushButton>
 #include <QTimer>
 #include <QVBoxLayout>
 
+namespace {
+
+using namespace chatterino;
+using namespace literals;
+
+/// Entry points of plugins shown in the popup
+constexpr size_t MAX_PLUGIN_ENTRIES = 10;
+
+QString debugText()
+{
+    auto text = DebugCount::getDebugText();
+#ifdef CHATTERINO_HAVE_PLUGINS
+    auto *plugins = getApp()->getPlugins();
+    if (plugins != nullptr)
+    {
+        auto profiles = plugins->formatProfiles(MAX_PLUGIN_ENTRIES);
+        if (!profiles.isEmpty())
+        {
+            text += u"\nSlowest plugin callbacks:\n"_s + profiles;
+        }
+    }
+#endif
+    return text;
+}
+
+}  // namespace
+
 namespace chatterino {
 
 using namespace literals;
@@ -26,10 +58,10 @@ DebugPopup::DebugPopup()
     auto *copyButton = new QPushButton(u"&Copy"_s);
 
     QObject::connect(timer, &QTimer::timeout, [text] {
-        text->setText(DebugCount::getDebugText());
+        text->setText(debugText());
     });
     timer->start(300);
-    text->setText(DebugCount::getDebugText());
+    text->setText(debugText());
 
     text->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
 
@@ -20,51 +20,74 @@
 #include "singletons/Settings.hpp"
 #include "singletons/Theme.hpp"
 #include "singletons/WindowManager.hpp"
+#include "util/PostToThread.hpp"
 #include "widgets/helper/ChannelView.hpp"
 #include "widgets/splits/Split.hpp"
 
 #include <QHBoxLayout>
 #include <QLineEdit>
+#include <QPointer>
 #include <QPushButton>
+#include <QtConcurrent>
+
+#include <algorithm>
 
 namespace chatterino {
 
-ChannelPtr SearchPopup::filter(const QString &text, const QString &channelName,
-                               const std::vector<MessagePtr> &snapshot)
-{
-    ChannelPtr channel(new Channel(channelName, Channel::Type::None));
+namespace {
 
-    // Parse predicates from tags in "text"
-    auto predicates = parsePredicates(text);
+/// Searches with fewer candidates are checked on the GUI thread
+constexpr size_t INLINE_SEARCH_LIMIT = 1000;
 
-    // Check for every message whether it fulfills all predicates that have
-    // been registered
-    for (size_t i = 0; i < snapshot.size(); ++i)
-    {
-        MessagePtr message = snapshot[i];
+/// Number of candidates a background search checks before sending the
+/// results to the GUI thread
+constexpr size_t SEARCH_BATCH_SIZE = 2000;
 
-        bool accept = true;
-        for (const auto &pred : predicates)
+}  // namespace
+
+MessageIndex::Postings SearchPopup::candidates(const Predicates &predicates,
+                                               const MessageIndex &index)
+{
+    std::optional<MessageIndex::Postings> result;
+    for (const auto &pred : predicates)
+    {
+        auto positions = pred->lookup(index);
+        if (!positions)
         {
-            // Discard the message as soon as one predicate fails
-            if (!pred->appliesTo(*message))
-            {
-                accept = false;
-                break;
-            }
+            continue;
         }
 
-        // If all predicates match, add the message to the channel
-        if (accept)
+        if (result)
         {
-            auto overrideFlags = std::optional<MessageFlags>(message->flags);
-            overrideFlags->set(MessageFlag::DoNotLog);
-
-            channel->addMessage(message, MessageContext::Repost, overrideFlags);
+            result = MessageIndex::intersect(*result, *positions);
+        }
+        else
+        {
+            result = std::move(positions);
         }
     }
 
-    return channel;
+    if (!result)
+    {
+        return index.all();
+    }
+    return *result;
+}
+
+bool SearchPopup::accepts(const Predicates &predicates, const Message &message)
+{
+    // Discard the message as soon as one predicate fails
+    return std::ranges::all_of(predicates, [&](const auto &pred) {
+        return pred->appliesTo(message);
+    });
+}
+
+void SearchPopup::addResult(Channel &results, const MessagePtr &message)
+{
+    auto overrideFlags = std::optional<MessageFlags>(message->flags);
+    overrideFlags->set(MessageFlag::DoNotLog);
+
+    results.addMessage(message, MessageContext::Repost, overrideFlags);
 }
 
 SearchPopup::SearchPopup(QWidget *parent, Split *split)
@@ -228,13 +251,186 @@ void SearchPopup::themeChangedEvent()
 
 void SearchPopup::search()
 {
-    if (this->snapshot_.size() == 0)
+    if (!this->index_)
+    {
+        this->buildIndex();
+    }
+
+    // cancels the previous search
+    this->searchToken_ = CancellationToken();
+    this->searchPending_ = false;
+    this->pendingMessages_.clear();
+
+    this->predicates_ = std::make_shared<Predicates>(
+        parsePredicates(this->searchInput_->text()));
+    this->results_ =
+        std::make_shared<Channel>(this->channelName_, Channel::Type::None);
+
+    auto messages = this->index_->messages(
+        candidates(*this->predicates_, *this->index_));
+
+    if (messages.size() <= INLINE_SEARCH_LIMIT)
+    {
+        for (const auto &message : messages)
+        {
+            if (accepts(*this->predicates_, *message))
+            {
+                addResult(*this->results_, message);
+            }
+        }
+        this->channelView_->setChannel(this->results_);
+        return;
+    }
+
+    // Check the candidates in the background and stream the results into
+    // the view. Messages appended in the meantime are queued and checked
+    // once the search is done, so the predicates are never used by two
+    // threads at once.
+    this->channelView_->setChannel(this->results_);
+    this->searchPending_ = true;
+
+    CancellationToken token(false);
+    this->searchToken_ = token;
+
+    std::ignore = QtConcurrent::run([self = QPointer<SearchPopup>(this),
+                                     token, predicates = this->predicates_,
+                                     results = this->results_,
+                                     messages = std::move(messages)] {
+        std::vector<MessagePtr> batch;
+        for (size_t i = 0; i < messages.size(); i++)
+        {
+            if (token.isCancelled())
+            {
+                return;
+            }
+
+            if (accepts(*predicates, *messages[i]))
+            {
+                batch.push_back(messages[i]);
+            }
+
+            bool isLast = i + 1 == messages.size();
+            if (isLast || (i + 1) % SEARCH_BATCH_SIZE == 0)
+            {
+                postToThread([self, token, results, isLast,
+                              batch = std::move(batch)] {
+                    if (!self || token.isCancelled())
+                    {
+                        return;
+                    }
+
+                    for (const auto &message : batch)
+                    {
+                        addResult(*results, message);
+                    }
+                    if (isLast)
+                    {
+                        self->finishSearch();
+                    }
+                });
+                batch = {};
+            }
+        }
+    });
+}
+
+void SearchPopup::finishSearch()
+{
+    this->searchPending_ = false;
+
+    auto pending = std::move(this->pendingMessages_);
+    this->pendingMessages_.clear();
+    for (const auto &message : pending)
     {
-        this->snapshot_ = this->buildSnapshot();
+        if (accepts(*this->predicates_, *message))
+        {
+            addResult(*this->results_, message);
+        }
     }
+}
 
-    this->channelView_->setChannel(filter(this->searchInput_->text(),
-                                          this->channelName_, this->snapshot_));
+void SearchPopup::buildIndex()
+{
+    this->index_.emplace();
+    for (auto &message : this->buildSnapshot())
+    {
+        this->index_->append(std::move(message));
+    }
+
+    this->indexLimit_ =
+        static_cast<size_t>(getSettings()->scrollbackSplitLimit) *
+        std::max<qsizetype>(this->searchChannels_.size(), 1);
+
+    // Views showing the same channel share a connection. A message is
+    // indexed if any of these views would show it.
+    struct Source {
+        ChannelPtr channel;
+        /// Filters and underlying channels of the views showing `channel`
+        std::vector<std::pair<FilterSetPtr, std::weak_ptr<Channel>>> filters;
+        bool unfiltered = false;
+    };
+    std::vector<Source> sources;
+    for (auto &channel : this->searchChannels_)
+    {
+        ChannelView &view = channel.get();
+        auto it = std::ranges::find(sources, view.channel(), &Source::channel);
+        if (it == sources.end())
+        {
+            sources.push_back({.channel = view.channel()});
+            it = std::prev(sources.end());
+        }
+
+        auto filterSet = view.getFilterSet();
+        // no point in filtering if it's a single channel search
+        if (!filterSet || this->searchChannels_.size() == 1)
+        {
+            it->unfiltered = true;
+        }
+        else
+        {
+            it->filters.emplace_back(filterSet, view.underlyingChannel());
+        }
+    }
+
+    for (auto &source : sources)
+    {
+        this->signalHolder_.managedConnect(
+            source.channel->messageAppended,
+            [this, unfiltered = source.unfiltered,
+             filters = std::move(source.filters)](
+                MessagePtr &message, std::optional<MessageFlags> /*flags*/) {
+                bool shown =
+                    unfiltered ||
+                    std::ranges::any_of(filters, [&](const auto &filter) {
+                        return filter.first->filter(message,
+                                                    filter.second.lock());
+                    });
+                if (shown)
+                {
+                    this->indexMessage(message);
+                }
+            });
+    }
+}
+
+void SearchPopup::indexMessage(const MessagePtr &message)
+{
+    this->index_->append(message);
+    if (this->index_->size() > this->indexLimit_)
+    {
+        this->index_->removeFront(this->index_->size() - this->indexLimit_);
+    }
+
+    if (this->searchPending_)
+    {
+        this->pendingMessages_.push_back(message);
+        return;
+    }
+
+    if (this->predicates_ && accepts(*this->predicates_, *message))
+    {
+        addResult(*this->results_, message);
+    }
 }
 
 std::vector<MessagePtr> SearchPopup::buildSnapshot()
@@ -337,8 +533,7 @@ void SearchPopup::initLayout()
     this->searchInput_->setFocus();
 }
 
-std::vector<std::unique_ptr<MessagePredicate>> SearchPopup::parsePredicates(
-    const QString &input)
+SearchPopup::Predicates SearchPopup::parsePredicates(const QString &input)
 {
     // This regex captures all name:value predicate pairs into named capturing
     // groups and matches all other inputs seperated by spaces as normal
@@ -351,7 +546,7 @@ std::vector<std::unique_ptr<MessagePredicate>> SearchPopup::parsePredicates(
 
     QRegularExpressionMatchIterator it = predicateRegex.globalMatch(input);
 
-    std::vector<std::unique_ptr<MessagePredicate>> predicates;
+    Predicates predicates;
 
     while (it.hasNext())
     {
@@ -5,9 +5,12 @@
 #pragma once
 
 #include "ForwardDecl.hpp"
+#include "messages/search/MessageIndex.hpp"
+#include "util/CancellationToken.hpp"
 #include "widgets/BasePopup.hpp"
 
 #include <memory>
+#include <optional>
 
 class QLineEdit;
 
@@ -44,19 +47,34 @@ private:
     std::vector<MessagePtr> buildSnapshot();
 
     /**
-     * @brief Only retains those message from a list of messages that satisfy a
-     *        search query.
-     *
-     * @param text          the search query -- will be parsed for MessagePredicates
-     * @param channelName   name of the channel to be returned
-     * @param snapshot      list of messages to filter
-     * @param filterSet     channel filter to apply
+     * @brief Indexes the messages of the searched channels and keeps the
+     *        index up to date with new messages.
+     */
+    void buildIndex();
+
+    /// Called when a message was appended to one of the searched channels
+    void indexMessage(const MessagePtr &message);
+
+    /// Adds the messages queued during a background search to the results
+    void finishSearch();
+
+    using Predicates = std::vector<std::unique_ptr<MessagePredicate>>;
+
+    /**
+     * @brief Returns the positions of the messages in `index` that could
+     *        satisfy all predicates.
      *
-     * @return a ChannelPtr with "channelName" and the filtered messages from
-     *         "snapshot"
+     * Predicates that can't be resolved by the index are ignored, so the
+     * messages still have to be checked with `accepts`.
      */
-    static ChannelPtr filter(const QString &text, const QString &channelName,
-                             const std::vector<MessagePtr> &snapshot);
+    static MessageIndex::Postings candidates(const Predicates &predicates,
+                                             const MessageIndex &index);
+
+    /// Checks whether `message` satisfies all predicates
+    static bool accepts(const Predicates &predicates, const Message &message);
+
+    /// Adds a message that satisfies the search query to `results`
+    static void addResult(Channel &results, const MessagePtr &message);
 
     /**
      * @brief Checks the input for tags and registers their corresponding
@@ -65,10 +83,23 @@ private:
      * @param input the string to check for tags
      * @return a vector of MessagePredicates requested in the input
      */
-    static std::vector<std::unique_ptr<MessagePredicate>> parsePredicates(
-        const QString &input);
+    static Predicates parsePredicates(const QString &input);
+
+    std::optional<MessageIndex> index_;
+    /// Maximum number of messages kept in `index_`
+    size_t indexLimit_ = 0;
+
+    /// Predicates of the current search, shared with the background search
+    std::shared_ptr<Predicates> predicates_;
+    /// Channel holding the results of the current search
+    ChannelPtr results_;
+    /// Cancels the background search when a new search is started
+    ScopedCancellationToken searchToken_;
+    /// Set while the current search runs in the background
+    bool searchPending_ = false;
+    /// Messages appended while the current search runs in the background
+    std::vector<MessagePtr> pendingMessages_;
 
-    std::vector<MessagePtr> snapshot_;
     QLineEdit *searchInput_{};
     ChannelView *channelView_{};
     QString channelName_{};
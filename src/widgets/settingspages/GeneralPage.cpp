@@ -6,6 +6,7 @@
 
 #include "Application.hpp"
 #include "common/Literals.hpp"  // IWYU pragma: keep
+#include "common/network/NetworkCache.hpp"
 #include "common/Version.hpp"
 #include "controllers/hotkeys/HotkeyCategory.hpp"
 #include "controllers/hotkeys/HotkeyController.hpp"
@@ -1028,6 +1029,8 @@ void GeneralPage::initLayout(GeneralPageView &layout)
             if (reply == QMessageBox::Yes)
             {
                 auto cacheDir = QDir(getApp()->getPaths().cacheDirectory());
+                NetworkCache::forDirectory(getApp()->getPaths().cacheDirectory())
+                    .clear();
                 cacheDir.removeRecursively();
                 cacheDir.mkdir(getApp()->getPaths().cacheDirectory());
             }
@@ -1037,6 +1040,52 @@ void GeneralPage::initLayout(GeneralPageView &layout)
         layout.addLayout(box);
     }
 
+    SettingWidget::intInput("Maximum cache size (MiB)", s.cacheMaxSize,
+                            {
+                                .min = 64,
+                                .max = 65536,
+                                .singleStep = 64,
+                            })
+        ->setTooltip("Once the cache grows larger than this, the files that "
+                     "haven't been used for the longest time are removed.")
+        ->addTo(layout);
+
+    SettingWidget::intInput("Maximum memory for message buffers (MiB)",
+                            s.messageBufferBudget,
+                            {
+                                .min = 16,
+                                .max = 4096,
+                                .singleStep = 16,
+                            })
+        ->setTooltip("Messages are painted into buffers so they don't have to "
+                     "be painted again when scrolling. Once the buffers of all "
+                     "splits use more memory than this, the ones that weren't "
+                     "shown for the longest time are freed.")
+        ->addTo(layout);
+    SettingWidget::intInput("Paint messages up to this height without buffer "
+                            "(px)",
+                            s.messageBufferDirectPaintMaxHeight,
+                            {
+                                .min = 0,
+                                .max = 200,
+                                .singleStep = 5,
+                            })
+        ->setTooltip("Messages that aren't taller than this are painted "
+                     "directly every time, which uses less memory but more "
+                     "CPU. 0 buffers all messages.")
+        ->addTo(layout);
+    SettingWidget::intInput("Free memory of hidden splits after (seconds)",
+                            s.dormantSplitDelay,
+                            {
+                                .min = 0,
+                                .max = 3600,
+                                .singleStep = 30,
+                            })
+        ->setTooltip("Splits that weren't visible for this long (e.g. in "
+                     "background tabs) stop preparing new messages for "
+                     "display until they're shown again. 0 disables this.")
+        ->addTo(layout);
+
     layout.addTitle("Sound");
 
     SettingWidget::dropdown("Sound backend (requires restart)", s.soundBackend)
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/layouts/AnimationTracker.hpp"
+
+#include "controllers/emotes/EmoteController.hpp"
+#include "messages/Image.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "mocks/EmoteController.hpp"
+#include "singletons/helper/GifTimer.hpp"
+#include "singletons/WindowManager.hpp"
+#include "Test.hpp"
+
+#include <QCoreApplication>
+#include <QImage>
+
+#include <thread>
+
+using namespace chatterino;
+
+namespace {
+
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : windowManager(this->args_, this->paths_, this->settings, this->theme,
+                        this->fonts)
+    {
+    }
+
+    EmoteController *getEmotes() override
+    {
+        return &this->emotes;
+    }
+
+    WindowManager *getWindows() override
+    {
+        return &this->windowManager;
+    }
+
+    mock::EmoteController emotes;
+    WindowManager windowManager;
+};
+
+class AnimationTrackerTest : public ::testing::Test
+{
+protected:
+    /// Creates an animation with `nFrames` frames of `duration` ms each
+    ImagePtr makeAnimation(const QString &name, int nFrames, int duration)
+    {
+        auto image = Image::fromUrl(
+            Url{QStringLiteral("https://chatterino.test/%1.gif").arg(name)});
+
+        QList<detail::DecodedFrame> frames;
+        for (int i = 0; i < nFrames; i++)
+        {
+            QImage frame(1, 1, QImage::Format_ARGB32);
+            frame.fill(i);
+            frames.append({.image = frame, .duration = duration});
+        }
+        // frames are assigned from the decode pool and moved to the GUI
+        // thread from there
+        std::thread([&] {
+            detail::assignFrames(image, std::move(frames), nullptr);
+        }).join();
+        QCoreApplication::processEvents();
+        QCoreApplication::processEvents();
+
+        EXPECT_TRUE(image->animated());
+        return image;
+    }
+
+    /// Advances all animations by one tick of the GIF timer
+    void tick()
+    {
+        this->app.emotes.getGIFTimer()->signal.invoke();
+    }
+
+    MockApplication app;
+};
+
+}  // namespace
+
+TEST_F(AnimationTrackerTest, OnlyChangedFramesAreDirty)
+{
+    // every tick shows the next frame
+    auto fast = this->makeAnimation("fast", 4, 10);
+    // a frame lasts many ticks
+    auto slow = this->makeAnimation("slow", 2, 1000);
+    QRect fastRect(0, 0, 10, 10);
+    QRect slowRect(20, 0, 10, 10);
+
+    AnimationTracker tracker;
+    ASSERT_TRUE(tracker.empty());
+    tracker.add(fast, fastRect);
+    tracker.add(slow, slowRect);
+    ASSERT_FALSE(tracker.empty());
+    ASSERT_TRUE(tracker.dirtyRegion().isEmpty());
+
+    this->tick();
+    ASSERT_EQ(tracker.dirtyRegion(), QRegion(fastRect));
+
+    // painting the animation again makes it clean
+    tracker.markPainted(fastRect);
+    ASSERT_TRUE(tracker.dirtyRegion().isEmpty());
+}
+
+TEST_F(AnimationTrackerTest, OnlyTrackedAnimationsAreDirty)
+{
+    auto shown = this->makeAnimation("shown", 4, 10);
+    // e.g. scrolled out of view
+    auto hidden = this->makeAnimation("hidden", 4, 10);
+    QRect rect(0, 0, 10, 10);
+
+    AnimationTracker tracker;
+    tracker.add(shown, rect);
+
+    this->tick();
+    ASSERT_EQ(tracker.dirtyRegion(), QRegion(rect));
+
+    // a partial repaint that doesn't cover the whole image keeps it dirty
+    tracker.markPainted(QRect(0, 0, 5, 5));
+    ASSERT_EQ(tracker.dirtyRegion(), QRegion(rect));
+}
+
+TEST_F(AnimationTrackerTest, ResetStopsUpdates)
+{
+    auto animation = this->makeAnimation("reset", 4, 10);
+    QRect rect(0, 0, 10, 10);
+
+    AnimationTracker tracker;
+    tracker.add(animation, rect);
+    this->tick();
+    ASSERT_FALSE(tracker.dirtyRegion().isEmpty());
+
+    tracker.reset();
+    ASSERT_TRUE(tracker.empty());
+    this->tick();
+    ASSERT_TRUE(tracker.dirtyRegion().isEmpty());
+
+    // tracking it again starts from the frame that's painted then
+    tracker.add(animation, rect);
+    ASSERT_TRUE(tracker.dirtyRegion().isEmpty());
+    this->tick();
+    ASSERT_EQ(tracker.dirtyRegion(), QRegion(rect));
+}
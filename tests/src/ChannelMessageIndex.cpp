@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/ChannelMessageIndex.hpp"
+
+#include "messages/Message.hpp"
+#include "Test.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+MessagePtr makeMessage(const QString &login, const QString &id = {})
+{
+    auto message = std::make_shared<Message>();
+    message->loginName = login;
+    message->id = id;
+    return message;
+}
+
+}  // namespace
+
+TEST(ChannelMessageIndex, ByUser)
+{
+    ChannelMessageIndex index;
+    auto a1 = makeMessage("a");
+    auto b1 = makeMessage("B");
+    auto a2 = makeMessage("a");
+
+    index.pushBack(a1);
+    index.pushBack(b1);
+    index.pushBack(a2);
+
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{a1, a2}));
+    ASSERT_EQ(index.byUser(u"A"), (std::vector{a1, a2}));
+    ASSERT_EQ(index.byUser(u"b"), (std::vector{b1}));
+    ASSERT_TRUE(index.byUser(u"c").empty());
+    ASSERT_EQ(index.userCount(), 2);
+}
+
+TEST(ChannelMessageIndex, ModerationAndSubscriptions)
+{
+    ChannelMessageIndex index;
+
+    auto timeout = std::make_shared<Message>();
+    timeout->loginName = "mod";
+    timeout->timeoutUser = "user";
+
+    auto sub = std::make_shared<Message>();
+    sub->flags.set(MessageFlag::Subscription);
+    sub->messageText = "User subscribed at Tier 1.";
+
+    index.pushBack(timeout);
+    index.pushBack(sub);
+
+    ASSERT_EQ(index.byUser(u"mod"), (std::vector<MessagePtr>{timeout}));
+    ASSERT_EQ(index.byUser(u"user"), (std::vector<MessagePtr>{timeout, sub}));
+}
+
+TEST(ChannelMessageIndex, PushFrontAndPopFront)
+{
+    ChannelMessageIndex index;
+    auto old1 = makeMessage("a");
+    auto old2 = makeMessage("a");
+    auto recent = makeMessage("a");
+
+    index.pushBack(recent);
+    index.pushFront({old1, old2});
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{old1, old2, recent}));
+
+    index.popFront(old1);
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{old2, recent}));
+    index.popFront(old2);
+    index.popFront(recent);
+    ASSERT_TRUE(index.byUser(u"a").empty());
+    ASSERT_EQ(index.userCount(), 0);
+}
+
+TEST(ChannelMessageIndex, Replace)
+{
+    ChannelMessageIndex index;
+    auto a1 = makeMessage("a", "1");
+    auto a2 = makeMessage("a", "2");
+    auto a3 = makeMessage("a", "3");
+    index.pushBack(a1);
+    index.pushBack(a2);
+    index.pushBack(a3);
+
+    // the replacement keeps the position
+    auto replacement = makeMessage("a", "2");
+    index.replace(a2, replacement);
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{a1, replacement, a3}));
+    ASSERT_EQ(index.byID(u"2"), replacement);
+
+    // the replacement can belong to someone else
+    auto other = makeMessage("b");
+    index.replace(a1, other);
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{replacement, a3}));
+    ASSERT_EQ(index.byUser(u"b"), (std::vector{other}));
+    ASSERT_EQ(index.byID(u"1"), nullptr);
+
+    // unknown messages aren't replaced
+    index.replace(a1, makeMessage("c"));
+    ASSERT_TRUE(index.byUser(u"c").empty());
+
+    // messages without users or ID keep their position as well
+    auto system = std::make_shared<Message>();
+    index.pushBack(system);
+    auto a4 = makeMessage("a", "4");
+    index.pushBack(a4);
+    auto systemReplacement = makeMessage("a", "5");
+    index.replace(system, systemReplacement);
+    ASSERT_EQ(index.byUser(u"a"),
+              (std::vector{replacement, a3, systemReplacement, a4}));
+    ASSERT_EQ(index.byID(u"5"), systemReplacement);
+}
+
+TEST(ChannelMessageIndex, ByID)
+{
+    ChannelMessageIndex index;
+    auto first = makeMessage("a", "id");
+    auto second = makeMessage("b", "id");
+    auto older = makeMessage("c", "id");
+
+    ASSERT_EQ(index.byID(u"id"), nullptr);
+
+    index.pushBack(first);
+    ASSERT_EQ(index.byID(u"id"), first);
+    index.pushBack(second);
+    ASSERT_EQ(index.byID(u"id"), second);
+    // older messages don't take the place of newer ones
+    index.pushFront({older});
+    ASSERT_EQ(index.byID(u"id"), second);
+
+    // removing a message that isn't the indexed one keeps the ID
+    index.popFront(older);
+    ASSERT_EQ(index.byID(u"id"), second);
+
+    ASSERT_EQ(index.byID(u""), nullptr);
+}
+
+TEST(ChannelMessageIndex, DuplicateIDs)
+{
+    ChannelMessageIndex index;
+    auto older = makeMessage("a", "id");
+    auto newer = makeMessage("a", "id");
+    index.pushBack(older);
+    index.pushBack(newer);
+    ASSERT_EQ(index.byID(u"id"), newer);
+
+    // the older message is found again once the newer one is gone
+    auto other = makeMessage("b");
+    index.replace(newer, other);
+    ASSERT_EQ(index.byID(u"id"), older);
+
+    index.popFront(older);
+    ASSERT_EQ(index.byID(u"id"), nullptr);
+}
+
+TEST(ChannelMessageIndex, Reset)
+{
+    ChannelMessageIndex index;
+    auto a = makeMessage("a", "1");
+    auto b = makeMessage("b", "2");
+    index.pushBack(a);
+
+    index.reset({b, a});
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{a}));
+    ASSERT_EQ(index.byUser(u"b"), (std::vector{b}));
+    ASSERT_EQ(index.byID(u"1"), a);
+
+    index.clear();
+    ASSERT_EQ(index.userCount(), 0);
+    ASSERT_EQ(index.byID(u"1"), nullptr);
+}
+
+TEST(ChannelMessageIndex, BuiltOnFirstLookup)
+{
+    std::vector<MessagePtr> messages{makeMessage("a", "1")};
+    size_t loads = 0;
+    ChannelMessageIndex index([&] {
+        loads++;
+        return messages;
+    });
+
+    // changes before the first lookup are ignored
+    auto ignored = makeMessage("b");
+    index.pushBack(ignored);
+    index.popFront(messages[0]);
+    ASSERT_EQ(index.userCount(), 0);
+    ASSERT_EQ(loads, 0);
+
+    // the channel added a message that's indexed again after the load
+    auto pushed = makeMessage("a", "2");
+    messages.push_back(pushed);
+
+    ASSERT_EQ(index.byID(u"1"), messages[0]);
+    ASSERT_EQ(loads, 1);
+    index.pushBack(pushed);
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{messages[0], pushed}));
+    ASSERT_TRUE(index.byUser(u"b").empty());
+    ASSERT_EQ(loads, 1);
+
+    // a reset doesn't load the messages again
+    index.reset({pushed});
+    ASSERT_EQ(index.byUser(u"a"), (std::vector{pushed}));
+    ASSERT_EQ(loads, 1);
+}
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "widgets/helper/ChannelView.hpp"
+
+#include "common/Channel.hpp"
+#include "controllers/accounts/AccountController.hpp"
+#include "controllers/commands/CommandController.hpp"
+#include "controllers/hotkeys/HotkeyController.hpp"
+#include "messages/Message.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "mocks/EmoteController.hpp"
+#include "singletons/Fonts.hpp"
+#include "singletons/Theme.hpp"
+#include "singletons/WindowManager.hpp"
+#include "Test.hpp"
+#include "widgets/Scrollbar.hpp"
+#include "widgets/splits/Split.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : windowManager(this->args_, this->paths_, this->settings, this->theme,
+                        this->fonts)
+        , commands(this->paths_)
+    {
+    }
+
+    HotkeyController *getHotkeys() override
+    {
+        return &this->hotkeys;
+    }
+
+    WindowManager *getWindows() override
+    {
+        return &this->windowManager;
+    }
+
+    AccountController *getAccounts() override
+    {
+        return &this->accounts;
+    }
+
+    CommandController *getCommands() override
+    {
+        return &this->commands;
+    }
+
+    EmoteController *getEmotes() override
+    {
+        return &this->emotes;
+    }
+
+    HotkeyController hotkeys;
+    WindowManager windowManager;
+    AccountController accounts;
+    CommandController commands;
+    mock::EmoteController emotes;
+};
+
+MessagePtr makeMessage(int i)
+{
+    auto message = std::make_shared<Message>();
+    message->loginName = QString("user%1").arg(i);
+    message->messageText = QString::number(i);
+    return message;
+}
+
+class ChannelViewDormancyTest : public ::testing::Test
+{
+protected:
+    ChannelViewDormancyTest()
+        : split(new Split(nullptr))
+        , view(this->split->getChannelView())
+        , channel(std::make_shared<Channel>("test", Channel::Type::None))
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            this->channel->addMessage(makeMessage(i),
+                                      MessageContext::Original);
+        }
+        // the split is never shown
+        this->view.setChannel(this->channel);
+    }
+
+    MockApplication mockApplication;
+    Split *split;
+    ChannelView &view;
+    ChannelPtr channel;
+};
+
+}  // namespace
+
+TEST_F(ChannelViewDormancyTest, KeepsScrollPosition)
+{
+    auto &scrollBar = this->view.getScrollBar();
+    ASSERT_EQ(scrollBar.getMaximum(), 100);
+
+    // the user scrolled up before the split was hidden
+    scrollBar.setDesiredValue(60);
+    ASSERT_FALSE(scrollBar.isAtBottom());
+
+    auto before = this->view.getMessagesSnapshot();
+    this->view.updateLastReadMessage();
+    auto lastRead = before.back();
+
+    this->view.goDormant();
+    ASSERT_TRUE(this->view.isDormant());
+
+    size_t highlights = 0;
+    auto conn = this->view.tabHighlightRequested.connect([&](auto) {
+        highlights++;
+    });
+    for (int i = 100; i < 105; i++)
+    {
+        this->channel->addMessage(makeMessage(i), MessageContext::Original);
+    }
+    ASSERT_TRUE(this->view.isDormant());
+    ASSERT_GE(highlights, 5);
+
+    // accessing the messages wakes the view
+    const auto &after = this->view.getMessagesSnapshot();
+    ASSERT_FALSE(this->view.isDormant());
+    ASSERT_GE(after.size(), 105);
+    ASSERT_EQ(after.back()->getMessage()->messageText, "104");
+
+    // the last read line is kept, the other layouts are created again
+    ASSERT_EQ(after.at(99), lastRead);
+    ASSERT_NE(after.front(), before.front());
+    ASSERT_EQ(after.front()->getMessage(), before.front()->getMessage());
+
+    // the new messages were added below, so the same messages are in view
+    ASSERT_EQ(scrollBar.getMaximum(), qreal(after.size()));
+    ASSERT_EQ(scrollBar.getDesiredValue(), 60);
+    ASSERT_FALSE(scrollBar.isAtBottom());
+}
+
+TEST_F(ChannelViewDormancyTest, FollowsLatestMessages)
+{
+    auto &scrollBar = this->view.getScrollBar();
+    scrollBar.scrollToBottom();
+    ASSERT_TRUE(scrollBar.isAtBottom());
+
+    this->view.goDormant();
+    ASSERT_TRUE(this->view.isDormant());
+
+    for (int i = 100; i < 110; i++)
+    {
+        this->channel->addMessage(makeMessage(i), MessageContext::Original);
+    }
+
+    const auto &after = this->view.getMessagesSnapshot();
+    ASSERT_FALSE(this->view.isDormant());
+    ASSERT_GE(after.size(), 110);
+    ASSERT_TRUE(scrollBar.isAtBottom());
+    ASSERT_EQ(scrollBar.getDesiredValue(),
+              scrollBar.getMaximum() - scrollBar.getPageSize());
+}
+
+TEST_F(ChannelViewDormancyTest, PopupsStayAwake)
+{
+    ChannelView popup(nullptr, ChannelView::Context::UserCard);
+    popup.setChannel(this->channel);
+
+    popup.goDormant();
+    ASSERT_FALSE(popup.isDormant());
+    ASSERT_EQ(popup.getMessagesSnapshot().size(), 100);
+}
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/EmoteLookupTable.hpp"
+
+#include "messages/Emote.hpp"
+#include "Test.hpp"
+
+#include <QString>
+
+using namespace chatterino;
+
+namespace {
+
+EmotePtr makeEmote(const QString &name, const QString &id)
+{
+    return std::make_shared<const Emote>(Emote{
+        .name = {name},
+        .images = {},
+        .tooltip = {},
+        .homePage = {},
+        .zeroWidth = false,
+        .id = {id},
+        .author = {},
+        .baseName = {},
+    });
+}
+
+std::shared_ptr<const EmoteMap> makeMap(
+    std::initializer_list<std::pair<QString, QString>> emotes)
+{
+    auto map = std::make_shared<EmoteMap>();
+    for (const auto &[name, id] : emotes)
+    {
+        map->emplace(EmoteName{name}, makeEmote(name, id));
+    }
+    return map;
+}
+
+}  // namespace
+
+TEST(EmoteLookupTable, Precedence)
+{
+    auto channel = makeMap({{"Kappa", "channel"}, {"forsenE", "channel"}});
+    auto global = makeMap({{"Kappa", "global"}, {"PogChamp", "global"}});
+
+    EmoteLookupTable table({channel, nullptr, global});
+    ASSERT_EQ(table.size(), 3);
+
+    ASSERT_EQ(table.find(u"Kappa")->id.string, "channel");
+    ASSERT_EQ(table.find(u"forsenE")->id.string, "channel");
+    ASSERT_EQ(table.find(u"PogChamp")->id.string, "global");
+
+    // reversed precedence
+    EmoteLookupTable reversed({global, channel});
+    ASSERT_EQ(reversed.find(u"Kappa")->id.string, "global");
+}
+
+TEST(EmoteLookupTable, Misses)
+{
+    EmoteLookupTable table({makeMap({{"Kappa", "1"}, {"xD", "2"}})});
+
+    ASSERT_EQ(table.find(u""), nullptr);
+    ASSERT_EQ(table.find(u"kappa"), nullptr);
+    ASSERT_EQ(table.find(u"Kapp"), nullptr);
+    ASSERT_EQ(table.find(u"Keepo"), nullptr);
+    ASSERT_EQ(table.find(u"xd"), nullptr);
+
+    // lookups from a larger string
+    QString text = "a Kappa xD";
+    ASSERT_EQ(table.find(QStringView(text).sliced(2, 5))->id.string, "1");
+    ASSERT_EQ(table.find(QStringView(text).sliced(8))->id.string, "2");
+    ASSERT_EQ(table.find(QStringView(text).sliced(2, 4)), nullptr);
+
+    EmoteLookupTable empty(EmoteLookupTable::Sources{});
+    ASSERT_EQ(empty.size(), 0);
+    ASSERT_EQ(empty.find(u"Kappa"), nullptr);
+}
+
+TEST(EmoteLookupTable, LongNames)
+{
+    QString longName(100, u'a');
+    EmoteLookupTable table({makeMap({{longName, "1"}})});
+
+    ASSERT_NE(table.find(longName), nullptr);
+    ASSERT_EQ(table.find(QString(99, u'a')), nullptr);
+    ASSERT_EQ(table.find(QString(101, u'a')), nullptr);
+}
+
+TEST(EmoteLookupTable, IsBuiltFrom)
+{
+    auto first = makeMap({{"Kappa", "1"}});
+    auto second = makeMap({{"Keepo", "2"}});
+
+    EmoteLookupTable table({first, second});
+    ASSERT_TRUE(table.isBuiltFrom({first, second}));
+    ASSERT_FALSE(table.isBuiltFrom({second, first}));
+    ASSERT_FALSE(table.isBuiltFrom({first}));
+    ASSERT_FALSE(table.isBuiltFrom({first, makeMap({{"Keepo", "2"}})}));
+}
+
+TEST(EmoteLookupTable, Fallback)
+{
+    auto global = std::make_shared<const EmoteLookupTable>(
+        EmoteLookupTable::Sources{
+            makeMap({{"Kappa", "global"}, {"PogChamp", "global"}}),
+        });
+    auto channel = makeMap({{"Kappa", "channel"}, {"forsenE", "channel"}});
+
+    EmoteLookupTable table({channel}, global);
+    // the global emotes aren't copied
+    ASSERT_EQ(table.size(), 2);
+
+    ASSERT_EQ(table.find(u"Kappa")->id.string, "channel");
+    ASSERT_EQ(table.find(u"forsenE")->id.string, "channel");
+    ASSERT_EQ(table.find(u"PogChamp")->id.string, "global");
+    ASSERT_EQ(table.find(u"Keepo"), nullptr);
+
+    ASSERT_TRUE(table.isBuiltFrom({channel}, global));
+    ASSERT_FALSE(table.isBuiltFrom({channel}));
+    ASSERT_FALSE(table.isBuiltFrom(
+        {channel}, std::make_shared<const EmoteLookupTable>(
+                       EmoteLookupTable::Sources{})));
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/Emote.hpp"
+
+#include "Test.hpp"
+
+#include <QString>
+#include <QStringBuilder>
+
+#include <set>
+
+using namespace chatterino;
+
+namespace {
+
+EmotePtr makeEmote(const QString &name, const QString &id)
+{
+    return std::make_shared<const Emote>(Emote{
+        .name = {name},
+        .images = {},
+        .tooltip = {},
+        .homePage = {},
+        .zeroWidth = false,
+        .id = {id},
+        .author = {},
+        .baseName = {},
+    });
+}
+
+std::set<QString> names(const EmoteMap &map)
+{
+    std::set<QString> out;
+    for (const auto &[name, emote] : map)
+    {
+        out.emplace(name.string);
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(EmoteMap, InsertFindErase)
+{
+    EmoteMap map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+
+    for (int i = 0; i < 2000; i++)
+    {
+        auto name = QString::number(i);
+        map[EmoteName{name}] = makeEmote(name, u"id" % name);
+    }
+    ASSERT_EQ(map.size(), 2000);
+    ASSERT_EQ(names(map).size(), 2000);
+
+    auto it = map.find(EmoteName{"1234"});
+    ASSERT_NE(it, map.end());
+    ASSERT_EQ(it->second->id.string, "id1234");
+    ASSERT_EQ(map.find(EmoteName{"nope"}), map.end());
+    ASSERT_TRUE(map.contains(EmoteName{"0"}));
+
+    auto [existing, inserted] =
+        map.try_emplace(EmoteName{"42"}, makeEmote("42", "other"));
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(existing->second->id.string, "id42");
+
+    ASSERT_EQ(map.findEmote("", "id1999")->first.string, "1999");
+    ASSERT_EQ(map.findEmote("wrong-hint", "id7")->first.string, "7");
+    ASSERT_EQ(map.findEmote("7", "missing"), map.end());
+
+    for (int i = 0; i < 2000; i += 2)
+    {
+        ASSERT_EQ(map.erase(EmoteName{QString::number(i)}), 1);
+    }
+    ASSERT_EQ(map.erase(EmoteName{"0"}), 0);
+    ASSERT_EQ(map.size(), 1000);
+    ASSERT_EQ(names(map).size(), 1000);
+    ASSERT_FALSE(map.contains(EmoteName{"0"}));
+    ASSERT_TRUE(map.contains(EmoteName{"1"}));
+
+    map.erase(map.find(EmoteName{"1"}));
+    ASSERT_FALSE(map.contains(EmoteName{"1"}));
+    ASSERT_EQ(map.size(), 999);
+}
+
+TEST(EmoteMap, IterateFromFind)
+{
+    EmoteMap map;
+    for (int i = 0; i < 500; i++)
+    {
+        auto name = u"emote" % QString::number(i);
+        map.emplace(EmoteName{name}, makeEmote(name, name));
+    }
+
+    std::vector<QString> order;
+    for (const auto &[name, emote] : map)
+    {
+        order.push_back(name.string);
+    }
+    ASSERT_EQ(order.size(), 500);
+
+    // an iterator returned by find continues where a full iteration would
+    for (size_t i = 0; i < order.size(); i += 61)
+    {
+        auto it = map.find(EmoteName{order[i]});
+        size_t j = i;
+        for (; it != map.end(); ++it, ++j)
+        {
+            ASSERT_EQ(it->first.string, order[j]);
+        }
+        ASSERT_EQ(j, order.size());
+    }
+}
+
+TEST(EmoteMap, CopiesAreIndependent)
+{
+    EmoteMap original;
+    for (int i = 0; i < 1000; i++)
+    {
+        auto name = QString::number(i);
+        original[EmoteName{name}] = makeEmote(name, name);
+    }
+
+    auto copy = original;
+    copy[EmoteName{"new"}] = makeEmote("new", "new");
+    copy[EmoteName{"5"}] = makeEmote("5", "changed");
+    copy.erase(EmoteName{"6"});
+
+    ASSERT_EQ(original.size(), 1000);
+    ASSERT_FALSE(original.contains(EmoteName{"new"}));
+    ASSERT_EQ(original.find(EmoteName{"5"})->second->id.string, "5");
+    ASSERT_TRUE(original.contains(EmoteName{"6"}));
+
+    ASSERT_EQ(copy.size(), 1000);
+    ASSERT_TRUE(copy.contains(EmoteName{"new"}));
+    ASSERT_EQ(copy.find(EmoteName{"5"})->second->id.string, "changed");
+    ASSERT_FALSE(copy.contains(EmoteName{"6"}));
+
+    // changing the original afterwards doesn't affect the copy either
+    original.erase(EmoteName{"7"});
+    ASSERT_TRUE(copy.contains(EmoteName{"7"}));
+
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(original.size(), 999);
+}
@@ -429,3 +429,75 @@ TEST_F(FiltersF, ExpressionDebug)
             << filterString << "', but got '" << actualFilterString << "'";
     }
 }
+
+TEST_F(FiltersF, CompiledMatchesInterpreter)
+{
+    Message message;
+    message.displayName = "icelys";
+    message.usernameColor = QColor(0xff0000);
+    message.messageText = "hey there :) 2038-01-19 123 456";
+    message.channelName = "forsen";
+    message.twitchBadges = {
+        TwitchBadge("moderator", ""),
+        TwitchBadge("subscriber", ""),
+    };
+    message.twitchBadgeInfos = {{"subscriber", "14"}};
+    message.externalBadges = {"frankerfacez:bot"};
+    message.flags.set(MessageFlag::FirstMessage);
+    RunContext ctx{
+        .message = message,
+        .channel = nullptr,
+    };
+
+    QStringList tests{
+        // Constant folding
+        R".(1 + 2 * 3).",
+        R".({"a", "b"} contains "B").",
+        R".("abc" + 1 + 2).",
+        R".(5 == "5").",
+        // Short-circuiting with constants and reordered operands
+        R".((1 == 2) && author.subbed).",
+        R".(author.subbed && (1 == 1)).",
+        R".((1 == 1) || author.subbed).",
+        R".((message.content match r"\d{4}") && flags.first_message).",
+        R".((message.content match r"\d{5}") || !flags.first_message).",
+        // Typed operations
+        R".(author.sub_length >= 12 && author.sub_length < 24).",
+        R".(message.length % 7 - 1).",
+        R".(author.badges startswith "MODERATOR").",
+        R".(author.badges endswith "moderator").",
+        R".({author.name, channel.name} contains "FORSEN").",
+        R".(author.name + channel.name).",
+        R".(message.content match {r"(\d\d\d\d)\-(\d\d)\-(\d\d)", 2}).",
+        R".(message.content match {r"forsen", 1}).",
+        R".(author.name == "ICELYS" && author.name != "forsen").",
+        R".(flags.first_message == flags.reply).",
+        // Falls back to the interpreter
+        R".(author.color == "#ff0000").",
+        R".(author.sub_length == "14").",
+        R".({author.sub_length, "b"} contains "b").",
+        R".(message.content match {r"(\d+)", author.sub_length - 13}).",
+    };
+    for (const auto &identifier : VALID_IDENTIFIERS_MAP.keys())
+    {
+        tests.append(identifier);
+    }
+
+    for (const auto &input : tests)
+    {
+        auto filterResult = Filter::fromString(input);
+        bool isValid = std::holds_alternative<Filter>(filterResult);
+        ASSERT_TRUE(isValid)
+            << "Filter::fromString( " << input << " ) is invalid";
+
+        auto filter = std::move(std::get<Filter>(filterResult));
+        auto compiled = filter.execute(ctx);
+        auto interpreted = filter.interpret(ctx);
+
+        EXPECT_EQ(compiled, interpreted)
+            << "Filter{ " << input << " } evaluated to " << compiled.toString()
+            << " but the interpreter returned " << interpreted.toString()
+            << ".\nDebug: " << filter.debugString();
+        EXPECT_EQ(filter.matches(ctx), interpreted.toBool()) << input;
+    }
+}
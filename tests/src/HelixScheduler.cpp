@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/api/HelixScheduler.hpp"
+
+#include "common/network/NetworkManager.hpp"
+#include "common/network/NetworkRequest.hpp"
+#include "common/network/NetworkResult.hpp"
+#include "NetworkHelpers.hpp"
+#include "Test.hpp"
+
+#include <QDateTime>
+#include <QNetworkReply>
+
+#include <atomic>
+#include <memory>
+
+using namespace chatterino;
+
+namespace {
+
+QString getHttpbinUrl(QStringView path)
+{
+    return QString("%1/%2").arg(HTTPBIN_BASE_URL, path);
+}
+
+/// Returns a URL whose response reports `remaining` points until the bucket
+/// is refilled in `resetIn` seconds
+QString getRatelimitUrl(int remaining, qint64 resetIn)
+{
+    auto reset = QDateTime::currentSecsSinceEpoch() + resetIn;
+    return getHttpbinUrl(
+        QString("response-headers?Ratelimit-Remaining=%1&Ratelimit-Reset=%2")
+            .arg(remaining)
+            .arg(reset));
+}
+
+NetworkRequest makeRequest(const std::shared_ptr<HelixScheduler> &scheduler,
+                           const QString &url, HelixPriority priority)
+{
+    return NetworkRequest(url).scheduler(
+        [scheduler, priority](std::shared_ptr<NetworkData> data) {
+            scheduler->schedule(std::move(data), priority);
+        });
+}
+
+/// Aborts every request that's currently sent. This runs on the network
+/// thread after the requests that were started before.
+void abortAllReplies()
+{
+    QMetaObject::invokeMethod(NetworkManager::accessManager, [] {
+        for (auto *reply : NetworkManager::accessManager
+                               ->findChildren<QNetworkReply *>())
+        {
+            reply->abort();
+        }
+    });
+}
+
+}  // namespace
+
+TEST(HelixScheduler, CoalescesIdenticalRequests)
+{
+    auto scheduler = std::make_shared<HelixScheduler>();
+    auto url = getHttpbinUrl(u"delay/1");
+
+    RequestWaiter first;
+    RequestWaiter second;
+    makeRequest(scheduler, url, HelixPriority::Background)
+        .onSuccess([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 200);
+            first.requestDone();
+        })
+        .execute();
+    makeRequest(scheduler, url, HelixPriority::Background)
+        .onSuccess([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 200);
+            second.requestDone();
+        })
+        .execute();
+
+    auto metrics = scheduler->metrics();
+    ASSERT_EQ(metrics.inFlight, 1);
+    ASSERT_EQ(metrics.coalesced, 1);
+
+    first.waitForRequest();
+    second.waitForRequest();
+    ASSERT_EQ(scheduler->metrics().inFlight, 0);
+}
+
+TEST(HelixScheduler, ReservesPointsForInteractiveRequests)
+{
+    auto scheduler = std::make_shared<HelixScheduler>();
+
+    RequestWaiter bucket;
+    makeRequest(scheduler, getRatelimitUrl(5, 3), HelixPriority::Background)
+        .finally([&] {
+            bucket.requestDone();
+        })
+        .execute();
+    bucket.waitForRequest();
+    ASSERT_EQ(scheduler->metrics().remaining, 5);
+
+    // 5 points are within the interactive reserve, so background requests
+    // wait for the bucket to be refilled
+    std::atomic<bool> backgroundDone = false;
+    RequestWaiter background;
+    makeRequest(scheduler, getHttpbinUrl(u"get?background"),
+                HelixPriority::Background)
+        .finally([&] {
+            backgroundDone = true;
+            background.requestDone();
+        })
+        .execute();
+    ASSERT_EQ(scheduler->metrics().queued, 1);
+    ASSERT_EQ(scheduler->metrics().inFlight, 0);
+
+    RequestWaiter interactive;
+    makeRequest(scheduler, getHttpbinUrl(u"get?interactive"),
+                HelixPriority::Interactive)
+        .finally([&] {
+            interactive.requestDone();
+        })
+        .execute();
+    ASSERT_EQ(scheduler->metrics().inFlight, 1);
+
+    interactive.waitForRequest();
+    ASSERT_FALSE(backgroundDone);
+    ASSERT_EQ(scheduler->metrics().queued, 1);
+
+    background.waitForRequest();
+    auto metrics = scheduler->metrics();
+    ASSERT_EQ(metrics.queued, 0);
+    ASSERT_EQ(metrics.inFlight, 0);
+    ASSERT_GT(metrics.averageWait.count(), 0);
+}
+
+TEST(HelixScheduler, RetriesRateLimitedRequests)
+{
+    auto scheduler = std::make_shared<HelixScheduler>();
+
+    size_t errors = 0;
+    RequestWaiter waiter;
+    makeRequest(scheduler, getHttpbinUrl(u"status/429"),
+                HelixPriority::Interactive)
+        .onSuccess([](const NetworkResult & /*result*/) {
+            EXPECT_TRUE(false);
+        })
+        .onError([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 429);
+            errors++;
+        })
+        .finally([&] {
+            waiter.requestDone();
+        })
+        .execute();
+    waiter.waitForRequest();
+
+    auto metrics = scheduler->metrics();
+    ASSERT_EQ(errors, 1);
+    ASSERT_EQ(metrics.retried, HelixScheduler::MAX_RETRIES);
+    ASSERT_EQ(metrics.remaining, 0);
+    ASSERT_EQ(metrics.queued, 0);
+}
+
+TEST(HelixScheduler, CancelledRequestsFinish)
+{
+    auto scheduler = std::make_shared<HelixScheduler>();
+    auto url = getHttpbinUrl(u"delay/5");
+
+    RequestWaiter first;
+    RequestWaiter second;
+    makeRequest(scheduler, url, HelixPriority::Background)
+        .onSuccess([](const NetworkResult & /*result*/) {
+            EXPECT_TRUE(false);
+        })
+        .finally([&] {
+            first.requestDone();
+        })
+        .execute();
+    // coalesced into the first request
+    makeRequest(scheduler, url, HelixPriority::Background)
+        .onSuccess([](const NetworkResult & /*result*/) {
+            EXPECT_TRUE(false);
+        })
+        .onError([](const NetworkResult &result) {
+            EXPECT_EQ(result.error(),
+                      NetworkResult::NetworkError::OperationCanceledError);
+        })
+        .finally([&] {
+            second.requestDone();
+        })
+        .execute();
+    ASSERT_EQ(scheduler->metrics().inFlight, 1);
+
+    abortAllReplies();
+    first.waitForRequest();
+    second.waitForRequest();
+    ASSERT_EQ(scheduler->metrics().inFlight, 0);
+
+    // the scheduler keeps sending requests
+    RequestWaiter later;
+    makeRequest(scheduler, getHttpbinUrl(u"get?later"),
+                HelixPriority::Background)
+        .onSuccess([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 200);
+        })
+        .finally([&] {
+            later.requestDone();
+        })
+        .execute();
+    later.waitForRequest();
+    ASSERT_EQ(scheduler->metrics().inFlight, 0);
+}
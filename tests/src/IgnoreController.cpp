@@ -7,10 +7,13 @@
 #include "controllers/accounts/AccountController.hpp"
 #include "mocks/BaseApplication.hpp"
 #include "mocks/EmoteController.hpp"
+#include "providers/twitch/TwitchAccount.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "providers/twitch/TwitchIrc.hpp"
 #include "Test.hpp"
 
+#include <QtConcurrent>
+
 using namespace chatterino;
 
 namespace {
@@ -196,3 +199,32 @@ TEST_F(TestIgnoreController, processIgnorePhrases)
             << "' and output '" << message << "'";
     }
 }
+
+TEST_F(TestIgnoreController, blockedUsersFromOtherThreads)
+{
+    auto account = this->mockApplication->getAccounts()->twitch.getCurrent();
+    auto before = account->blockedUserIds();
+    account->blockUserLocally("12345", "blocked");
+
+    // snapshots don't change
+    ASSERT_FALSE(before->contains("12345"));
+    ASSERT_TRUE(account->blockedUserIds()->contains("12345"));
+    ASSERT_TRUE(account->blockedUserLogins()->contains("blocked"));
+
+    // messages are built on the thread pool
+    auto isIgnored = [](QString id, QString login) {
+        return QtConcurrent::run([id, login] {
+                   return isIgnoredMessage({
+                       .message = "hello",
+                       .twitchUserID = id,
+                       .twitchUserLogin = login,
+                       .isMod = false,
+                       .isBroadcaster = false,
+                   });
+               })
+            .result();
+    };
+    ASSERT_TRUE(isIgnored("12345", {}));
+    ASSERT_TRUE(isIgnored({}, "blocked"));
+    ASSERT_FALSE(isIgnored("54321", {}));
+}
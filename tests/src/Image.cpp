@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/Image.hpp"
+
+#include "Test.hpp"
+
+#include <QByteArray>
+#include <QList>
+
+using namespace chatterino;
+using namespace chatterino::detail;
+
+namespace {
+
+/// Builds a 1x1 GIF with one frame per entry in `delays` (in 1/100s)
+QByteArray makeGif(const QList<int> &delays)
+{
+    QByteArray gif = QByteArray::fromHex(
+        "474946383961"      // GIF89a
+        "0100010080000000"  // 1x1, 2 entry global color table
+        "000000ffffff");
+    for (auto delay : delays)
+    {
+        // graphic control extension
+        gif.append(QByteArray::fromHex("21f90400"));
+        gif.append(static_cast<char>(delay & 0xff));
+        gif.append(static_cast<char>((delay >> 8) & 0xff));
+        gif.append(QByteArray::fromHex("0000"));
+        // image descriptor and data
+        gif.append(QByteArray::fromHex("2c0000000001000100000202440100"));
+    }
+    gif.append('\x3b');
+    return gif;
+}
+
+void appendLE(QByteArray &data, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        data.append(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+/// Builds the chunk structure of an animated WebP. The frames don't contain
+/// any image data.
+QByteArray makeWebp(const QList<int> &durations)
+{
+    QByteArray chunks;
+    chunks.append("VP8X");
+    appendLE(chunks, 10, 4);
+    chunks.append(10, '\0');
+    chunks.append("ANIM");
+    appendLE(chunks, 6, 4);
+    chunks.append(6, '\0');
+    for (auto duration : durations)
+    {
+        chunks.append("ANMF");
+        appendLE(chunks, 17, 4);
+        // x, y, width - 1, height - 1
+        chunks.append(12, '\0');
+        appendLE(chunks, static_cast<uint32_t>(duration), 3);
+        chunks.append('\0');
+        chunks.append('\0');
+        // padding
+        chunks.append('\0');
+    }
+
+    QByteArray webp("RIFF");
+    appendLE(webp, static_cast<uint32_t>(chunks.size() + 4), 4);
+    webp.append("WEBP");
+    webp.append(chunks);
+    return webp;
+}
+
+}  // namespace
+
+TEST(Image, ReadGifFrameDelays)
+{
+    auto delays = readFrameDelays(makeGif({5, 10, 300}));
+    ASSERT_TRUE(delays.has_value());
+    ASSERT_EQ(*delays, (QList<int>{50, 100, 3000}));
+}
+
+TEST(Image, ReadWebpFrameDelays)
+{
+    auto delays = readFrameDelays(makeWebp({40, 100000}));
+    ASSERT_TRUE(delays.has_value());
+    ASSERT_EQ(*delays, (QList<int>{40, 100000}));
+}
+
+TEST(Image, ReadFrameDelaysOfInvalidData)
+{
+    ASSERT_FALSE(readFrameDelays("not an image").has_value());
+    ASSERT_FALSE(readFrameDelays(QByteArray::fromHex("89504e47")).has_value());
+
+    auto truncated = makeGif({5, 5});
+    truncated.chop(8);
+    ASSERT_FALSE(readFrameDelays(truncated).has_value());
+
+    // a still WebP doesn't have any frames
+    QByteArray webp("RIFF");
+    appendLE(webp, 4, 4);
+    webp.append("WEBP");
+    ASSERT_FALSE(readFrameDelays(webp).has_value());
+}
+
+TEST(Image, FrameDecoderKeepsPosition)
+{
+    FrameDecoder decoder(makeGif({5, 5, 5, 5, 5, 5}));
+
+    QList<std::pair<qsizetype, QImage>> decoded;
+    decoder.decode(0, 2, decoded);
+    decoder.decode(2, 2, decoded);
+    ASSERT_EQ(decoded.size(), 4);
+    for (qsizetype i = 0; i < decoded.size(); i++)
+    {
+        ASSERT_EQ(decoded[i].first, i);
+        ASSERT_FALSE(decoded[i].second.isNull());
+    }
+    // consecutive ranges don't decode any frame twice
+    ASSERT_EQ(decoder.framesRead(), 4);
+
+    // wrapping around starts over
+    decoded.clear();
+    decoder.decode(0, 1, decoded);
+    ASSERT_EQ(decoded.size(), 1);
+    ASSERT_EQ(decoded[0].first, 0);
+    ASSERT_EQ(decoder.framesRead(), 5);
+}
@@ -582,3 +582,56 @@ TEST_F(InputCompletionTest, SmartTabCompletionCase)
     completion = querySmartTabCompletion("nothing", false);
     ASSERT_EQ(completion.size(), 0);
 }
+
+TEST_F(InputCompletionTest, IncrementalQueries)
+{
+    auto names = [](const std::vector<EmoteItem> &items) {
+        QStringList out;
+        for (const auto &item : items)
+        {
+            out.append(item.displayName + " - " + item.providerName);
+        }
+        return out;
+    };
+
+    // typing, deleting and retyping in the same source must give the same
+    // results as a fresh source for each query
+    const QStringList queries{
+        "", ":", ":c", ":cl", ":cla", ":clap", ":cl", ":cla", ":", "",
+        "F", "Fe", "Fee", "Feel", "Feels", "Fee", "fee", "feelsB", "~",
+        "~C", "P", "Pa", "Paj", "Pajaw", "PAJAW", "pa", ":)", ":-",
+    };
+
+    auto check = [&]<typename T>() {
+        EmoteSource source(this->channelPtr.get(), std::make_unique<T>());
+        for (const auto &query : queries)
+        {
+            source.update(query);
+
+            EmoteSource fresh(this->channelPtr.get(), std::make_unique<T>());
+            fresh.update(query);
+            ASSERT_EQ(names(source.output()), names(fresh.output()))
+                << query;
+        }
+    };
+
+    check.operator()<ClassicEmoteStrategy>();
+    check.operator()<ClassicTabEmoteStrategy>();
+    check.operator()<SmartEmoteStrategy>();
+    check.operator()<SmartTabEmoteStrategy>();
+}
+
+TEST_F(InputCompletionTest, ItemsFollowEmoteMaps)
+{
+    auto completion = querySmartEmoteCompletion("NewEmote");
+    ASSERT_EQ(completion.size(), 0);
+
+    auto bttvEmotes = std::make_shared<EmoteMap>();
+    addEmote(*bttvEmotes, "NewEmote");
+    this->mockApplication->bttvEmotes.setEmotes(std::move(bttvEmotes));
+
+    completion = querySmartEmoteCompletion("NewEmote");
+    ASSERT_EQ(completion.size(), 1);
+    ASSERT_EQ(completion[0].displayName, "NewEmote");
+    ASSERT_EQ(completion[0].providerName, "Global BetterTTV");
+}
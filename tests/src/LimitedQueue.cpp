@@ -73,6 +73,65 @@ TEST(LimitedQueue, PushFront)
     EXPECT_EQ(pushed2.size(), 0);
 }
 
+TEST(LimitedQueue, Merge)
+{
+    auto less = [](int item, int queued) {
+        return item < queued;
+    };
+
+    LimitedQueue<int> queue(10);
+    for (int i : {2, 4, 6})
+    {
+        queue.pushBack(i);
+    }
+
+    auto indices = queue.merge({1, 3, 5, 7, 8}, less);
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {1, 2, 3, 4, 5, 6, 7, 8},
+                    "interleaved");
+    EXPECT_EQ(indices, (std::vector<size_t>{0, 2, 4, 6, 7}));
+
+    // equal items go after the queued ones
+    indices = queue.merge({4}, less);
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {1, 2, 3, 4, 4, 5, 6, 7, 8},
+                    "equal");
+    EXPECT_EQ(indices, (std::vector<size_t>{4}));
+
+    auto generation = queue.generation();
+    EXPECT_TRUE(queue.merge({}, less).empty());
+    EXPECT_EQ(queue.generation(), generation);
+
+    LimitedQueue<int> empty(3);
+    indices = empty.merge({1, 2}, less);
+    SNAPSHOT_EQUALS(empty.getSnapshot(), {1, 2}, "empty");
+    EXPECT_EQ(indices, (std::vector<size_t>{0, 1}));
+}
+
+TEST(LimitedQueue, MergeOverflow)
+{
+    auto less = [](int item, int queued) {
+        return item < queued;
+    };
+
+    LimitedQueue<int> queue(4);
+    for (int i : {2, 4, 6})
+    {
+        queue.pushBack(i);
+    }
+
+    // the front is removed, including the merged items there
+    auto indices = queue.merge({1, 3, 5}, less);
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {3, 4, 5, 6}, "overflow");
+    EXPECT_EQ(indices, (std::vector<size_t>{0, 2}));
+
+    // the queue keeps its limit
+    queue.pushBack(7);
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {4, 5, 6, 7}, "limit");
+
+    indices = queue.merge({0}, less);
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {4, 5, 6, 7}, "dropped");
+    EXPECT_TRUE(indices.empty());
+}
+
 TEST(LimitedQueue, ReplaceItem)
 {
     LimitedQueue<int> queue(10);
@@ -273,3 +332,40 @@ TEST(LimitedQueue, FirstN)
     SNAPSHOT_EQUALS(empty.firstN(2), {}, "empty");
     SNAPSHOT_EQUALS(empty.firstN(6), {}, "empty");
 }
+
+TEST(LimitedQueue, Generation)
+{
+    LimitedQueue<int> queue(3);
+    auto generation = queue.generation();
+
+    auto expectChanged = [&](const std::string &msg) {
+        EXPECT_NE(queue.generation(), generation) << msg;
+        generation = queue.generation();
+    };
+
+    queue.pushBack(1);
+    expectChanged("pushBack");
+    int deleted = 0;
+    queue.pushBack(2, deleted);
+    expectChanged("pushBack with deleted");
+    queue.pushFront({0});
+    expectChanged("pushFront");
+    queue.replaceItem(size_t{0}, 5);
+    expectChanged("replaceItem by index");
+    queue.replaceItem(5, 6);
+    expectChanged("replaceItem by value");
+
+    // lookups don't change the contents
+    EXPECT_EQ(queue.getSnapshot(), (std::vector{6, 1, 2}));
+    (void)queue.find(0, [](int i) {
+        return i == 6;
+    });
+    EXPECT_EQ(queue.generation(), generation);
+
+    // nothing was replaced
+    queue.replaceItem(42, 1);
+    EXPECT_EQ(queue.generation(), generation);
+
+    queue.clear();
+    expectChanged("clear");
+}
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "singletons/helper/LogWriter.hpp"
+
+#include "Test.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace chatterino;
+
+namespace {
+
+QByteArray readFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+    return file.readAll();
+}
+
+}  // namespace
+
+TEST(LogWriter, CreatesDirectoryAndWrites)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("Twitch/Channels/forsen/forsen.log");
+
+    LogWriter writer;
+    writer.open(path, "# open\n");
+    writer.append(path, "a\n");
+    writer.append(path, "b\n");
+    writer.flush();
+
+    ASSERT_EQ(readFile(path), "# open\na\nb\n");
+
+    writer.close(path, "# close\n");
+    writer.flush();
+
+    ASSERT_EQ(readFile(path), "# open\na\nb\n# close\n");
+}
+
+TEST(LogWriter, CoalescesUntilInterval)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("buffered.log");
+
+    LogWriter writer({
+        .flushInterval = std::chrono::hours(1),
+        .flushBytes = 1024 * 1024,
+    });
+    writer.open(path, {});
+    writer.append(path, "line\n");
+
+    // the line is still buffered
+    writer.sync();
+    ASSERT_EQ(readFile(path), "");
+
+    // and written once it's due
+    writer.setFlushInterval(std::chrono::milliseconds(0));
+    writer.sync();
+    ASSERT_EQ(readFile(path), "line\n");
+}
+
+TEST(LogWriter, FlushesWhenBufferIsFull)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("full.log");
+
+    LogWriter writer({
+        .flushInterval = std::chrono::hours(1),
+        .flushBytes = 8,
+    });
+    writer.open(path, {});
+    writer.append(path, "1234");
+    writer.append(path, "5678");
+    writer.append(path, "9");
+
+    writer.sync();
+    ASSERT_EQ(readFile(path), "12345678");
+
+    writer.flush();
+    ASSERT_EQ(readFile(path), "123456789");
+}
+
+TEST(LogWriter, SharedFileStaysOpenUntilLastClose)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("shared.log");
+
+    LogWriter writer;
+    writer.open(path, "# open 1\n");
+    writer.open(path, "# open 2\n");
+    writer.close(path, "# close 1\n");
+    writer.append(path, "still open\n");
+    writer.close(path, "# close 2\n");
+    writer.append(path, "closed\n");
+    writer.flush();
+
+    ASSERT_EQ(readFile(path),
+              "# open 1\n# open 2\n# close 1\nstill open\n# close 2\n");
+}
+
+TEST(LogWriter, DrainsOnDestruction)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("drain.log");
+
+    {
+        LogWriter writer({
+            .flushInterval = std::chrono::hours(1),
+            .flushBytes = 1024 * 1024,
+        });
+        writer.open(path, "# open\n");
+        for (int i = 0; i < 1000; i++)
+        {
+            writer.append(path, QString::number(i) + '\n');
+        }
+    }
+
+    auto lines = readFile(path).split('\n');
+    ASSERT_EQ(lines.size(), 1002);
+    ASSERT_EQ(lines.at(0), "# open");
+    ASSERT_EQ(lines.at(1000), "999");
+}
+
+TEST(LogWriter, NotesDroppedLines)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("dropped.log");
+
+    // every line is dropped
+    LogWriter writer({
+        .queueCapacity = 0,
+    });
+    writer.open(path, "# open\n");
+    writer.append(path, "a\n");
+    writer.append(path, "b\n");
+    writer.close(path, "# close\n");
+    writer.flush();
+
+    ASSERT_EQ(writer.droppedRecords(), 2);
+    ASSERT_EQ(readFile(path),
+              "# open\n# 2 lines dropped, logging fell behind\n# close\n");
+}
+
+TEST(LogWriter, UnopenedFilesAreIgnored)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("never-opened.log");
+
+    LogWriter writer;
+    writer.append(path, "line\n");
+    writer.flush();
+
+    ASSERT_FALSE(QFile::exists(path));
+    ASSERT_EQ(writer.droppedRecords(), 0);
+}
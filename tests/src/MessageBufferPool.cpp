@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/layouts/MessageBufferPool.hpp"
+
+#include "Test.hpp"
+
+using namespace chatterino;
+
+namespace {
+
+/// Bytes of a pixmap of the given size
+constexpr int64_t bytes(int width, int height)
+{
+    return int64_t{width} * height * 4;
+}
+
+class MessageBufferPoolTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        this->pool.clearReleased();
+        this->pool.setBudget(bytes(1000, 1000));
+        ASSERT_EQ(this->pool.usedBytes(), 0);
+    }
+
+    void TearDown() override
+    {
+        this->pool.clearReleased();
+        this->pool.setBudget(256LL * 1024 * 1024);
+    }
+
+    MessageBufferPool &pool = MessageBufferPool::instance();
+};
+
+}  // namespace
+
+TEST_F(MessageBufferPoolTest, Acquire)
+{
+    MessageBuffer buffer;
+    ASSERT_EQ(buffer.pixmap(), nullptr);
+
+    auto *pixmap = buffer.acquire({100, 20}, 2);
+    ASSERT_NE(pixmap, nullptr);
+    ASSERT_EQ(buffer.pixmap(), pixmap);
+    ASSERT_EQ(buffer.size(), QSize(100, 20));
+    // heights are rounded up
+    ASSERT_EQ(pixmap->size(), QSize(100, 32));
+    ASSERT_EQ(pixmap->devicePixelRatio(), 2);
+    ASSERT_EQ(this->pool.usedBytes(), bytes(100, 32));
+
+    buffer.release();
+    ASSERT_EQ(buffer.pixmap(), nullptr);
+    // the pixmap is kept for reuse
+    ASSERT_EQ(this->pool.usedBytes(), bytes(100, 32));
+
+    this->pool.clearReleased();
+    ASSERT_EQ(this->pool.usedBytes(), 0);
+}
+
+TEST_F(MessageBufferPoolTest, Reuse)
+{
+    MessageBuffer a;
+    auto *pixmap = a.acquire({100, 20}, 1);
+    a.release();
+
+    // same size class
+    MessageBuffer b;
+    ASSERT_EQ(b.acquire({100, 30}, 1), pixmap);
+    ASSERT_EQ(b.size(), QSize(100, 30));
+    ASSERT_EQ(this->pool.usedBytes(), bytes(100, 32));
+
+    // different size class
+    MessageBuffer c;
+    ASSERT_NE(c.acquire({100, 40}, 1), pixmap);
+    ASSERT_EQ(this->pool.usedBytes(), bytes(100, 32) + bytes(100, 48));
+}
+
+TEST_F(MessageBufferPoolTest, EvictsLeastRecentlyUsed)
+{
+    this->pool.setBudget(2 * bytes(100, 16));
+
+    MessageBuffer a;
+    MessageBuffer b;
+    MessageBuffer c;
+    a.acquire({100, 16}, 1);
+    b.acquire({100, 16}, 1);
+    a.touch();
+
+    c.acquire({100, 16}, 1);
+    ASSERT_NE(a.pixmap(), nullptr);
+    ASSERT_EQ(b.pixmap(), nullptr);
+    ASSERT_NE(c.pixmap(), nullptr);
+    ASSERT_EQ(this->pool.usedBytes(), 2 * bytes(100, 16));
+}
+
+TEST_F(MessageBufferPoolTest, DropsReleasedFirst)
+{
+    this->pool.setBudget(3 * bytes(100, 16));
+
+    MessageBuffer a;
+    MessageBuffer b;
+    a.acquire({100, 16}, 1);
+    b.acquire({100, 16}, 1);
+    b.release();
+
+    MessageBuffer c;
+    c.acquire({200, 16}, 1);
+    ASSERT_NE(a.pixmap(), nullptr);
+    ASSERT_NE(c.pixmap(), nullptr);
+    ASSERT_EQ(this->pool.usedBytes(), bytes(100, 16) + bytes(200, 16));
+}
+
+TEST_F(MessageBufferPoolTest, SetBudget)
+{
+    MessageBuffer a;
+    MessageBuffer b;
+    a.acquire({100, 16}, 1);
+    b.acquire({100, 16}, 1);
+
+    this->pool.setBudget(bytes(100, 16));
+    ASSERT_EQ(a.pixmap(), nullptr);
+    ASSERT_NE(b.pixmap(), nullptr);
+
+    this->pool.setBudget(0);
+    ASSERT_EQ(b.pixmap(), nullptr);
+    ASSERT_EQ(this->pool.usedBytes(), 0);
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageCommitQueue.hpp"
+
+#include "Test.hpp"
+
+#include <QCoreApplication>
+
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+/// A commit that appends `value` to `out`
+MessageCommitQueue::Commit append(std::vector<int> &out, int value)
+{
+    return [&out, value] {
+        out.push_back(value);
+    };
+}
+
+}  // namespace
+
+TEST(MessageCommitQueue, CommitsFromEventLoop)
+{
+    std::vector<int> out;
+    MessageCommitQueue queue;
+
+    queue.enqueue(append(out, 1));
+    queue.enqueue(append(out, 2));
+    queue.enqueue(append(out, 3));
+    ASSERT_FALSE(queue.empty());
+    ASSERT_TRUE(out.empty());
+
+    // all commits run in one batch
+    QCoreApplication::processEvents();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3}));
+
+    queue.enqueue(append(out, 4));
+    QCoreApplication::processEvents();
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(MessageCommitQueue, Flush)
+{
+    std::vector<int> out;
+    MessageCommitQueue queue;
+
+    queue.enqueue(append(out, 1));
+    queue.enqueue([&] {
+        out.push_back(2);
+        // enqueued while draining - runs after the commits before it
+        queue.enqueue(append(out, 4));
+    });
+    queue.enqueue(append(out, 3));
+
+    queue.flush();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+
+    // the posted drain has nothing left to do
+    QCoreApplication::processEvents();
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(MessageCommitQueue, DestroyDropsPendingCommits)
+{
+    std::vector<int> out;
+    {
+        MessageCommitQueue queue;
+        queue.enqueue(append(out, 1));
+    }
+
+    // the posted drain must not commit anything
+    QCoreApplication::processEvents();
+    ASSERT_TRUE(out.empty());
+}
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/search/MessageIndex.hpp"
+
+#include "messages/Message.hpp"
+#include "messages/search/AuthorPredicate.hpp"
+#include "messages/search/BadgePredicate.hpp"
+#include "messages/search/LinkPredicate.hpp"
+#include "messages/search/SubstringPredicate.hpp"
+#include "providers/twitch/TwitchBadge.hpp"
+#include "Test.hpp"
+
+#include <QStringList>
+
+#include <algorithm>
+#include <memory>
+
+using namespace chatterino;
+
+namespace {
+
+MessagePtr makeMessage(const QString &author, const QString &text,
+                       const QStringList &badges = {})
+{
+    auto message = std::make_shared<Message>();
+    message->loginName = author.toLower();
+    message->displayName = author;
+    message->messageText = text;
+    message->searchText = author + ": " + text;
+    for (const auto &badge : badges)
+    {
+        message->twitchBadges.emplace_back(badge, "1");
+    }
+    return message;
+}
+
+const std::vector<MessagePtr> MESSAGES = {
+    makeMessage("Alice", "hello chat", {"subscriber"}),
+    makeMessage("bob", "HELLO there", {"moderator", "subscriber"}),
+    makeMessage("Carol", "check out https://chatterino.com"),
+    makeMessage("alice", "forsenParty EDM forsenParty"),
+    makeMessage("Dave", "aaaaaaaa", {"vip"}),
+    makeMessage("bob", "chatterino.com is cool"),
+    makeMessage("Ünïcödé", "ÄÖÜ äöü ß"),
+    makeMessage("Eve", ""),
+};
+
+/// Returns the positions of the messages in `index` that `predicate`
+/// applies to by checking every message
+MessageIndex::Postings expected(MessagePredicate &predicate,
+                                const MessageIndex &index)
+{
+    MessageIndex::Postings result;
+    auto all = index.all();
+    auto messages = index.messages(all);
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        if (predicate.appliesTo(*messages[i]))
+        {
+            result.push_back(all[i]);
+        }
+    }
+    return result;
+}
+
+/// Checks that the lookup of `predicate` finds every message it applies to
+void checkSuperset(MessagePredicate &predicate, const MessageIndex &index)
+{
+    auto positions = predicate.lookup(index);
+    ASSERT_TRUE(positions.has_value());
+    for (auto position : expected(predicate, index))
+    {
+        ASSERT_TRUE(std::ranges::binary_search(*positions, position))
+            << position;
+    }
+}
+
+}  // namespace
+
+TEST(MessageIndex, Substring)
+{
+    MessageIndex index;
+    for (const auto &message : MESSAGES)
+    {
+        index.append(message);
+    }
+
+    ASSERT_EQ(index.substring(u"he"), std::nullopt);
+    ASSERT_EQ(index.substring(u"hello"), (MessageIndex::Postings{0, 1}));
+    ASSERT_EQ(index.substring(u"HELLO CHAT"), (MessageIndex::Postings{0}));
+    ASSERT_EQ(index.substring(u"aaaa"), (MessageIndex::Postings{4}));
+    ASSERT_EQ(index.substring(u"äöü"), (MessageIndex::Postings{6}));
+    ASSERT_EQ(index.substring(u"nothing"), MessageIndex::Postings{});
+
+    for (const auto &text : QStringList{"hello", "chatterino", "party edm",
+                                        "ÄÖÜ", "bob:", "xyz", "aaa"})
+    {
+        SubstringPredicate predicate(text);
+        checkSuperset(predicate, index);
+    }
+}
+
+TEST(MessageIndex, Predicates)
+{
+    MessageIndex index;
+    for (const auto &message : MESSAGES)
+    {
+        index.append(message);
+    }
+
+    ASSERT_EQ(index.author(u"ALICE"), (MessageIndex::Postings{0, 3}));
+    ASSERT_EQ(index.badge(u"Subscriber"), (MessageIndex::Postings{0, 1}));
+
+    AuthorPredicate authors("alice,BOB", false);
+    ASSERT_EQ(authors.lookup(index), expected(authors, index));
+
+    BadgePredicate badges("mod,vip", false);
+    ASSERT_EQ(badges.lookup(index), expected(badges, index));
+
+    LinkPredicate links(false);
+    ASSERT_EQ(links.lookup(index), expected(links, index));
+
+    // negated predicates can't be looked up
+    AuthorPredicate notAuthors("alice", true);
+    ASSERT_EQ(notAuthors.lookup(index), std::nullopt);
+}
+
+TEST(MessageIndex, RemoveFront)
+{
+    MessageIndex index;
+    // enough messages to compact the lists a few times
+    for (int round = 0; round < 1000; round++)
+    {
+        for (const auto &message : MESSAGES)
+        {
+            index.append(message);
+        }
+        if (index.size() > 3 * MESSAGES.size())
+        {
+            index.removeFront(MESSAGES.size());
+        }
+
+        ASSERT_LE(index.size(), 3 * MESSAGES.size());
+        auto all = index.all();
+        ASSERT_EQ(index.messages(all).size(), index.size());
+
+        SubstringPredicate hello("hello");
+        ASSERT_EQ(index.substring(u"hello"), expected(hello, index));
+
+        AuthorPredicate bob("bob", false);
+        ASSERT_EQ(bob.lookup(index), expected(bob, index));
+
+        LinkPredicate links(false);
+        ASSERT_EQ(links.lookup(index), expected(links, index));
+    }
+}
@@ -56,13 +56,24 @@ class MessageLayoutTest
 public:
     // "aaaaaaaa bbbbbbbb cccccccc"
     MessageLayoutTest(const QString &text)
+        : MessageLayoutTest(
+              std::make_unique<TextElement>(text, MessageElementFlag::Text))
+    {
+    }
+
+    MessageLayoutTest(std::unique_ptr<MessageElement> element)
     {
         MessageBuilder builder;
-        builder.append(
-            std::make_unique<TextElement>(text, MessageElementFlag::Text));
+        builder.append(std::move(element));
         this->layout = std::make_unique<MessageLayout>(builder.release());
+        this->doLayout();
+    }
+
+    /// Returns true if a redraw is required
+    bool doLayout()
+    {
         MessageColors colors;
-        this->layout->layout(
+        return this->layout->layout(
             {
                 .messageColors = colors,
                 .flags = MessageElementFlag::Text,
@@ -95,3 +106,67 @@ TEST(TextElement, BasicCase)
     EXPECT_EQ(wordStart, 0);
     EXPECT_EQ(wordEnd, 3);
 }
+
+TEST(MessageLayout, RelayoutOnFlagChange)
+{
+    auto test = MessageLayoutTest("abc");
+    getSettings()->hideModerated.setValue(true);
+    test.doLayout();
+    auto height = test.layout->getHeight();
+    ASSERT_GT(height, 0);
+
+    // nothing changed
+    ASSERT_FALSE(test.doLayout());
+
+    test.layout->getMessage()->flags.set(MessageFlag::Disabled);
+    ASSERT_TRUE(test.doLayout());
+    ASSERT_LT(test.layout->getHeight(), height);
+    ASSERT_FALSE(test.doLayout());
+
+    test.layout->getMessage()->flags.unset(MessageFlag::Disabled);
+    ASSERT_TRUE(test.doLayout());
+    ASSERT_EQ(test.layout->getHeight(), height);
+}
+
+#ifndef CHATTERINO_WITH_PRIVATE_QT_API
+TEST(TextElement, WrapsLongWordsWithCachedWidths)
+{
+    // the word doesn't fit into a line, so it's wrapped per character
+    auto test = MessageLayoutTest(QString(200, u'w'));
+    auto *fonts = getApp()->getFonts();
+    ASSERT_TRUE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, "w"));
+    ASSERT_GT(test.layout->getHeight(),
+              fonts->getFontMetrics(FontStyle::ChatMedium, 1).height() * 2);
+}
+#endif
+
+TEST(SingleLineTextElement, CachedWidths)
+{
+    auto test = MessageLayoutTest(std::make_unique<SingleLineTextElement>(
+        "hello world", MessageElementFlag::Text));
+    auto *fonts = getApp()->getFonts();
+    // every word is measured once, the whole text isn't
+    ASSERT_TRUE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, "hello"));
+    ASSERT_TRUE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, "world"));
+    ASSERT_TRUE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, " "));
+    ASSERT_FALSE(
+        fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, "hello world"));
+    ASSERT_EQ(fonts->getTextWidth(FontStyle::ChatMedium, 1, "world"),
+              fonts->getFontMetrics(FontStyle::ChatMedium, 1)
+                  .horizontalAdvance("world"));
+}
+
+TEST(SingleLineTextElement, ElidesLongText)
+{
+    auto test = MessageLayoutTest(std::make_unique<SingleLineTextElement>(
+        QString(200, u'x') + " y", MessageElementFlag::Text));
+    auto *fonts = getApp()->getFonts();
+    ASSERT_LT(test.layout->getHeight(),
+              fonts->getFontMetrics(FontStyle::ChatMedium, 1).height() * 2);
+    ASSERT_FALSE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1,
+                                           QString(200, u'x') + " y"));
+    // the text is elided after the first word, the rest isn't measured
+    ASSERT_TRUE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1,
+                                          QString(200, u'x')));
+    ASSERT_FALSE(fonts->hasCachedTextWidth(FontStyle::ChatMedium, 1, "y"));
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageSimilarity.hpp"
+
+#include "messages/SimilaritySketch.hpp"
+#include "Test.hpp"
+
+#include <QStringList>
+
+#include <algorithm>
+
+using namespace chatterino;
+
+namespace {
+
+/// Straightforward O(n * m) longest common substring
+qsizetype naiveLongestCommonSubstring(QStringView a, QStringView b)
+{
+    qsizetype best = 0;
+    for (qsizetype i = 0; i < a.size(); i++)
+    {
+        for (qsizetype j = 0; j < b.size(); j++)
+        {
+            qsizetype len = 0;
+            while (i + len < a.size() && j + len < b.size() &&
+                   a[i + len] == b[j + len])
+            {
+                len++;
+            }
+            best = std::max(best, len);
+        }
+    }
+    return best;
+}
+
+const QStringList INPUTS = {
+    "",
+    "a",
+    "forsenParty EDM forsenParty EDM forsenParty EDM",
+    "forsenParty EDM forsenParty EDM",
+    "EDM forsenParty",
+    "!join",
+    "!joinn",
+    "hello chat how is everyone doing",
+    "how is everyone doing chat",
+    "OMEGALUL OMEGALUL OMEGALUL",
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+    "ababababababababababababab",
+    "😂😂😂 LUL 😂😂😂",
+    "😂😂😂",
+};
+
+}  // namespace
+
+TEST(MessageSimilarity, RelativeSimilarity)
+{
+    for (const auto &a : INPUTS)
+    {
+        for (const auto &b : INPUTS)
+        {
+            auto expectedLength = naiveLongestCommonSubstring(a, b);
+            auto div = std::max<qsizetype>({1, a.size(), b.size()});
+            auto expected = float(expectedLength) / float(div);
+
+            EXPECT_FLOAT_EQ(detail::relativeSimilarity(a, b), expected)
+                << a << " <-> " << b;
+            EXPECT_FLOAT_EQ(detail::relativeSimilarity(b, a), expected)
+                << b << " <-> " << a;
+        }
+    }
+}
+
+TEST(MessageSimilarity, SketchIsUpperBound)
+{
+    for (const auto &a : INPUTS)
+    {
+        for (const auto &b : INPUTS)
+        {
+            auto bound = SimilaritySketch(a).maxCommonSubstring(
+                SimilaritySketch(b));
+            EXPECT_GE(bound, naiveLongestCommonSubstring(a, b))
+                << a << " <-> " << b;
+            EXPECT_LE(bound, std::min(a.size(), b.size()));
+        }
+    }
+}
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/network/NetworkCache.hpp"
+
+#include "Test.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTimeZone>
+
+using namespace chatterino;
+
+namespace {
+
+QString hashFor(char c)
+{
+    return QString(64, QChar::fromLatin1(c));
+}
+
+}  // namespace
+
+TEST(NetworkCache, StoreAndRead)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    NetworkCache cache(dir.path());
+    ASSERT_FALSE(cache.lookup(hashFor('a')).has_value());
+    ASSERT_FALSE(cache.read(hashFor('a')).has_value());
+
+    cache.store(hashFor('a'), "hello", {});
+    auto entry = cache.lookup(hashFor('a'));
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->size, 5);
+    ASSERT_EQ(cache.read(hashFor('a')), QByteArray("hello"));
+    ASSERT_EQ(cache.totalBytes(), 5);
+
+    cache.store(hashFor('a'), "hi", {});
+    ASSERT_EQ(cache.totalBytes(), 2);
+    ASSERT_EQ(cache.entryCount(), 1);
+}
+
+TEST(NetworkCache, IndexIsPersisted)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    {
+        NetworkCache cache(dir.path());
+        NetworkCache::Entry entry;
+        entry.etag = "\"abc\"";
+        entry.expires = 42;
+        cache.store(hashFor('b'), "data", entry);
+    }
+
+    NetworkCache cache(dir.path());
+    auto entry = cache.lookup(hashFor('b'));
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->etag, "\"abc\"");
+    ASSERT_EQ(entry->expires, 42);
+    ASSERT_EQ(entry->size, 4);
+}
+
+TEST(NetworkCache, AdoptsExistingFiles)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    {
+        QFile file(dir.filePath(hashFor('c')));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("legacy");
+    }
+    {
+        // not managed by the cache
+        QFile file(dir.filePath("123.bttv"));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("other");
+    }
+
+    NetworkCache cache(dir.path());
+    ASSERT_EQ(cache.entryCount(), 1);
+    ASSERT_EQ(cache.read(hashFor('c')), QByteArray("legacy"));
+    ASSERT_TRUE(
+        cache.lookup(hashFor('c'))->isFresh(QDateTime::currentDateTime()));
+}
+
+TEST(NetworkCache, ReconcilesOutdatedIndex)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    {
+        NetworkCache cache(dir.path());
+        cache.store(hashFor('a'), "indexed", {});
+        cache.store(hashFor('b'), "removed", {});
+    }
+
+    // files stored after the index was last saved (e.g. before a crash)
+    {
+        QFile file(dir.filePath(hashFor('c')));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("not indexed");
+    }
+    {
+        QFile file(dir.filePath(hashFor('a')));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("rewritten");
+    }
+    ASSERT_TRUE(QFile::remove(dir.filePath(hashFor('b'))));
+
+    NetworkCache cache(dir.path());
+    ASSERT_EQ(cache.entryCount(), 2);
+    ASSERT_EQ(cache.lookup(hashFor('a'))->size, 9);
+    ASSERT_FALSE(cache.lookup(hashFor('b')).has_value());
+    ASSERT_EQ(cache.lookup(hashFor('c'))->size, 11);
+    ASSERT_EQ(cache.totalBytes(), 20);
+}
+
+TEST(NetworkCache, EvictsLeastRecentlyUsed)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    NetworkCache::setMaxBytes(10);
+    NetworkCache cache(dir.path());
+
+    cache.store(hashFor('d'), "1234", {});
+    cache.store(hashFor('e'), "1234", {});
+    // the budget is exceeded, so the oldest entry is evicted until the cache
+    // fits into 90% of the budget
+    cache.store(hashFor('f'), "1234", {});
+
+    ASSERT_LE(cache.totalBytes(), 9);
+    ASSERT_TRUE(cache.lookup(hashFor('f')).has_value());
+    ASSERT_FALSE(QFile::exists(dir.filePath(hashFor('d'))) &&
+                 QFile::exists(dir.filePath(hashFor('e'))));
+
+    NetworkCache::setMaxBytes(qint64{1024} * 1024 * 1024);
+}
+
+TEST(NetworkCache, FileRemovedBehindOurBack)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    NetworkCache cache(dir.path());
+    cache.store(hashFor('a'), "hello", {});
+    ASSERT_TRUE(QFile::remove(dir.filePath(hashFor('a'))));
+
+    ASSERT_FALSE(cache.read(hashFor('a')).has_value());
+    ASSERT_FALSE(cache.lookup(hashFor('a')).has_value());
+    ASSERT_EQ(cache.totalBytes(), 0);
+}
+
+TEST(NetworkCache, EntryFromHeaders)
+{
+    auto now = QDateTime::fromSecsSinceEpoch(1000, QTimeZone::utc());
+
+    auto entry = NetworkCache::entryFromHeaders(
+        {
+            {"ETag", "\"v1\""},
+            {"Last-Modified", "Sun, 06 Nov 1994 08:49:37 GMT"},
+            {"Content-Type", "image/webp"},
+            {"Cache-Control", "public, max-age=60"},
+        },
+        now);
+    ASSERT_EQ(entry.etag, "\"v1\"");
+    ASSERT_EQ(entry.lastModified, "Sun, 06 Nov 1994 08:49:37 GMT");
+    ASSERT_EQ(entry.contentType, "image/webp");
+    ASSERT_EQ(entry.expires, 1060);
+    ASSERT_TRUE(entry.isFresh(now));
+    ASSERT_FALSE(entry.isFresh(now.addSecs(61)));
+    ASSERT_TRUE(entry.canRevalidate());
+
+    entry = NetworkCache::entryFromHeaders({{"cache-control", "no-cache"}},
+                                           now);
+    ASSERT_FALSE(entry.isFresh(now));
+    ASSERT_FALSE(entry.canRevalidate());
+
+    entry = NetworkCache::entryFromHeaders(
+        {{"Expires", "Thu, 01 Jan 1970 00:20:00 GMT"}}, now);
+    ASSERT_EQ(entry.expires, 1200);
+
+    // no freshness information - fresh until evicted
+    entry = NetworkCache::entryFromHeaders({}, now);
+    ASSERT_EQ(entry.expires, 0);
+    ASSERT_TRUE(entry.isFresh(now.addYears(1)));
+}
+
+TEST(NetworkCache, IsCacheFileName)
+{
+    ASSERT_TRUE(NetworkCache::isCacheFileName(hashFor('0')));
+    ASSERT_TRUE(NetworkCache::isCacheFileName("network-cache.idx"));
+    ASSERT_FALSE(NetworkCache::isCacheFileName("123.bttv"));
+    ASSERT_FALSE(NetworkCache::isCacheFileName(hashFor('g')));
+    ASSERT_FALSE(NetworkCache::isCacheFileName(hashFor('A')));
+}
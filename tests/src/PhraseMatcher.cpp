@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/PhraseMatcher.hpp"
+
+#include "controllers/highlights/HighlightPhrase.hpp"
+#include "Test.hpp"
+
+#include <QColor>
+#include <QStringList>
+
+#include <algorithm>
+
+using namespace chatterino;
+using namespace Qt::Literals;
+
+namespace {
+
+using Phrase = PhraseMatcher::Phrase;
+
+std::vector<size_t> matchingPhrases(const std::vector<Phrase> &phrases,
+                                    const QString &text)
+{
+    std::vector<size_t> matching;
+    for (size_t i = 0; i < phrases.size(); i++)
+    {
+        HighlightPhrase highlight(phrases[i].pattern, false, false, false,
+                                  phrases[i].isRegex,
+                                  phrases[i].isCaseSensitive, {}, QColor());
+        if (highlight.isMatch(text))
+        {
+            matching.push_back(i);
+        }
+    }
+    return matching;
+}
+
+}  // namespace
+
+TEST(PhraseMatcher, Literals)
+{
+    PhraseMatcher matcher({
+        {.pattern = u"forsen"_s},
+        {.pattern = u"Pajlada"_s, .isCaseSensitive = true},
+        {.pattern = u"sen"_s},
+        {.pattern = {}},
+        {.pattern = u"ÄBC"_s},
+    });
+
+    EXPECT_EQ(matcher.candidates(u"hello FORSEN"),
+              (std::vector<size_t>{0, 2}));
+    EXPECT_EQ(matcher.candidates(u"pajlada"), std::vector<size_t>{});
+    EXPECT_EQ(matcher.candidates(u"Pajlada"), std::vector<size_t>{1});
+    EXPECT_EQ(matcher.candidates(u"äbc"), std::vector<size_t>{4});
+    EXPECT_EQ(matcher.candidates(u""), std::vector<size_t>{});
+    EXPECT_TRUE(matcher.anyCandidate(u"xsenx"));
+    EXPECT_FALSE(matcher.anyCandidate(u"nothing here"));
+}
+
+TEST(PhraseMatcher, Regexes)
+{
+    PhraseMatcher matcher({
+        {.pattern = u"^!\\w+"_s, .isRegex = true},
+        {.pattern = u"(a)\\1"_s, .isRegex = true},  // can't be combined
+        {.pattern = u"[invalid"_s, .isRegex = true},
+        {.pattern = u"KAPPA"_s, .isRegex = true, .isCaseSensitive = true},
+        {.pattern = u"(?x) b # comment"_s, .isRegex = true},
+    });
+
+    // Expressions that can't be combined are always candidates
+    EXPECT_EQ(matcher.candidates(u"nothing"), (std::vector<size_t>{1, 4}));
+    EXPECT_EQ(matcher.candidates(u"kappa"), (std::vector<size_t>{1, 4}));
+    EXPECT_EQ(matcher.candidates(u"!cmd"), (std::vector<size_t>{0, 1, 3, 4}));
+    EXPECT_EQ(matcher.candidates(u"KAPPA"),
+              (std::vector<size_t>{0, 1, 3, 4}));
+}
+
+TEST(PhraseMatcher, ConflictingGroupNames)
+{
+    PhraseMatcher matcher({
+        {.pattern = u"(?<x>a)"_s, .isRegex = true},
+        {.pattern = u"(?<x>b)"_s, .isRegex = true},
+    });
+
+    EXPECT_EQ(matcher.candidates(u"c"), (std::vector<size_t>{0, 1}));
+}
+
+TEST(PhraseMatcher, NeverMissesAMatch)
+{
+    std::vector<Phrase> phrases{
+        {.pattern = u"forsen"_s},
+        {.pattern = u"FeelsDankMan"_s, .isCaseSensitive = true},
+        {.pattern = u"pog"_s},
+        {.pattern = u"poggers"_s},
+        {.pattern = u"ß"_s},
+        {.pattern = u"xD"_s},
+        {.pattern = u"@?pajlada"_s, .isRegex = true},
+        {.pattern = u"\\bkappa\\b"_s, .isRegex = true},
+        {.pattern = u"(?i)lul"_s, .isRegex = true, .isCaseSensitive = true},
+        {.pattern = u"^\\d{3,}$"_s, .isRegex = true},
+        {.pattern = u"(w)\\1{2}"_s, .isRegex = true},
+    };
+    PhraseMatcher matcher(phrases);
+
+    QStringList texts{
+        u""_s,
+        u"forsen"_s,
+        u"FORSEN pog"_s,
+        u"forsenE POGGERS"_s,
+        u"feelsdankman FeelsDankMan"_s,
+        u"STRASSE straße"_s,
+        u"xd XD xD"_s,
+        u"@pajlada hello"_s,
+        u"pajlada: kappa123 Kappa"_s,
+        u"LUL lul"_s,
+        u"12345"_s,
+        u"www.example.com"_s,
+        u"nothing to see here"_s,
+    };
+
+    for (const auto &text : texts)
+    {
+        auto candidates = matcher.candidates(text);
+        for (auto i : matchingPhrases(phrases, text))
+        {
+            EXPECT_TRUE(std::ranges::binary_search(candidates, i))
+                << "'" << phrases[i].pattern << "' matches '" << text
+                << "' but isn't a candidate";
+        }
+        EXPECT_EQ(matcher.anyCandidate(text), !candidates.empty()) << text;
+    }
+}
@@ -26,10 +26,12 @@
 #    include "mocks/TwitchIrcServer.hpp"
 #    include "NetworkHelpers.hpp"
 #    include "singletons/Logging.hpp"
+#    include "singletons/Settings.hpp"
 #    include "singletons/WindowManager.hpp"
 #    include "Test.hpp"
 
 #    include <lauxlib.h>
+#    include <QScopeGuard>
 #    include <sol/state_view.hpp>
 #    include <sol/table.hpp>
 
@@ -309,6 +311,87 @@ TEST_F(PluginTest, testCommands)
     EXPECT_EQ(ref.get_name(), channel->getName());
 }
 
+TEST_F(PluginTest, profileCommands)
+{
+    configure();
+
+    lua->script(R"lua(
+        c2.register_command("/fast", function(ctx) end)
+    )lua");
+    app->commands.execCommand("/fast", channel, false);
+    app->commands.execCommand("/fast with arguments", channel, false);
+
+    const auto &entries = rawpl->profile.entryPoints();
+    auto it = entries.find("command /fast");
+    ASSERT_NE(it, entries.end());
+    const auto &stats = it->second;
+    ASSERT_EQ(stats.calls, 2);
+    ASSERT_EQ(stats.aborted, 0);
+    ASSERT_GE(stats.total, stats.max);
+
+    size_t bucketed = 0;
+    for (auto n : stats.histogram)
+    {
+        bucketed += n;
+    }
+    ASSERT_EQ(bucketed, 2);
+
+    ASSERT_TRUE(rawpl->profile.format().startsWith("command /fast: 2 calls"));
+
+    rawpl->profile.reset();
+    ASSERT_TRUE(rawpl->profile.entryPoints().empty());
+}
+
+TEST_F(PluginTest, instructionBudget)
+{
+    configure();
+    auto &budget = getSettings()->pluginInstructionBudget;
+    auto previousBudget = budget.getValue();
+    auto restoreBudget = qScopeGuard([&] {
+        budget = previousBudget;
+    });
+    budget = 100'000;
+
+    lua->script(R"lua(
+        _G.ran = false
+        c2.register_command("/spin", function(ctx)
+            -- catching the error must not keep the call alive
+            while true do
+                pcall(function()
+                    while true do end
+                end)
+            end
+        end)
+        c2.register_command("/after", function(ctx)
+            _G.ran = true
+        end)
+    )lua");
+
+    app->commands.execCommand("/spin", channel, false);
+    const auto &spin = rawpl->profile.entryPoints().at("command /spin");
+    ASSERT_EQ(spin.calls, 1);
+    ASSERT_EQ(spin.aborted, 1);
+
+    // the plugin keeps working after an aborted call
+    app->commands.execCommand("/after", channel, false);
+    bool ran = (*lua)["ran"];
+    ASSERT_TRUE(ran);
+    const auto &after = rawpl->profile.entryPoints().at("command /after");
+    ASSERT_EQ(after.calls, 1);
+    ASSERT_EQ(after.aborted, 0);
+
+    // scripts outside of entry points aren't limited
+    budget = 1'000;
+    int sum = lua->script(R"lua(
+        local sum = 0
+        for i = 1, 10000 do
+            sum = sum + 1
+        end
+        return sum
+    )lua");
+    ASSERT_EQ(sum, 10000);
+}
+
 TEST_F(PluginTest, testCompletion)
 {
     configure();
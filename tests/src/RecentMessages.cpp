@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/recentmessages/Impl.hpp"
+
+#include "Test.hpp"
+
+#include <QJsonArray>
+
+using namespace chatterino;
+
+TEST(RecentMessages, SkipsLinesWithoutMessages)
+{
+    QJsonObject root{
+        {"messages",
+         QJsonArray{
+             "@room-id=11148817;rm-received-ts=1 :tmi.twitch.tv ROOMSTATE "
+             "#pajlada",
+             "@id=1;rm-received-ts=2 :nick!nick@nick.tmi.twitch.tv PRIVMSG "
+             "#pajlada :hello",
+             "",
+             ":nick!nick@nick.tmi.twitch.tv JOIN #pajlada",
+             "@rm-received-ts=3 :tmi.twitch.tv CLEARCHAT #pajlada :nick",
+         }},
+    };
+
+    auto messages = recentmessages::detail::parseRecentMessages(root);
+    ASSERT_EQ(messages.size(), 2);
+    ASSERT_EQ(messages[0]->command(), "PRIVMSG");
+    ASSERT_EQ(messages[0]->tags().value("id"), "1");
+    ASSERT_EQ(messages[1]->command(), "CLEARCHAT");
+
+    for (auto *message : messages)
+    {
+        delete message;
+    }
+}
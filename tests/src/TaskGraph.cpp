@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/TaskGraph.hpp"
+
+#include "Test.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace chatterino;
+
+TEST(TaskGraph, CallerOrder)
+{
+    TaskGraph tasks;
+    std::vector<int> order;
+    auto caller = std::this_thread::get_id();
+
+    for (int i = 0; i < 5; i++)
+    {
+        tasks.add(QString::number(i), TaskGraph::Executor::Caller, [&, i] {
+            ASSERT_EQ(std::this_thread::get_id(), caller);
+            order.push_back(i);
+        });
+    }
+    tasks.run();
+
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(TaskGraph, Dependencies)
+{
+    TaskGraph tasks;
+    std::mutex mutex;
+    std::vector<QString> order;
+    auto log = [&](const QString &name) {
+        std::lock_guard lock(mutex);
+        order.push_back(name);
+    };
+
+    auto a = tasks.add("a", TaskGraph::Executor::Pool, [&] {
+        log("a");
+    });
+    auto b = tasks.add("b", TaskGraph::Executor::Pool, [&] {
+        log("b");
+    });
+    auto c = tasks.add(
+        "c", TaskGraph::Executor::Pool,
+        [&] {
+            log("c");
+        },
+        {a, b});
+    tasks.add(
+        "d", TaskGraph::Executor::Caller,
+        [&] {
+            log("d");
+        },
+        {c});
+    tasks.run();
+
+    ASSERT_EQ(order.size(), 4);
+    ASSERT_EQ(order[2], "c");
+    ASSERT_EQ(order[3], "d");
+}
+
+TEST(TaskGraph, Concurrent)
+{
+    TaskGraph tasks;
+    std::atomic<bool> callerDone = false;
+    std::atomic<bool> poolSawCaller = false;
+    auto caller = std::this_thread::get_id();
+
+    auto pool = tasks.add("pool", TaskGraph::Executor::Pool, [&] {
+        ASSERT_NE(std::this_thread::get_id(), caller);
+        // the caller runs its task in the meantime
+        while (!callerDone)
+        {
+            std::this_thread::yield();
+        }
+        poolSawCaller = true;
+    });
+    tasks.add("caller", TaskGraph::Executor::Caller, [&] {
+        callerDone = true;
+    });
+    tasks.add(
+        "after", TaskGraph::Executor::Caller,
+        [&] {
+            ASSERT_TRUE(poolSawCaller);
+        },
+        {pool});
+    tasks.run();
+
+    ASSERT_TRUE(poolSawCaller);
+}
+
+TEST(TaskGraph, Exceptions)
+{
+    TaskGraph tasks;
+    bool ranDependent = false;
+
+    auto failing = tasks.add("failing", TaskGraph::Executor::Pool, [] {
+        throw std::runtime_error("failed");
+    });
+    tasks.add(
+        "dependent", TaskGraph::Executor::Caller,
+        [&] {
+            ranDependent = true;
+        },
+        {failing});
+
+    ASSERT_THROW(tasks.run(), std::runtime_error);
+    ASSERT_TRUE(ranDependent);
+}
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/TwitchIrcLine.hpp"
+
+#include "Test.hpp"
+
+#include <QByteArray>
+
+using namespace chatterino;
+
+TEST(TwitchIrcLine, Privmsg)
+{
+    QByteArray raw =
+        "@badge-info=subscriber/38;badges=subscriber/36;color=#8A2BE2;"
+        "display-name=Purple_Geco;emotes=;flags=;mod=0;"
+        "system-msg=hello\\sworld\\:\\\\;user-type= "
+        ":purple_geco!purple_geco@purple_geco.tmi.twitch.tv PRIVMSG #nymn "
+        ":forsenParty EDM :) \r\n";
+
+    auto line = TwitchIrcLine::parse(raw);
+    ASSERT_TRUE(line.has_value());
+
+    ASSERT_EQ(line->type(), TwitchIrcCommand::Privmsg);
+    ASSERT_EQ(line->command(), "PRIVMSG");
+    ASSERT_EQ(line->prefix(),
+              "purple_geco!purple_geco@purple_geco.tmi.twitch.tv");
+    ASSERT_EQ(line->nick(), "purple_geco");
+
+    ASSERT_EQ(line->parameterCount(), 2);
+    ASSERT_EQ(line->parameter(0), "#nymn");
+    ASSERT_EQ(line->parameterString(1), "forsenParty EDM :) ");
+    ASSERT_EQ(line->parameter(2), QByteArrayView());
+
+    ASSERT_EQ(line->tagCount(), 9);
+    ASSERT_EQ(line->tagKey(0), "badge-info");
+    ASSERT_EQ(line->rawTagValue(0), "subscriber/38");
+    ASSERT_EQ(line->tag("display-name"), "Purple_Geco");
+    ASSERT_EQ(line->tag("emotes"), "");
+    ASSERT_TRUE(line->hasTag("user-type"));
+    ASSERT_EQ(line->tag("user-type"), "");
+    ASSERT_EQ(line->tag("missing"), std::nullopt);
+    ASSERT_EQ(line->rawTag("system-msg"), "hello\\sworld\\:\\\\");
+    ASSERT_EQ(line->tag("system-msg"), "hello world;\\");
+}
+
+TEST(TwitchIrcLine, NoTagsOrPrefix)
+{
+    auto line = TwitchIrcLine::parse("PING :tmi.twitch.tv");
+    ASSERT_TRUE(line.has_value());
+    ASSERT_EQ(line->type(), TwitchIrcCommand::Ping);
+    ASSERT_EQ(line->prefix(), QByteArrayView());
+    ASSERT_EQ(line->tagCount(), 0);
+    ASSERT_EQ(line->parameterCount(), 1);
+    ASSERT_EQ(line->parameter(0), "tmi.twitch.tv");
+
+    line = TwitchIrcLine::parse(":tmi.twitch.tv 001 justinfan :Welcome, GLHF!");
+    ASSERT_TRUE(line.has_value());
+    ASSERT_EQ(line->type(), TwitchIrcCommand::Unknown);
+    ASSERT_EQ(line->command(), "001");
+    ASSERT_EQ(line->nick(), "tmi.twitch.tv");
+    ASSERT_EQ(line->parameterCount(), 2);
+    ASSERT_EQ(line->parameter(1), "Welcome, GLHF!");
+
+    line = TwitchIrcLine::parse("@key;other=1 :a!b@c JOIN #forsen");
+    ASSERT_TRUE(line.has_value());
+    ASSERT_EQ(line->type(), TwitchIrcCommand::Join);
+    ASSERT_EQ(line->nick(), "a");
+    ASSERT_EQ(line->tag("key"), "");
+    ASSERT_EQ(line->tag("other"), "1");
+    ASSERT_EQ(line->parameter(0), "#forsen");
+}
+
+TEST(TwitchIrcLine, Invalid)
+{
+    ASSERT_EQ(TwitchIrcLine::parse("").has_value(), false);
+    ASSERT_EQ(TwitchIrcLine::parse("\r\n").has_value(), false);
+    ASSERT_EQ(TwitchIrcLine::parse("@a=b;c=d").has_value(), false);
+    ASSERT_EQ(TwitchIrcLine::parse(":prefix.only").has_value(), false);
+}
+
+TEST(TwitchIrcLine, UnescapeTagValue)
+{
+    ASSERT_EQ(TwitchIrcLine::unescapeTagValue(""), "");
+    ASSERT_EQ(TwitchIrcLine::unescapeTagValue("plain"), "plain");
+    ASSERT_EQ(TwitchIrcLine::unescapeTagValue("a\\sb\\:c\\\\d\\re\\nf"),
+              "a b;c\\d\re\nf");
+    // unknown escapes keep the character, trailing backslashes are dropped
+    ASSERT_EQ(TwitchIrcLine::unescapeTagValue("\\x\\"), "x");
+    ASSERT_EQ(TwitchIrcLine::unescapeTagValue("\xc3\xa4\\s\xf0\x9f\x98\x82"),
+              QStringView(u"ä 😂"));
+}
+
+TEST(TwitchIrcLine, ParseCommand)
+{
+    ASSERT_EQ(parseTwitchIrcCommand(QByteArrayView("USERNOTICE")),
+              TwitchIrcCommand::UserNotice);
+    ASSERT_EQ(parseTwitchIrcCommand(QStringView(u"GLOBALUSERSTATE")),
+              TwitchIrcCommand::GlobalUserState);
+    ASSERT_EQ(parseTwitchIrcCommand(QStringView(u"USERSTATE")),
+              TwitchIrcCommand::UserState);
+    ASSERT_EQ(parseTwitchIrcCommand(QStringView(u"privmsg")),
+              TwitchIrcCommand::Unknown);
+    ASSERT_EQ(parseTwitchIrcCommand(QByteArrayView("")),
+              TwitchIrcCommand::Unknown);
+}
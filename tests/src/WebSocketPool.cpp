@@ -8,11 +8,20 @@
 #include "Test.hpp"
 #include "util/OnceFlag.hpp"
 
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/websocket/stream.hpp>
+
+#include <thread>
+
 using namespace chatterino;
 using namespace std::chrono_literals;
 
 namespace {
 
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+
 struct Listener : public WebSocketListener {
     Listener(std::vector<std::pair<bool, QByteArray>> &messages,
              OnceFlag &messageFlag, OnceFlag &closeFlag, OnceFlag &openFlag)
@@ -51,6 +60,139 @@ struct Listener : public WebSocketListener {
     OnceFlag &openFlag;
 };
 
+/// A websocket server on localhost that accepts permessage-deflate. It
+/// serves a single connection, echoes `nMessages` messages and closes the
+/// connection.
+class LocalEchoServer
+{
+public:
+    LocalEchoServer(size_t nMessages)
+        : acceptor(this->ioc, {asio::ip::make_address("127.0.0.1"), 0})
+        , endpoint(this->acceptor.local_endpoint())
+        , thread([this, nMessages] {
+            this->run(nMessages);
+        })
+    {
+    }
+
+    ~LocalEchoServer()
+    {
+        // If the client never connected, the server is still blocked in
+        // accept(). Closing the acceptor from here wouldn't wake it up, so
+        // connect and hang up instead - the handshake then fails. Otherwise,
+        // the connection waits in the backlog until the acceptor is closed.
+        {
+            asio::ip::tcp::socket socket(this->ioc);
+            boost::system::error_code ec;
+            socket.connect(this->endpoint, ec);
+        }
+        this->thread.join();
+    }
+
+    LocalEchoServer(const LocalEchoServer &) = delete;
+    LocalEchoServer(LocalEchoServer &&) = delete;
+    LocalEchoServer &operator=(const LocalEchoServer &) = delete;
+    LocalEchoServer &operator=(LocalEchoServer &&) = delete;
+
+    QUrl url() const
+    {
+        return QUrl(
+            QStringLiteral("ws://127.0.0.1:%1/").arg(this->endpoint.port()));
+    }
+
+private:
+    void run(size_t nMessages)
+    {
+        try
+        {
+            asio::ip::tcp::socket socket(this->ioc);
+            this->acceptor.accept(socket);
+
+            beast::websocket::stream<asio::ip::tcp::socket> ws(
+                std::move(socket));
+            beast::websocket::permessage_deflate pmd;
+            pmd.server_enable = true;
+            ws.set_option(pmd);
+            ws.accept();
+
+            beast::flat_buffer buffer;
+            for (size_t i = 0; i < nMessages; i++)
+            {
+                ws.read(buffer);
+                ws.text(ws.got_text());
+                ws.write(buffer.data());
+                buffer.consume(buffer.size());
+            }
+            ws.close(beast::websocket::close_code::normal);
+
+            // wait for the client to acknowledge the close
+            ws.read(buffer);
+        }
+        catch (const boost::system::system_error & /*err*/)
+        {
+            // the connection was closed
+        }
+    }
+
+    asio::io_context ioc;
+    asio::ip::tcp::acceptor acceptor;
+    /// The address of #acceptor. After the constructor, the acceptor is only
+    /// used by the server thread.
+    asio::ip::tcp::endpoint endpoint;
+    std::thread thread;
+};
+
+/// Sends `nMessages` copies of `message` to a LocalEchoServer and returns the
+/// traffic of the connection.
+std::shared_ptr<WebSocketTraffic> echoThroughLocalServer(
+    WebSocketCompression compression, const QByteArray &message,
+    size_t nMessages)
+{
+    LocalEchoServer server(nMessages);
+    WebSocketPool pool;
+
+    std::vector<std::pair<bool, QByteArray>> messages;
+    OnceFlag messageFlag;
+    OnceFlag closeFlag;
+    OnceFlag openFlag;
+    auto traffic = std::make_shared<WebSocketTraffic>();
+
+    auto handle = pool.createSocket(
+        {
+            .url = server.url(),
+            .headers = {},
+            .compression = compression,
+            .traffic = traffic,
+        },
+        std::make_unique<Listener>(messages, messageFlag, closeFlag, openFlag));
+    for (size_t i = 0; i < nMessages; i++)
+    {
+        handle.sendText(message);
+    }
+
+    EXPECT_TRUE(closeFlag.waitFor(1s));
+    EXPECT_TRUE(openFlag.isSet());
+    EXPECT_EQ(messages.size(), nMessages);
+    for (const auto &[isText, data] : messages)
+    {
+        EXPECT_TRUE(isText);
+        EXPECT_EQ(data, message);
+    }
+
+    return traffic;
+}
+
+QByteArray makeJsonMessage()
+{
+    QByteArray message;
+    for (int i = 0; i < 100; i++)
+    {
+        message += R"({"op":0,"d":{"type":"emote_set.update","body":{"id":")" +
+                   QByteArray::number(i) + R"("}}},)";
+    }
+    return message;
+}
+
 }  // namespace
 
 TEST(WebSocketPool, tcpEcho)
@@ -182,3 +324,29 @@ TEST(WebSocketPool, tlsEcho)
     ASSERT_EQ(messages[10].first, true);
     ASSERT_EQ(messages[10].second, "/echo");
 }
+
+TEST(WebSocketPool, compression)
+{
+    mock::BaseApplication app;
+    constexpr size_t nMessages = 10;
+    auto message = makeJsonMessage();
+    auto payloadSize = static_cast<uint64_t>(message.size()) * nMessages;
+
+    auto uncompressed = echoThroughLocalServer({}, message, nMessages);
+    ASSERT_EQ(uncompressed->messageBytesOut, payloadSize);
+    ASSERT_EQ(uncompressed->messageBytesIn, payloadSize);
+    // the frame headers are sent as well
+    ASSERT_GT(uncompressed->bytesOut, payloadSize);
+    ASSERT_GT(uncompressed->bytesIn, payloadSize);
+
+    auto compressed = echoThroughLocalServer(
+        {
+            .enabled = true,
+            .clientContextTakeover = false,
+        },
+        message, nMessages);
+    ASSERT_EQ(compressed->messageBytesOut, payloadSize);
+    ASSERT_EQ(compressed->messageBytesIn, payloadSize);
+    ASSERT_LT(compressed->bytesOut, payloadSize / 4);
+    ASSERT_LT(compressed->bytesIn, payloadSize / 4);
+}